@@ -0,0 +1,534 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "thinker/thinker.h"
+#include "thinker/thinker_status.h"
+#include "core/operator_attrs.h"
+#include "core/operator_register.h"
+
+#ifndef THINKER_BENCH_COMMIT
+#define THINKER_BENCH_COMMIT "unknown"
+#endif
+
+#if THINKER_USE_VENUS
+#define BENCH_PLATFORM "venus"
+#elif THINKER_USE_ARCS
+#define BENCH_PLATFORM "arcs"
+#elif THINKER_USE_VENUSA
+#define BENCH_PLATFORM "venusA"
+#else
+#define BENCH_PLATFORM "none"
+#endif
+
+#ifndef THINKER_BENCH_LUNA_HOST
+#define THINKER_BENCH_LUNA_HOST "OFF"
+#endif
+
+#define BENCH_MAX_TENSOR    8
+#define BENCH_MAX_SAMPLE    4096
+#define BENCH_KEY_LEN       128
+
+// Operator families the suite drives, one tensor layout each
+enum {
+    BENCH_CONV2D = 0,
+    BENCH_CONV1D,
+    BENCH_LINEAR,
+    BENCH_ADD,
+    BENCH_RELU,
+    BENCH_SOFTMAX,
+    BENCH_AVGPOOL,
+};
+
+// One point of a shape grid, fields unused by the family stay 0
+typedef struct _bench_shape_ {
+    int32_t kind_;
+    const char *variant_;   // kernel path the shape is meant to reach
+    int32_t c_, o_, h_, w_; // channels, output channels, height, width, or M/N/L for linear
+    int32_t k_, stride_, group_;
+} tBenchShape;
+
+typedef struct _bench_dtype_ {
+    const char *name_;
+    uint16_t x_, w_, y_;
+} tBenchDtype;
+
+// Synthetic operator: header, attributes and the tensors handed to forward
+typedef struct _bench_op_ {
+    tOperator op_;
+    union {
+        Conv2dIntAttrs conv2d_;
+        Conv1dIntAttrs conv1d_;
+        LinearIntAttrs linear_;
+        iqBinaryAttrs binary_;
+        SoftmaxIntAttrs softmax_;
+        PoolAttrs pool_;
+    } attr_;
+    tTensor tensor_[BENCH_MAX_TENSOR];
+    tTensor *list_[BENCH_MAX_TENSOR];
+    void *buffer_[BENCH_MAX_TENSOR];
+    int32_t num_tensor_;
+    double macs_;           // multiply-accumulates per call
+    double bytes_;          // bytes of inputs, weights and outputs per call
+} tBenchOp;
+
+// Shape grids, each crossed with the dtypes and placements that apply to its family
+static const tBenchShape g_shapes[] = {
+    {BENCH_CONV2D, "conv", 16, 16, 32, 32, 3, 1, 1},
+    {BENCH_CONV2D, "conv", 32, 32, 16, 16, 3, 1, 1},
+    {BENCH_CONV2D, "conv", 64, 64, 8, 8, 3, 1, 1},
+    {BENCH_CONV2D, "conv_s2", 32, 32, 32, 32, 3, 2, 1},
+    {BENCH_CONV2D, "conv_k5", 16, 32, 32, 32, 5, 1, 1},
+    {BENCH_CONV2D, "depthwise", 32, 32, 32, 32, 3, 1, 32},
+    {BENCH_CONV2D, "depthwise", 64, 64, 16, 16, 3, 1, 64},
+    {BENCH_CONV2D, "depthwise_s2", 64, 64, 32, 32, 3, 2, 64},
+    {BENCH_CONV2D, "pointwise", 32, 64, 16, 16, 1, 1, 1},
+    {BENCH_CONV2D, "pointwise", 128, 128, 8, 8, 1, 1, 1},
+    {BENCH_CONV2D, "split", 128, 128, 32, 32, 3, 1, 1},
+    {BENCH_CONV1D, "conv", 64, 64, 1, 256, 3, 1, 1},
+    {BENCH_CONV1D, "conv", 128, 128, 1, 128, 5, 1, 1},
+    {BENCH_CONV1D, "depthwise", 128, 128, 1, 256, 5, 1, 128},
+    {BENCH_LINEAR, "gemv", 1, 0, 256, 256, 0, 0, 0},
+    {BENCH_LINEAR, "gemm", 16, 0, 256, 256, 0, 0, 0},
+    {BENCH_LINEAR, "gemm", 64, 0, 512, 128, 0, 0, 0},
+    {BENCH_ADD, "add", 4096, 0, 0, 0, 0, 0, 0},
+    {BENCH_ADD, "add", 65536, 0, 0, 0, 0, 0, 0},
+    {BENCH_RELU, "relu", 4096, 0, 0, 0, 0, 0, 0},
+    {BENCH_RELU, "relu", 65536, 0, 0, 0, 0, 0, 0},
+    {BENCH_SOFTMAX, "softmax", 64, 0, 0, 128, 0, 0, 0},
+    {BENCH_SOFTMAX, "softmax", 16, 0, 0, 1024, 0, 0, 0},
+    {BENCH_AVGPOOL, "avgpool", 32, 32, 32, 32, 2, 2, 0},
+    {BENCH_AVGPOOL, "avgpool", 64, 64, 8, 8, 8, 8, 0},
+};
+
+// i16w16o8 is the venus img2col conv path, the other platforms report it as unsupported
+static const tBenchDtype g_weight_dtypes[] = {
+    {"i8w8o8", Int8, Int8, Int8},
+    {"i8w4o8", Int8, Int4, Int8},
+    {"i16w16o8", Int16, Int16, Int8},
+};
+
+static const tBenchDtype g_data_dtypes[] = {
+    {"i8o8", Int8, 0, Int8},
+    {"i32o32", Int32, 0, Int32},
+};
+
+// mem_.type_ of activations, weights stay in PSRAM unless everything is in share memory
+static const struct {
+    const char *name_;
+    uint8_t data_, weight_;
+} g_placements[] = {{"share", 2, 2}, {"psram", 1, 1}};
+
+static const char *g_op_names[] = {"Conv2dInt", "Conv1dInt", "LinearInt", "iqAdd", "Relu", "SoftmaxInt", "AvgPool2dInt"};
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec tv;
+#ifdef WIN32
+    timespec_get(&tv, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+#endif
+    return (uint64_t)tv.tv_sec * 1000000000ull + (uint64_t)tv.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Bytes of a tensor, int4 packs two elements per byte
+static size_t tensor_bytes(uint16_t dtype, size_t elems)
+{
+    return (dtype == Int4) ? (elems + 1) / 2 : elems * (dtype & 0xF);
+}
+
+/**
+ * @brief Append a tensor with pseudo-random contents
+ * @param b Operator under construction
+ * @param dtype Data type
+ * @param mem_type mem_.type_ of the tensor
+ * @param ndim Number of dimensions
+ * @param dims Dimension sizes
+ * @param scale Fractional bits
+ * @param extra Bytes allocated past the tensor, packed weights are padded
+ * @return tTensor* The tensor, NULL if out of memory
+ */
+static tTensor *add_tensor(tBenchOp *b, uint16_t dtype, uint8_t mem_type, int32_t ndim, const uint32_t *dims,
+                           float scale, size_t extra)
+{
+    int32_t i;
+    size_t elems = 1;
+    tTensor *t = &b->tensor_[b->num_tensor_];
+    memset(t, 0, sizeof(tTensor));
+    t->dtype_ = dtype;
+    t->mem_.type_ = mem_type;
+    t->scale_ = scale;
+    t->shape_.ndim_ = ndim;
+    for (i = 0; i < ndim; i++) {
+        t->shape_.dims_[i] = dims[i];
+        elems *= dims[i];
+    }
+    size_t bytes = tensor_bytes(dtype, elems) + extra;
+    int8_t *data = (int8_t *)malloc(bytes + 64);
+    if (data == NULL) {
+        return NULL;
+    }
+    uint32_t seed = 0x9E3779B9u * (b->num_tensor_ + 1);
+    for (size_t k = 0; k < bytes + 64; k++) {
+        seed = seed * 1664525u + 1013904223u;
+        data[k] = (int8_t)(seed >> 25);     // small values keep the requantized outputs in range
+    }
+    t->dptr_ = (addr_type)(size_t)data;
+    b->buffer_[b->num_tensor_] = data;
+    b->list_[b->num_tensor_] = t;
+    b->num_tensor_++;
+    return t;
+}
+
+static void free_op(tBenchOp *b)
+{
+    for (int32_t i = 0; i < b->num_tensor_; i++) {
+        free(b->buffer_[i]);
+    }
+    b->num_tensor_ = 0;
+}
+
+/**
+ * @brief Build the operator, tensors and workload of one case
+ * @param b Operator to fill
+ * @param s Shape
+ * @param dt Data types
+ * @param data_mem mem_.type_ of activations
+ * @param weight_mem mem_.type_ of weights and bias
+ * @return int32_t 0 on success
+ */
+static int32_t build_op(tBenchOp *b, const tBenchShape *s, const tBenchDtype *dt, uint8_t data_mem, uint8_t weight_mem)
+{
+    uint32_t x_dims[4], w_dims[4], y_dims[4], one[1];
+    size_t x_elems = 0, y_elems = 0, w_bytes = 0;
+    int32_t num_input = 1;
+    memset(b, 0, sizeof(tBenchOp));
+    b->op_.attr_offset_ = offsetof(tBenchOp, attr_);
+    b->op_.num_output_ = 1;
+
+    switch (s->kind_) {
+        case BENCH_CONV2D:
+        case BENCH_CONV1D: {
+            int32_t two_d = (s->kind_ == BENCH_CONV2D);
+            int32_t pad = s->k_ / 2;
+            int32_t oh = two_d ? (s->h_ + 2 * pad - s->k_) / s->stride_ + 1 : 1;
+            int32_t ow = (s->w_ + 2 * pad - s->k_) / s->stride_ + 1;
+            int32_t cg = s->c_ / s->group_;
+            uint32_t bias_dims[1] = {(uint32_t)s->o_};
+            if (two_d) {
+                Conv2dIntAttrs *a = &b->attr_.conv2d_;
+                a->kernel[0] = a->kernel[1] = s->k_;
+                a->stride[0] = a->stride[1] = s->stride_;
+                a->dilation[0] = a->dilation[1] = 1;
+                a->pad[0] = a->pad[1] = a->pad[2] = a->pad[3] = pad;
+                a->group = s->group_;
+                a->act_type = 1;
+                x_dims[0] = 1, x_dims[1] = s->c_, x_dims[2] = s->h_, x_dims[3] = s->w_;
+                w_dims[0] = s->o_, w_dims[1] = cg, w_dims[2] = s->k_, w_dims[3] = s->k_;
+                y_dims[0] = 1, y_dims[1] = s->o_, y_dims[2] = oh, y_dims[3] = ow;
+            } else {
+                Conv1dIntAttrs *a = &b->attr_.conv1d_;
+                a->kernel = s->k_;
+                a->stride = s->stride_;
+                a->pad[0] = a->pad[1] = pad;
+                a->group = s->group_;
+                a->act_type = 1;
+                x_dims[0] = 1, x_dims[1] = s->c_, x_dims[2] = s->w_;
+                w_dims[0] = s->o_, w_dims[1] = cg, w_dims[2] = s->k_;
+                y_dims[0] = 1, y_dims[1] = s->o_, y_dims[2] = ow;
+            }
+            int32_t ndim = two_d ? 4 : 3;
+            int32_t kernel = two_d ? s->k_ * s->k_ : s->k_;
+            // room for the padded layouts tpacker produces on each platform
+            size_t w_elems = (size_t)s->o_ * cg * kernel;
+            size_t w_padded = (size_t)ALIGN8(s->o_) * ALIGN8(cg) * kernel;
+            x_elems = (size_t)s->c_ * s->h_ * s->w_;
+            y_elems = (size_t)s->o_ * oh * ow;
+            w_bytes = tensor_bytes(dt->w_, w_elems) + s->o_ * 4;
+            if (add_tensor(b, dt->x_, data_mem, ndim, x_dims, 4, 0) == NULL ||
+                add_tensor(b, dt->w_, weight_mem, ndim, w_dims, 6, tensor_bytes(dt->w_, w_padded - w_elems)) == NULL ||
+                add_tensor(b, Int32, weight_mem, 1, bias_dims, 10, 0) == NULL) {
+                return -1;
+            }
+            num_input = 3;
+            b->macs_ = (double)y_elems * cg * kernel;
+            break;
+        }
+        case BENCH_LINEAR: {
+            // c_ rows M, h_ inner N, w_ outputs L
+            uint32_t bias_dims[1] = {(uint32_t)s->w_};
+            x_dims[0] = s->c_, x_dims[1] = s->h_;
+            w_dims[0] = s->w_, w_dims[1] = s->h_;
+            x_elems = (size_t)s->c_ * s->h_;
+            y_elems = (size_t)s->c_ * s->w_;
+            w_bytes = tensor_bytes(dt->w_, (size_t)s->w_ * s->h_) + s->w_ * 4;
+            b->attr_.linear_.alpha = 1.0f;
+            b->attr_.linear_.beta = 1.0f;
+            b->attr_.linear_.transB = 1;
+            if (add_tensor(b, dt->x_, data_mem, 2, x_dims, 4, 0) == NULL ||
+                add_tensor(b, dt->w_, weight_mem, 2, w_dims, 6, tensor_bytes(dt->w_, (size_t)ALIGN8(s->h_) * 8)) == NULL ||
+                add_tensor(b, Int32, weight_mem, 1, bias_dims, 10, 0) == NULL) {
+                return -1;
+            }
+            y_dims[0] = s->c_, y_dims[1] = s->w_;
+            num_input = 3;
+            b->macs_ = (double)y_elems * s->h_;
+            break;
+        }
+        case BENCH_ADD:
+        case BENCH_RELU: {
+            x_dims[0] = 1, x_dims[1] = s->c_;
+            y_dims[0] = 1, y_dims[1] = s->c_;
+            x_elems = y_elems = s->c_;
+            if (add_tensor(b, dt->x_, data_mem, 2, x_dims, 5, 0) == NULL) {
+                return -1;
+            }
+            if (s->kind_ == BENCH_ADD) {
+                if (add_tensor(b, dt->x_, data_mem, 2, x_dims, 4, 0) == NULL) {
+                    return -1;
+                }
+                x_elems *= 2;
+                num_input = 2;
+            }
+            break;
+        }
+        case BENCH_SOFTMAX: {
+            x_dims[0] = s->c_, x_dims[1] = s->w_;
+            y_dims[0] = s->c_, y_dims[1] = s->w_;
+            x_elems = y_elems = (size_t)s->c_ * s->w_;
+            b->attr_.softmax_.axis = -1;
+            if (add_tensor(b, dt->x_, data_mem, 2, x_dims, 4, 0) == NULL) {
+                return -1;
+            }
+            break;
+        }
+        case BENCH_AVGPOOL: {
+            PoolAttrs *a = &b->attr_.pool_;
+            a->kernel[0] = a->kernel[1] = s->k_;
+            a->stride[0] = a->stride[1] = s->stride_;
+            x_dims[0] = 1, x_dims[1] = s->c_, x_dims[2] = s->h_, x_dims[3] = s->w_;
+            y_dims[0] = 1, y_dims[1] = s->c_, y_dims[2] = (s->h_ - s->k_) / s->stride_ + 1;
+            y_dims[3] = (s->w_ - s->k_) / s->stride_ + 1;
+            x_elems = (size_t)s->c_ * s->h_ * s->w_;
+            y_elems = (size_t)s->c_ * y_dims[2] * y_dims[3];
+            if (add_tensor(b, dt->x_, data_mem, 4, x_dims, 4, 0) == NULL) {
+                return -1;
+            }
+            b->macs_ = (double)y_elems * s->k_ * s->k_;
+            break;
+        }
+        default:
+            return -1;
+    }
+
+    int32_t y_ndim = (s->kind_ == BENCH_CONV2D || s->kind_ == BENCH_AVGPOOL) ? 4 : ((s->kind_ == BENCH_CONV1D) ? 3 : 2);
+    float y_scale = (s->kind_ == BENCH_SOFTMAX) ? 7 : ((s->kind_ == BENCH_RELU) ? 5 : 4);
+    if (add_tensor(b, dt->y_, data_mem, y_ndim, y_dims, y_scale, 0) == NULL) {
+        return -1;
+    }
+
+    // Workspace in share memory, large enough for every platform to stage int32 copies of the activations
+    one[0] = (uint32_t)(8 * (x_elems + y_elems) * 4 + 256 * 1024);
+    if (add_tensor(b, Int8, 2, 1, one, 0, 0) == NULL) {
+        return -1;
+    }
+    b->op_.num_input_ = num_input;
+    b->op_.num_temp_ = 1;
+    b->bytes_ = (double)tensor_bytes(dt->x_, x_elems) + (double)w_bytes + (double)tensor_bytes(dt->y_, y_elems);
+    return 0;
+}
+
+// Median of per-call samples of the latest runs of a case, nanoseconds, or a negative status
+static double run_case(tOperatorAPI *api, tBenchOp *b, double min_time, int32_t *status)
+{
+    static double samples[BENCH_MAX_SAMPLE];
+    static tDMA_List dma_list;     // no weight transfers, weights are read in place
+    int32_t count = 0;
+    memset(&dma_list, 0, sizeof(dma_list));
+
+    // first call is the warmup and decides if the platform takes the case
+    *status = api->forward(&b->op_, b->list_, b->num_tensor_, &dma_list);
+    if (*status != T_SUCCESS) {
+        return -1;
+    }
+    uint64_t begin = bench_now_ns();
+    while (count < BENCH_MAX_SAMPLE && (count < 3 || (bench_now_ns() - begin) < min_time * 1e9)) {
+        uint64_t start = bench_now_ns();
+        api->forward(&b->op_, b->list_, b->num_tensor_, &dma_list);
+        samples[count++] = (double)(bench_now_ns() - start);
+    }
+    qsort(samples, count, sizeof(double), compare_double);
+    return samples[count / 2];
+}
+
+// ns_per_call of a key in a stored run, the last matching line wins
+static double find_baseline(const char *file, const char *key)
+{
+    char line[1024], pattern[BENCH_KEY_LEN + 16];
+    double found = -1;
+    FILE *fp = fopen(file, "r");
+    if (fp == NULL) {
+        return -1;
+    }
+    snprintf(pattern, sizeof(pattern), "\"key\": \"%s\"", key);
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (strstr(line, pattern) != NULL && strstr(line, "\"platform\": \"" BENCH_PLATFORM "\"") != NULL) {
+            const char *ns = strstr(line, "\"ns_per_call\": ");
+            if (ns != NULL) {
+                found = atof(ns + strlen("\"ns_per_call\": "));
+            }
+        }
+    }
+    fclose(fp);
+    return found;
+}
+
+static void print_usage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -f <text>    only run cases whose key contains text, e.g. Conv2dInt/depthwise\n"
+            "  -t <sec>     minimum measuring time per case, default 0.05\n"
+            "  -o <file>    append results as JSON lines\n"
+            "  -b <file>    compare against the last results of the same platform in a JSON lines file\n"
+            "  -l           list the cases without running them\n",
+            name);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = NULL, *out_file = NULL, *base_file = NULL;
+    double min_time = 0.05;
+    int32_t list_only = 0;
+    int32_t i, d, p;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-l") == 0) {
+            list_only = 1;
+        } else if (argv[i][0] == '-' && i + 1 < argc) {
+            char opt = argv[i][1];
+            const char *value = argv[++i];
+            if (opt == 'f') {
+                filter = value;
+            } else if (opt == 't') {
+                min_time = atof(value);
+            } else if (opt == 'o') {
+                out_file = value;
+            } else if (opt == 'b') {
+                base_file = value;
+            } else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (tInitialize() != T_SUCCESS) {
+        fprintf(stderr, "Failed to tInitialize\n");
+        return 1;
+    }
+    FILE *out = NULL;
+    if (out_file != NULL) {
+        out = fopen(out_file, "a");
+        if (out == NULL) {
+            fprintf(stderr, "Failed to open file: %s\n", out_file);
+            return 1;
+        }
+    }
+    time_t now = time(NULL);
+
+    printf("platform %s, luna host %s, commit %s\n", BENCH_PLATFORM, THINKER_BENCH_LUNA_HOST, THINKER_BENCH_COMMIT);
+    printf("%-64s %12s %12s %10s %10s %9s\n", "case", "us/call", "ops/s", "GB/s", "GMAC/s", "vs base");
+
+    tBenchOp *b = (tBenchOp *)malloc(sizeof(tBenchOp));
+    if (b == NULL) {
+        return 1;
+    }
+    for (i = 0; i < (int32_t)(sizeof(g_shapes) / sizeof(g_shapes[0])); i++) {
+        const tBenchShape *s = &g_shapes[i];
+        int32_t has_weight = (s->kind_ == BENCH_CONV2D || s->kind_ == BENCH_CONV1D || s->kind_ == BENCH_LINEAR);
+        const tBenchDtype *dtypes = has_weight ? g_weight_dtypes : g_data_dtypes;
+        int32_t num_dtype = has_weight ? (int32_t)(sizeof(g_weight_dtypes) / sizeof(g_weight_dtypes[0]))
+                                       : (int32_t)(sizeof(g_data_dtypes) / sizeof(g_data_dtypes[0]));
+        tOperatorAPI *api = GetOperatorAPI(g_op_names[s->kind_]);
+        for (d = 0; d < num_dtype; d++) {
+            for (p = 0; p < (int32_t)(sizeof(g_placements) / sizeof(g_placements[0])); p++) {
+                char key[BENCH_KEY_LEN];
+                // int16 reaches the img2col path of conv2d only, other kernels take it without computing
+                if (dtypes[d].x_ == Int16 && s->kind_ != BENCH_CONV2D) {
+                    continue;
+                }
+                if (s->kind_ == BENCH_LINEAR) {
+                    snprintf(key, sizeof(key), "%s/%s %s M%d N%d L%d %s", g_op_names[s->kind_], s->variant_,
+                             dtypes[d].name_, s->c_, s->h_, s->w_, g_placements[p].name_);
+                } else if (s->kind_ == BENCH_ADD || s->kind_ == BENCH_RELU || s->kind_ == BENCH_SOFTMAX) {
+                    snprintf(key, sizeof(key), "%s/%s %s %dx%d %s", g_op_names[s->kind_], s->variant_,
+                             dtypes[d].name_, s->c_, s->w_ ? s->w_ : 1, g_placements[p].name_);
+                } else if (s->kind_ == BENCH_AVGPOOL) {
+                    snprintf(key, sizeof(key), "%s/%s %s C%d %dx%d k%d s%d %s", g_op_names[s->kind_], s->variant_,
+                             dtypes[d].name_, s->c_, s->h_, s->w_, s->k_, s->stride_, g_placements[p].name_);
+                } else {
+                    snprintf(key, sizeof(key), "%s/%s %s C%d O%d %dx%d k%d s%d g%d %s", g_op_names[s->kind_],
+                             s->variant_, dtypes[d].name_, s->c_, s->o_, s->h_, s->w_, s->k_, s->stride_,
+                             s->group_, g_placements[p].name_);
+                }
+                if (filter != NULL && strstr(key, filter) == NULL) {
+                    continue;
+                }
+                if (list_only) {
+                    printf("%s\n", key);
+                    continue;
+                }
+                if (api == NULL) {
+                    printf("%-64s %12s\n", key, "not registered");
+                    continue;
+                }
+                int32_t status = T_SUCCESS;
+                double ns = -1;
+                if (build_op(b, s, &dtypes[d], g_placements[p].data_, g_placements[p].weight_) == 0) {
+                    ns = run_case(api, b, min_time, &status);
+                } else {
+                    status = T_ERR_NO_WORKSPACE;
+                }
+                if (ns <= 0) {
+                    printf("%-64s %12s %d\n", key, "status", status);
+                } else {
+                    double base = base_file ? find_baseline(base_file, key) : -1;
+                    char ratio[16] = "-";
+                    if (base > 0) {
+                        snprintf(ratio, sizeof(ratio), "%.2fx", base / ns);
+                    }
+                    printf("%-64s %12.2f %12.1f %10.3f %10.3f %9s\n", key, ns / 1e3, 1e9 / ns, b->bytes_ / ns,
+                           b->macs_ / ns, ratio);
+                }
+                if (out != NULL) {
+                    fprintf(out,
+                            "{\"time\": %lld, \"platform\": \"%s\", \"luna_host\": \"%s\", \"commit\": \"%s\", "
+                            "\"key\": \"%s\", \"status\": %d, \"ns_per_call\": %.1f, \"ops_per_s\": %.3f, "
+                            "\"bytes_per_s\": %.1f, \"macs_per_s\": %.1f}\n",
+                            (long long)now, BENCH_PLATFORM, THINKER_BENCH_LUNA_HOST, THINKER_BENCH_COMMIT, key,
+                            status, ns > 0 ? ns : 0, ns > 0 ? 1e9 / ns : 0, ns > 0 ? b->bytes_ * 1e9 / ns : 0,
+                            ns > 0 ? b->macs_ * 1e9 / ns : 0);
+                }
+                free_op(b);
+            }
+        }
+    }
+    free(b);
+    if (out != NULL) {
+        fclose(out);
+    }
+    tUninitialize();
+    return 0;
+}
@@ -4,6 +4,13 @@
 #include "thinker/thinker.h"
 #include "thinker/thinker_status.h"
 
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define PSRAM_SIZE  (8*1024*1024)
 #define SHARE_SIZE  (640*1024)
 
@@ -41,6 +48,34 @@ static int32_t load_binary_file(const char *file, int8_t **ptr, uint64_t *size)
 	return 0;
 }
 
+#if defined(__linux__)
+// Map the model file instead of reading it, pages are loaded when first touched
+static int32_t map_binary_file(const char *file, int8_t **ptr, uint64_t *size)
+{
+    int fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        printf("Failed to open file: %s\n", file);
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+    *size = st.st_size;
+    // read-only: tModelInitMapped never writes the resource
+    void *addr = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        printf("Failed to map file: %s\n", file);
+        return -1;
+    }
+    *ptr = (int8_t *)addr;
+    return 0;
+}
+#endif
+
 static int32_t save_binary_file(const char *file, int8_t *ptr, int32_t size)
 {
 	FILE *fp = fopen(file, "ab+");
@@ -54,6 +89,29 @@ static int32_t save_binary_file(const char *file, int8_t *ptr, int32_t size)
 	return 0;
 }
 
+#if THINKER_PROFILE
+// Operator records in the csv layout read by tprofile --measured
+static int32_t save_profile_file(const char *file, const tProfileRecord *records, int32_t num)
+{
+	FILE *fp = fopen(file, "w");
+	if (!fp) {
+		printf("Failed to open file: %s\n", file);
+		return -1;
+	}
+	fprintf(fp, "op_index,op_type,tensor_name,forward,start,end,dma_wait,bytes_in,bytes_out\n");
+	for (int32_t i = 0; i < num; i++) {
+		const tProfileRecord *r = records + i;
+		fprintf(fp, "%d,%s,%s,%u,%llu,%llu,%llu,%llu,%llu\n", r->op_index_, r->name_,
+				r->tensor_name_ ? r->tensor_name_ : "", r->forward_,
+				(unsigned long long)r->start_, (unsigned long long)r->end_,
+				(unsigned long long)r->dma_wait_, (unsigned long long)r->bytes_in_,
+				(unsigned long long)r->bytes_out_);
+	}
+	fclose(fp);
+	return 0;
+}
+#endif
+
 int thinker_task_test(int argc, char *argv[])
 {
 	if (argc < 3) {
@@ -70,7 +128,11 @@ int thinker_task_test(int argc, char *argv[])
     // Load model file
     int8_t *model_data = NULL;
     uint64_t model_size = 0;
+#if defined(__linux__)
+    if (map_binary_file(argv[1], &model_data, &model_size) != 0) {
+#else
     if (load_binary_file(argv[1], &model_data, &model_size) != 0) {
+#endif
         printf("Failed to load model file\n");
         return -1;
     }
@@ -81,7 +143,11 @@ int thinker_task_test(int argc, char *argv[])
 	// Get memory plan
 	int num_memory = 0;
 	tMemory memory_list[7];
+#if defined(__linux__)
+	THINKER_CHECK(tGetMemoryPlanMapped((tMemory *)memory_list, &num_memory, (int8_t*)model_data, model_size), "tGetMemoryPlanMapped");
+#else
 	THINKER_CHECK(tGetMemoryPlan((tMemory *)memory_list, &num_memory, (int8_t*)model_data, model_size), "tGetMemoryPlan");
+#endif
 
 
 	// Allocate memory
@@ -115,7 +181,11 @@ int thinker_task_test(int argc, char *argv[])
 
 	// Initialize model
     tModelHandle model_hdl;   //typedef uint64_t
+#if defined(__linux__)
+	THINKER_CHECK(tModelInitMapped(&model_hdl, (int8_t*)model_data, model_size, memory_list, num_memory), "tModelInitMapped");
+#else
 	THINKER_CHECK(tModelInit(&model_hdl, (int8_t*)model_data, model_size, memory_list, num_memory), "tModelInit");
+#endif
 
 	// Create executor
     tExecHandle hdl;
@@ -142,6 +212,50 @@ int thinker_task_test(int argc, char *argv[])
 
 	THINKER_CHECK(tForward(hdl), "tForward");
 
+#if THINKER_PROFILE
+	{
+		static tProfileRecord records[256];
+		int32_t num_record = 256;
+		THINKER_CHECK(tGetProfile(hdl, records, &num_record), "tGetProfile");
+		printf("%4s | %-24s | %10s | %10s | %10s | %10s\n", "op", "name", "ticks", "dma wait", "bytes in", "bytes out");
+		for (i = 0; i < num_record; i++) {
+			tProfileRecord *r = records + i;
+			printf("%4d | %-24s | %10llu | %10llu | %10llu | %10llu\n", r->op_index_, r->name_,
+				   (unsigned long long)(r->end_ - r->start_), (unsigned long long)r->dma_wait_,
+				   (unsigned long long)r->bytes_in_, (unsigned long long)r->bytes_out_);
+		}
+		save_profile_file("thinker_profile.csv", records, num_record);
+	}
+	{
+		static tDMARecord dma_records[320];
+		int32_t num_dma = 320;
+		float overlap = 0.0f;
+		THINKER_CHECK(tGetDMAProfile(hdl, dma_records, &num_dma, &overlap), "tGetDMAProfile");
+		printf("%4s | %6s | %6s | %10s | %10s | %10s\n", "dma", "tensor", "count", "bytes", "busy", "wait");
+		for (i = 0; i < num_dma; i++) {
+			tDMARecord *r = dma_records + i;
+			printf("%4d | %6d | %6u | %10llu | %10llu | %10llu\n", i, r->tensor_id_, r->count_,
+				   (unsigned long long)r->bytes_, (unsigned long long)r->busy_,
+				   (unsigned long long)r->wait_);
+		}
+		printf("dma overlap efficiency: %.3f\n", overlap);
+	}
+#endif
+#if THINKER_STATS
+	{
+		tStats stats;
+		THINKER_CHECK(tGetStats(hdl, &stats, NULL, NULL), "tGetStats");
+		printf("stats: forward %llu, op %llu, read %llu (psram %llu), written %llu (psram %llu)\n",
+			   (unsigned long long)stats.forward_, (unsigned long long)stats.op_count_,
+			   (unsigned long long)stats.bytes_read_, (unsigned long long)stats.mem_read_[1],
+			   (unsigned long long)stats.bytes_written_, (unsigned long long)stats.mem_written_[1]);
+		printf("stats: io %llu/%llu B, memcpy %llu/%llu B, dma %llu/%llu B\n",
+			   (unsigned long long)stats.io_count_, (unsigned long long)stats.io_bytes_,
+			   (unsigned long long)stats.memcpy_count_, (unsigned long long)stats.memcpy_bytes_,
+			   (unsigned long long)stats.dma_count_, (unsigned long long)stats.dma_bytes_);
+	}
+#endif
+
 	tData output;
 	int output_count = tGetOutputCount(model_hdl);
 	if (argc - 2 - input_count >= output_count)
@@ -157,7 +271,14 @@ int thinker_task_test(int argc, char *argv[])
 		}
 	}
 
+	THINKER_CHECK(tReleaseExecutor(hdl), "tReleaseExecutor");
+	THINKER_CHECK(tModelFini(model_hdl), "tModelFini");
 	tUninitialize();
+#if defined(__linux__)
+	munmap(model_data, model_size);
+#else
+	free(model_data);
+#endif
     return 0;
 }
 
@@ -0,0 +1,418 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "thinker/thinker.h"
+#include "thinker/thinker_status.h"
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+#define BENCH_MAX_MEMORY    64
+#define BENCH_MAX_AXIS      16
+#define BENCH_MAX_INPUT     16
+
+#define THINKER_CHECK(func_call, func_name) \
+    do { \
+        tStatus check_ret = func_call; \
+        if (check_ret != T_SUCCESS) { \
+            fprintf(stderr, "Failed to %s: ret = %d\n", func_name, check_ret); \
+            return -1; \
+        } \
+    } while (0)
+
+// Latency samples of one api, nanoseconds
+typedef struct _bench_samples_ {
+    const char *name_;
+    double *ns_;
+    int32_t count_;
+    int32_t status_;        // first failing status, T_SUCCESS if every call passed
+} tBenchSamples;
+
+enum {
+    BENCH_MODEL_INIT = 0,
+    BENCH_CREATE_EXECUTOR,
+    BENCH_SET_INPUT,
+    BENCH_UPDATE_SHAPE,
+    BENCH_FORWARD,
+    BENCH_API_NUM
+};
+
+static const char *g_mem_type_name[5] = {"model", "executor", "parameter", "runtime", "shape_infer"};
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec tv;
+#ifdef WIN32
+    timespec_get(&tv, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+#endif
+    return (uint64_t)tv.tv_sec * 1000000000ull + (uint64_t)tv.tv_nsec;
+}
+
+static int32_t load_binary_file(const char *file, int8_t **ptr, uint64_t *size)
+{
+    FILE *fp = fopen(file, "rb");
+    if (!fp) {
+        fprintf(stderr, "Failed to open file: %s\n", file);
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    *ptr = (int8_t *)malloc(*size);
+    if (!*ptr) {
+        fprintf(stderr, "Memory allocation failed for file: %s\n", file);
+        fclose(fp);
+        return -1;
+    }
+    if (fread(*ptr, *size, 1, fp) != 1 && *size != 0) {
+        fprintf(stderr, "Failed to read file: %s\n", file);
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+    return 0;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted samples
+static double percentile(const double *sorted, int32_t count, int32_t p)
+{
+    int32_t rank = (int32_t)((p * (int64_t)count + 99) / 100);
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static void record(tBenchSamples *s, uint64_t start, tStatus ret, int32_t measured)
+{
+    uint64_t end = bench_now_ns();
+    if (ret != T_SUCCESS && s->status_ == T_SUCCESS) {
+        s->status_ = ret;
+    }
+    if (measured) {
+        s->ns_[s->count_++] = (double)(end - start);
+    }
+}
+
+static void print_usage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s <model_file> [options] [<input_files> ...]\n"
+            "  -w <num>          warmup iterations, default 5\n"
+            "  -n <num>          measured iterations, default 50\n"
+            "  -d <axis:value>   dynamic axis passed to tUpdateShape, repeatable\n"
+            "  -o <json_file>    write the report to a file instead of stdout\n"
+            "inputs without a file are filled with pseudo-random bytes\n",
+            name);
+}
+
+static void write_string(FILE *fp, const char *str)
+{
+    fputc('"', fp);
+    for (; *str; str++) {
+        unsigned char c = (unsigned char)*str;
+        if (c == '"' || c == '\\') {
+            fprintf(fp, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(fp, "\\u%04x", c);
+        } else {
+            fputc(c, fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+static void write_latency(FILE *fp, tBenchSamples *s, int32_t last)
+{
+    fprintf(fp, "    \"%s\": ", s->name_);
+    if (s->status_ != T_SUCCESS || s->count_ == 0) {
+        fprintf(fp, "{\"status\": %d}%s\n", s->status_, last ? "" : ",");
+        return;
+    }
+    double sum = 0;
+    for (int32_t i = 0; i < s->count_; i++) {
+        sum += s->ns_[i];
+    }
+    qsort(s->ns_, s->count_, sizeof(double), compare_double);
+    fprintf(fp, "{\"count\": %d, \"mean\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f}%s\n",
+            s->count_, sum / s->count_ / 1000.0, percentile(s->ns_, s->count_, 50) / 1000.0,
+            percentile(s->ns_, s->count_, 90) / 1000.0, percentile(s->ns_, s->count_, 99) / 1000.0,
+            s->ns_[s->count_ - 1] / 1000.0, last ? "" : ",");
+}
+
+int thinker_bench(int argc, char *argv[])
+{
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return -1;
+    }
+    int32_t i, j;
+    int32_t warmup = 5, iterations = 50;
+    int32_t num_axis = 0, num_file = 0;
+    const char *axis_names[BENCH_MAX_AXIS];
+    uint32_t axis_sizes[BENCH_MAX_AXIS];
+    const char *input_files[BENCH_MAX_INPUT];
+    const char *json_file = NULL;
+
+    for (i = 2; i < argc; i++) {
+        if (argv[i][0] == '-' && argv[i][1] != '\0' && argv[i][2] == '\0' && i + 1 < argc) {
+            char opt = argv[i][1];
+            char *value = argv[++i];
+            if (opt == 'w') {
+                warmup = atoi(value);
+            } else if (opt == 'n') {
+                iterations = atoi(value);
+            } else if (opt == 'o') {
+                json_file = value;
+            } else if (opt == 'd' && num_axis < BENCH_MAX_AXIS) {
+                char *colon = strchr(value, ':');
+                if (colon == NULL) {
+                    fprintf(stderr, "Invalid dynamic_axis format: %s\n", value);
+                    return -1;
+                }
+                *colon = '\0';
+                axis_names[num_axis] = value;
+                axis_sizes[num_axis] = (uint32_t)atoi(colon + 1);
+                num_axis++;
+            } else {
+                print_usage(argv[0]);
+                return -1;
+            }
+        } else if (num_file < BENCH_MAX_INPUT) {
+            input_files[num_file++] = argv[i];
+        }
+    }
+    if (warmup < 0 || iterations < 1) {
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    // Load model file
+    int8_t *model_data = NULL;
+    uint64_t model_size = 0;
+    if (load_binary_file(argv[1], &model_data, &model_size) != 0) {
+        fprintf(stderr, "Failed to load model file\n");
+        return -1;
+    }
+
+    THINKER_CHECK(tInitialize(), "tInitialize");
+
+    int32_t num_memory = 0;
+    tMemory memory_list[BENCH_MAX_MEMORY];
+    THINKER_CHECK(tGetMemoryPlan(memory_list, &num_memory, model_data, model_size), "tGetMemoryPlan");
+
+    // Every memory the plan leaves to the caller gets its own 64-byte aligned block
+    void *memory_blocks[BENCH_MAX_MEMORY] = {0};
+    for (i = 0; i < num_memory; i++) {
+        if (memory_list[i].dptr_ == 0) {
+            memory_blocks[i] = calloc(1, memory_list[i].size_ + 63);
+            if (memory_blocks[i] == NULL) {
+                fprintf(stderr, "Memory allocation failed for memory %d\n", i);
+                return -1;
+            }
+            memory_list[i].dptr_ = ((uint64_t)(size_t)memory_blocks[i] + 63) & ~(uint64_t)63;
+        }
+    }
+
+    tBenchSamples samples[BENCH_API_NUM] = {
+        {"tModelInit", NULL, 0, T_SUCCESS},
+        {"tCreateExecutor", NULL, 0, T_SUCCESS},
+        {"tSetInput", NULL, 0, T_SUCCESS},
+        {"tUpdateShape", NULL, 0, T_SUCCESS},
+        {"tForward", NULL, 0, T_SUCCESS},
+    };
+    for (i = 0; i < BENCH_API_NUM; i++) {
+        samples[i].ns_ = (double *)malloc(iterations * sizeof(double));
+        if (samples[i].ns_ == NULL) {
+            return -1;
+        }
+    }
+
+    // Load and release the model repeatedly, the last executor stays for the forward loop
+    tModelHandle model_hdl = 0;
+    tExecHandle hdl = 0;
+    uint64_t start;
+    tStatus ret;
+    for (i = 0; i < warmup + iterations; i++) {
+        int32_t measured = (i >= warmup);
+        int32_t last = (i == warmup + iterations - 1);
+        start = bench_now_ns();
+        ret = tModelInit(&model_hdl, model_data, model_size, memory_list, num_memory);
+        record(&samples[BENCH_MODEL_INIT], start, ret, measured);
+        THINKER_CHECK(ret, "tModelInit");
+
+        start = bench_now_ns();
+        ret = tCreateExecutor(model_hdl, &hdl, memory_list, num_memory);
+        record(&samples[BENCH_CREATE_EXECUTOR], start, ret, measured);
+        THINKER_CHECK(ret, "tCreateExecutor");
+
+        if (!last) {
+            THINKER_CHECK(tReleaseExecutor(hdl), "tReleaseExecutor");
+            THINKER_CHECK(tModelFini(model_hdl), "tModelFini");
+        }
+    }
+
+    // Inputs, files first and pseudo-random bytes for the rest
+    uint32_t input_count = tGetInputCount(model_hdl);
+    if (input_count > BENCH_MAX_INPUT || (uint32_t)num_file > input_count) {
+        fprintf(stderr, "num of input file is not correct\n");
+        return -1;
+    }
+    tData inputs[BENCH_MAX_INPUT];
+    for (i = 0; i < (int32_t)input_count; i++) {
+        THINKER_CHECK(tGetInputInfo(hdl, i, &inputs[i]), "tGetInputInfo");
+        uint64_t size = (inputs[i].dtype_ & 0xF);
+        for (j = 0; j < (int32_t)inputs[i].shape_.ndim_; j++) {
+            size *= inputs[i].shape_.dims_[j];
+        }
+        int8_t *data = NULL;
+        if (i < num_file) {
+            uint64_t file_size = 0;
+            if (load_binary_file(input_files[i], &data, &file_size) != 0) {
+                return -1;
+            }
+        } else {
+            data = (int8_t *)malloc(size ? size : 1);
+            if (data == NULL) {
+                return -1;
+            }
+            uint32_t seed = 0x2545F491u + i;
+            for (uint64_t k = 0; k < size; k++) {
+                seed = seed * 1664525u + 1013904223u;
+                data[k] = (int8_t)(seed >> 24);
+            }
+        }
+        inputs[i].dptr_ = data;
+    }
+
+    // tUpdateShape takes the -d axes before the inputs, without them it re-infers from the inputs
+    int32_t use_update = 1;
+    for (i = 0; i < warmup + iterations; i++) {
+        int32_t measured = (i >= warmup);
+        if (i == warmup) {
+#if THINKER_STATS
+            tResetStats(hdl);
+#endif
+        }
+        if (num_axis > 0) {
+            start = bench_now_ns();
+            ret = tUpdateShape(hdl, axis_names, axis_sizes, num_axis);
+            record(&samples[BENCH_UPDATE_SHAPE], start, ret, measured);
+            THINKER_CHECK(ret, "tUpdateShape");
+        }
+
+        start = bench_now_ns();
+        ret = T_SUCCESS;
+        for (j = 0; j < (int32_t)input_count && ret == T_SUCCESS; j++) {
+            ret = tSetInput(hdl, j, &inputs[j]);
+        }
+        record(&samples[BENCH_SET_INPUT], start, ret, measured);
+        THINKER_CHECK(ret, "tSetInput");
+
+        if (num_axis == 0 && use_update) {
+            start = bench_now_ns();
+            ret = tUpdateShape(hdl, NULL, NULL, 0);
+            record(&samples[BENCH_UPDATE_SHAPE], start, ret, measured);
+            // a static model has nothing to re-infer, report the status instead of latencies
+            use_update = (ret == T_SUCCESS);
+        }
+
+        start = bench_now_ns();
+        ret = tForward(hdl);
+        record(&samples[BENCH_FORWARD], start, ret, measured);
+        THINKER_CHECK(ret, "tForward");
+    }
+
+    FILE *fp = stdout;
+    if (json_file != NULL) {
+        fp = fopen(json_file, "w");
+        if (!fp) {
+            fprintf(stderr, "Failed to open file: %s\n", json_file);
+            return -1;
+        }
+    }
+
+    fprintf(fp, "{\n  \"model\": ");
+    write_string(fp, argv[1]);
+    fprintf(fp, ",\n  \"model_size\": %llu,\n", (unsigned long long)model_size);
+    fprintf(fp, "  \"warmup\": %d,\n  \"iterations\": %d,\n", warmup, iterations);
+    fprintf(fp, "  \"latency_us\": {\n");
+    for (i = 0; i < BENCH_API_NUM; i++) {
+        write_latency(fp, &samples[i], i == BENCH_API_NUM - 1);
+    }
+    fprintf(fp, "  },\n");
+
+    // Planned size of every memory, runtime memories also report the peak tGetMemoryPeak measured
+    uint64_t type_size[5] = {0}, type_peak[5] = {0};
+    fprintf(fp, "  \"memory\": [\n");
+    for (i = 0; i < num_memory; i++) {
+        uint64_t peak = memory_list[i].size_;
+        if (memory_list[i].mem_type_ == 3) {
+            tGetMemoryPeak(hdl, memory_list[i].dev_type_, &peak);
+        }
+        if (memory_list[i].mem_type_ < 5) {
+            type_size[memory_list[i].mem_type_] += memory_list[i].size_;
+            type_peak[memory_list[i].mem_type_] += peak;
+        }
+        fprintf(fp, "    {\"index\": %d, \"mem_type\": %d, \"dev_type\": %d, \"size\": %u, \"peak\": %llu}%s\n", i,
+                memory_list[i].mem_type_, memory_list[i].dev_type_, memory_list[i].size_,
+                (unsigned long long)peak, (i == num_memory - 1) ? "" : ",");
+    }
+    fprintf(fp, "  ],\n  \"memory_by_type\": {\n");
+    for (i = 0; i < 5; i++) {
+        fprintf(fp, "    \"%s\": {\"mem_type\": %d, \"size\": %llu, \"peak\": %llu}%s\n", g_mem_type_name[i], i,
+                (unsigned long long)type_size[i], (unsigned long long)type_peak[i], (i == 4) ? "" : ",");
+    }
+    fprintf(fp, "  }");
+#if THINKER_STATS
+    {
+        tStats stats;
+        if (tGetStats(hdl, &stats, NULL, NULL) == T_SUCCESS) {
+            fprintf(fp, ",\n  \"stats\": {\"forward\": %llu, \"op\": %llu, \"bytes_read\": %llu, \"bytes_written\": %llu, "
+                        "\"memcpy_bytes\": %llu, \"dma_bytes\": %llu}",
+                    (unsigned long long)stats.forward_, (unsigned long long)stats.op_count_,
+                    (unsigned long long)stats.bytes_read_, (unsigned long long)stats.bytes_written_,
+                    (unsigned long long)stats.memcpy_bytes_, (unsigned long long)stats.dma_bytes_);
+        }
+    }
+#endif
+#if defined(__linux__)
+    {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        fprintf(fp, ",\n  \"max_rss_kb\": %ld", usage.ru_maxrss);
+    }
+#endif
+    fprintf(fp, "\n}\n");
+    if (fp != stdout) {
+        fclose(fp);
+    }
+
+    tReleaseExecutor(hdl);
+    tModelFini(model_hdl);
+    tUninitialize();
+    for (i = 0; i < (int32_t)input_count; i++) {
+        free(inputs[i].dptr_);
+    }
+    for (i = 0; i < BENCH_API_NUM; i++) {
+        free(samples[i].ns_);
+    }
+    for (i = 0; i < num_memory; i++) {
+        free(memory_blocks[i]);
+    }
+    free(model_data);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    return thinker_bench(argc, argv) == 0 ? 0 : 1;
+}
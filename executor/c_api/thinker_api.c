@@ -23,12 +23,76 @@
 #include "luna/luna_mtq_math.h"
 #endif
 
+#if defined(linux)
+#include <pthread.h>
+#include "core/comm/worker_pool.h"
+#endif
+
+#if THINKER_USE_SCHEDULER && defined(linux)
+#include "core/comm/op_scheduler.h"
+#define THINKER_SCHED_ENABLE 1
+#endif
+
+// Runtime re-planning moves tensors after the scheduler derived its
+// dependencies from the static offsets, so the two are exclusive
+#if THINKER_MEMORY_REPLAN && !THINKER_SCHED_ENABLE
+#define THINKER_REPLAN_ENABLE 1
+#endif
+
+// Operator records kept by THINKER_PROFILE, older ones are overwritten
+#ifndef THINKER_PROFILE_RECORDS
+#define THINKER_PROFILE_RECORDS 256
+#endif
+
 #ifndef NULL
 #define NULL 0
 #endif
 
 #define THINKER_INST_FLAG 0x20201201
 
+// Samples run together by tForwardBatch, each one keeps a copy of the
+// runtime memory inside the executor instance memory. Executors only pay
+// for the copies when a build raises it above 1.
+#ifndef THINKER_BATCH_MAX
+#define THINKER_BATCH_MAX 1
+#endif
+
+// Precompiled execution plan entry, one per operator.
+// Built once in tCreateExecutor so the forward loops do not have to decode
+// op_buffer_ and rebuild the tensor pointer array on every call.
+typedef struct _t_OpPlan_ {
+  int32_t (*forward_)(tOperator *op, tTensor **tensors, int32_t num_tensor,
+                      tDMA_List *list);
+  tOperator *op_;
+  void *attrs_;
+  tTensor **tensors_;   // slice of pre-resolved tensors (inputs, outputs, temps)
+  int32_t num_tensor_;
+  tOperatorAPI *api_;
+} tOpPlan;
+
+// Caller buffer bound to an input or output tensor by tBindInput/tBindOutput.
+typedef struct _t_IOBind_ {
+  addr_type bind_ptr_;  // caller buffer, 0 if not bound
+  addr_type plan_ptr_;  // address assigned by the memory planner
+  uint32_t copy_;       // tensor lives in share memory, copy instead of alias
+} tIOBind;
+
+#if defined(linux)
+// State of the asynchronous forward started by tForwardAsync
+typedef struct _t_AsyncCtx_ {
+  pthread_mutex_t lock_;
+  pthread_cond_t done_cond_;
+  int32_t busy_;
+  int32_t in_callback_;   // completion callbacks running, chained ones may overlap
+  tStatus status_;
+  tForwardCallback callback_;
+  void *user_;
+} tAsyncCtx;
+
+// Context whose completion callback runs on this thread
+static __thread tAsyncCtx *t_callback_ctx = NULL;
+#endif
+
 // Model structure definition
 typedef struct _t_Model_ {
   uint32_t flag_;
@@ -59,9 +123,26 @@ typedef struct _t_Model_ {
   tDebugList *debug_info;
   tDMAList *dma_info_;
   tDMA *dma_;
+#if THINKER_SCHED_ENABLE
+  tSchedGraph sched_;  // operator dependencies, runtime parts are per executor
+#endif
 } tModel;
 
 // Execution instance structure definition
+#if THINKER_REPLAN_ENABLE
+// Tensors of one runtime arena sharing static offset and liveness
+typedef struct _t_ReplanGroup_ {
+  uint64_t offset_;     // offset in the static plan
+  uint64_t size_;       // bytes needed by the current shapes
+  uint64_t max_size_;   // bytes needed by the maximum shapes
+  uint64_t place_;      // offset in the new plan
+  uint32_t life_;       // liveness of the tensors, see tTensor
+  int32_t rank_;        // 0: state, 1: graph input, 2: others
+  int32_t id_;          // tensor while grouping, group before sorting afterwards
+  int32_t input_;       // graph input index, -1 if none
+} tReplanGroup;
+#endif
+
 typedef struct _t_Instance_ {
   uint32_t flag_;
 
@@ -69,12 +150,295 @@ typedef struct _t_Instance_ {
   tTensor *tensor_;
   tMemory *memory_;
   tModel *model_;
-  double *shape_scalars_;
+  tScalarReg *shape_scalars_;
+  tShapeCache shape_cache_;  // dims of recent tUpdateShape inputs
   tDMA_List *dma_list_;
+  tOpPlan *op_plan_;
+  tIOBind *io_bind_;
+  int8_t *batch_buf_;     // THINKER_BATCH_MAX runtime memory copies for tForwardBatch
+  uint32_t batch_stride_; // size of one runtime memory copy
+  uint32_t state_ready_;  // state outputs of last tForward are valid
   uint32_t force_stop_flag;
+#if defined(linux)
+  tAsyncCtx async_;
+#endif
+#if THINKER_SCHED_ENABLE
+  tSchedGraph sched_;
+#endif
+#if THINKER_REPLAN_ENABLE
+  uint64_t *mem_peak_;        // peak of each memory under the current plan
+  tReplanGroup *replan_;      // scratch of replanMemory, one entry per tensor
+  int32_t *replan_index_;     // scratch of replanMemory, two entries per tensor
+  uint32_t replan_stamp_;     // shape cache stamp the current plan was made for
+#endif
+#if THINKER_PROFILE
+  tProfileRecord *profile_;   // ring of THINKER_PROFILE_RECORDS records
+  uint32_t profile_count_;    // records written since tResetProfile
+  uint32_t profile_forward_;  // forwards since tResetProfile
+#endif
+#if THINKER_STATS
+  tStats stats_;              // counters since tResetStats
+  uint32_t *stats_ops_;       // invocations of each operator since tResetStats
+#endif
   int32_t reserved_args[8];
 } tExecInst;
 
+/**
+ * Count tensor references of all operators in op buffer
+ * @param op_buffer Pointer to serialized operators
+ * @param num_op Number of operators
+ * @return Total number of tensor references
+ */
+static uint32_t getOpTensorCount(const uint8_t *op_buffer, const int32_t num_op) {
+  uint32_t count = 0;
+  const uint8_t *p_op = op_buffer;
+  for (int32_t i = 0; i < num_op; i++) {
+    const tOperator *op = (const tOperator *)p_op;
+    count += op->num_input_ + op->num_output_ + op->num_temp_;
+    p_op += op->total_size_;
+  }
+  return count;
+}
+
+/**
+ * Calculate memory size of execution plan
+ * @param num_op Number of operators
+ * @param num_tensor_ref Total number of tensor references
+ * @return Size in bytes
+ */
+static int32_t getExecPlanSize(const int32_t num_op, const uint32_t num_tensor_ref) {
+  return ALIGN16(num_op * sizeof(tOpPlan)) +
+         ALIGN16(num_tensor_ref * sizeof(tTensor *));
+}
+
+/**
+ * Calculate size of the runtime memory copy kept per sample by tForwardBatch
+ * @param memory Memory list of the model
+ * @param start Index of the first runtime memory
+ * @param end Number of memories
+ * @return Size in bytes, 0 if batching is disabled
+ */
+static uint32_t getBatchStride(const tMemory *memory, const int32_t start, const int32_t end) {
+  uint32_t stride = 0;
+#if THINKER_BATCH_MAX > 1
+  for (int32_t i = start; i < end; i++) {
+    stride += ALIGN16(memory[i].size_);
+  }
+#endif
+  return stride;
+}
+
+/**
+ * Calculate size of the scratch used to re-plan runtime memory
+ * @param num_tensor Number of tensors
+ * @param num_memory Number of memories
+ * @return Size in bytes, 0 if re-planning is disabled
+ */
+static int32_t getReplanSize(const int32_t num_tensor, const int32_t num_memory) {
+  int32_t size = 0;
+#if THINKER_REPLAN_ENABLE
+  size += ALIGN16(num_memory * sizeof(uint64_t));
+  size += ALIGN16(num_tensor * sizeof(tReplanGroup));
+  size += ALIGN16(2 * num_tensor * sizeof(int32_t));
+#endif
+  return size;
+}
+
+/**
+ * Calculate size of the profile ring
+ * @return Size in bytes, 0 if profiling is disabled
+ */
+static int32_t getProfileSize(void) {
+#if THINKER_PROFILE
+  return ALIGN16(THINKER_PROFILE_RECORDS * sizeof(tProfileRecord));
+#else
+  return 0;
+#endif
+}
+
+/**
+ * Calculate size of the per-operator invocation counters
+ * @param num_op Number of operators
+ * @return Size in bytes, 0 if the counters are compiled out
+ */
+static int32_t getStatsSize(const int32_t num_op) {
+#if THINKER_STATS
+  return ALIGN16(num_op * sizeof(uint32_t));
+#else
+  return 0;
+#endif
+}
+
+#if THINKER_SCHED_ENABLE
+/**
+ * Check whether two tensors share bytes of the same memory
+ * @param a First tensor
+ * @param b Second tensor
+ * @param cover Only report when a covers all bytes of b
+ * @return 1 if overlapped (or covered), otherwise 0
+ */
+static int32_t tensorOverlap(const tTensor *a, const tTensor *b, int32_t cover) {
+  if (a == b) {
+    return 1;
+  }
+  if (a->mem_id_ != b->mem_id_) {
+    return 0;
+  }
+  uint64_t a_end = a->offset_ + getTensorSize(a) * a->byte_;
+  uint64_t b_end = b->offset_ + getTensorSize(b) * b->byte_;
+  if (cover) {
+    return (a->offset_ <= b->offset_) && (a_end >= b_end);
+  }
+  return (a->offset_ < b_end) && (b->offset_ < a_end);
+}
+
+/**
+ * Check whether operator reads weights prefetched through the DMA list
+ * @param op Operator
+ * @param dma DMA entries
+ * @param num_dma Number of DMA entries
+ * @return 1 if any operator tensor is a DMA destination
+ */
+static int32_t opUsesDMA(const tOperator *op, const tDMA *dma, const int32_t num_dma) {
+  const uint32_t *ids = (const uint32_t *)((const uint8_t *)op + op->tensor_offset_);
+  int32_t num_tensor = op->num_input_ + op->num_output_ + op->num_temp_;
+  for (int32_t t = 0; t < num_tensor; t++) {
+    for (int32_t k = 0; k < num_dma; k++) {
+      if (ids[t] == dma[k].dst_tensor_id_) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+// Tensors of one operator tracked while walking scheduler dependencies
+#define SCHED_MAX_OP_TENSOR 512
+
+/**
+ * Walk dependencies between operators for the parallel scheduler
+ * Operator j depends on an earlier operator i when one of them writes memory
+ * the other one reads or writes, which keeps memory plan reuse safe. Earlier
+ * operators hidden behind a later writer covering the same bytes are reached
+ * transitively and skipped. Operators fetching weights through the DMA list
+ * are chained in order since getWeightData advances a shared cursor.
+ * @param op_buffer Serialized operators
+ * @param num_op Number of operators
+ * @param tensors Tensors with planned offsets
+ * @param dma DMA entries
+ * @param num_dma Number of DMA entries
+ * @param graph Graph to fill, unused in mode 0
+ * @param mode 0: count edges, 1: count per node, 2: fill successors, which
+ *             advances succ_offset_ of every node past its successors
+ * @return Number of edges, -1 if an operator has more than
+ *         SCHED_MAX_OP_TENSOR tensors
+ */
+static int32_t walkSchedEdges(const uint8_t *op_buffer, const int32_t num_op,
+                              const tTensor *tensors, const tDMA *dma,
+                              const int32_t num_dma, tSchedGraph *graph,
+                              const int32_t mode) {
+  int32_t num_edge = 0;
+  int32_t last_dma_op = -1;
+  int32_t stop[SCHED_MAX_OP_TENSOR];
+  const uint8_t *p_j = op_buffer;
+  for (int32_t j = 0; j < num_op; j++) {
+    const tOperator *op_j = (const tOperator *)p_j;
+    const uint32_t *ids_j = (const uint32_t *)(p_j + op_j->tensor_offset_);
+    int32_t num_j = op_j->num_input_ + op_j->num_output_ + op_j->num_temp_;
+    if (num_j > SCHED_MAX_OP_TENSOR) {
+      return -1;
+    }
+    int32_t uses_dma = opUsesDMA(op_j, dma, num_dma);
+
+    // latest earlier operator writing all bytes of each tensor of j
+    const uint8_t *p_i = op_buffer;
+    for (int32_t t = 0; t < num_j; t++) {
+      stop[t] = 0;
+    }
+    for (int32_t i = 0; i < j; i++) {
+      const tOperator *op_i = (const tOperator *)p_i;
+      const uint32_t *ids_i = (const uint32_t *)(p_i + op_i->tensor_offset_);
+      int32_t num_i = op_i->num_input_ + op_i->num_output_ + op_i->num_temp_;
+      for (int32_t u = op_i->num_input_; u < num_i; u++) {
+        for (int32_t t = 0; t < num_j; t++) {
+          if (tensorOverlap(tensors + ids_i[u], tensors + ids_j[t], 1)) {
+            stop[t] = i;
+          }
+        }
+      }
+      p_i += op_i->total_size_;
+    }
+
+    p_i = op_buffer;
+    for (int32_t i = 0; i < j; i++) {
+      const tOperator *op_i = (const tOperator *)p_i;
+      const uint32_t *ids_i = (const uint32_t *)(p_i + op_i->tensor_offset_);
+      int32_t num_i = op_i->num_input_ + op_i->num_output_ + op_i->num_temp_;
+      int32_t dep = uses_dma && (i == last_dma_op);
+      for (int32_t t = 0; t < num_j && !dep; t++) {
+        if (i < stop[t]) {
+          continue;
+        }
+        int32_t t_write = (t >= op_j->num_input_);
+        for (int32_t u = 0; u < num_i; u++) {
+          int32_t u_write = (u >= op_i->num_input_);
+          if ((t_write || u_write) &&
+              tensorOverlap(tensors + ids_i[u], tensors + ids_j[t], 0)) {
+            dep = 1;
+            break;
+          }
+        }
+      }
+      if (dep) {
+        if (mode == 1) {
+          graph->nodes_[i].num_succ_++;
+          graph->nodes_[j].num_pred_++;
+        } else if (mode == 2) {
+          graph->succ_[graph->nodes_[i].succ_offset_++] = j;
+        }
+        num_edge++;
+      }
+      p_i += op_i->total_size_;
+    }
+
+    if (uses_dma) {
+      last_dma_op = j;
+    }
+    p_j += op_j->total_size_;
+  }
+  return num_edge;
+}
+
+/**
+ * Build the operator dependency graph of a model once, executors share it
+ * @param model Model with operators, tensors and DMA entries loaded
+ * @param ptr Buffer for the graph
+ * @param size Bytes available at ptr
+ * @return Status code
+ */
+static tStatus buildSchedGraph(tModel *model, int8_t *ptr, const int64_t size) {
+  tSchedGraph *graph = &model->sched_;
+  if (sched_graph_size(model->num_operator_, 0) > size) {
+    return T_ERR_NO_WORKSPACE;
+  }
+  sched_graph_init(graph, ptr, model->num_operator_);
+  if (walkSchedEdges(model->op_buffer_, model->num_operator_, model->tensor_,
+                     model->dma_, model->dma_info_->count_, graph, 1) < 0) {
+    return T_ERR_INDEX_OF_BOUND;
+  }
+  sched_graph_link(graph);
+  if (sched_graph_size(model->num_operator_, graph->num_edge_) > size) {
+    return T_ERR_NO_WORKSPACE;
+  }
+  walkSchedEdges(model->op_buffer_, model->num_operator_, model->tensor_,
+                 model->dma_, model->dma_info_->count_, graph, 2);
+  for (int32_t i = 0; i < model->num_operator_; i++) {
+    graph->nodes_[i].succ_offset_ -= graph->nodes_[i].num_succ_;
+  }
+  return T_SUCCESS;
+}
+#endif  // THINKER_SCHED_ENABLE
+
 /**
  * Get version string based on index
  * @param index Version index (1 for Venus, otherwise Thinker)
@@ -98,19 +462,190 @@ tStatus tInitialize() {
  * @return Status code
  */
 tStatus tUninitialize() {
+#if defined(linux)
+  worker_pool_fini();
+#endif
 	return T_SUCCESS;
 }
 
+// Mapped loading skips the resource CRC unless requested, the checksum would
+// page in the whole file
+#ifndef THINKER_MAPPED_CRC
+#define THINKER_MAPPED_CRC 0
+#endif
+
+#ifdef THINKER_CHECK_CRC
+// The cache is shared by all threads and guarded by a pthread mutex, so it
+// is limited to linux; Windows hosts and RTOS device builds always verify
+#if THINKER_CRC_CACHE && defined(linux)
+#define THINKER_CRC_CACHE_ENABLE 1
+#endif
+
+#if THINKER_CRC_CACHE_ENABLE
+// Resources verified by tGetMemoryPlan and not yet consumed by tModelInit
+#ifndef THINKER_CRC_CACHE_SIZE
+#define THINKER_CRC_CACHE_SIZE 4
+#endif
+
+typedef struct _t_CRCCacheEntry_ {
+  const int8_t *res_;
+  uint64_t size_;
+  uint32_t crc_;      // crc stored in the header, a refilled buffer differs
+} tCRCCacheEntry;
+
+static tCRCCacheEntry g_crc_cache[THINKER_CRC_CACHE_SIZE];
+static uint32_t g_crc_cache_next = 0;
+static pthread_mutex_t g_crc_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define CRC_CACHE_LOCK() pthread_mutex_lock(&g_crc_cache_lock)
+#define CRC_CACHE_UNLOCK() pthread_mutex_unlock(&g_crc_cache_lock)
+
+/**
+ * Find a verified resource in the CRC cache
+ * @param res Pointer to model resource data
+ * @param size Size of model resource data
+ * @param crc CRC stored in the resource header
+ * @return Matching entry, NULL if not cached; call with the lock held
+ */
+static tCRCCacheEntry *findCRCCache(const int8_t *res, const uint64_t size,
+                                    const uint32_t crc) {
+  for (int32_t i = 0; i < THINKER_CRC_CACHE_SIZE; i++) {
+    tCRCCacheEntry *entry = g_crc_cache + i;
+    if (entry->res_ == res && entry->size_ == size && entry->crc_ == crc) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Take a verified resource out of the CRC cache
+ * @param res Pointer to model resource data
+ * @param size Size of model resource data
+ * @param crc CRC stored in the resource header
+ * @return 1 if the resource was verified by tGetMemoryPlan
+ */
+static int32_t takeCRCCache(const int8_t *res, const uint64_t size, const uint32_t crc) {
+  CRC_CACHE_LOCK();
+  tCRCCacheEntry *entry = findCRCCache(res, size, crc);
+  if (entry != NULL) {
+    entry->res_ = NULL;
+  }
+  CRC_CACHE_UNLOCK();
+  return entry != NULL;
+}
+
+/**
+ * Remember a verified resource, the oldest entry is replaced when full
+ * @param res Pointer to model resource data
+ * @param size Size of model resource data
+ * @param crc CRC stored in the resource header
+ */
+static void insertCRCCache(const int8_t *res, const uint64_t size, const uint32_t crc) {
+  CRC_CACHE_LOCK();
+  tCRCCacheEntry *entry = findCRCCache(res, size, crc);
+  if (entry == NULL) {
+    entry = g_crc_cache + g_crc_cache_next;
+    g_crc_cache_next = (g_crc_cache_next + 1) % THINKER_CRC_CACHE_SIZE;
+  }
+  entry->res_ = res;
+  entry->size_ = size;
+  entry->crc_ = crc;
+  CRC_CACHE_UNLOCK();
+}
+#endif
+
+/**
+ * Verify the CRC of a model resource
+ * With THINKER_CRC_CACHE on linux the resources checked by tGetMemoryPlan are
+ * remembered by address, size and header CRC, so the tModelInit that follows
+ * does not checksum the same bytes again. A buffer refilled with another
+ * model carries another header CRC and is verified again.
+ * @param res Pointer to model resource data
+ * @param size Size of model resource data
+ * @param remember Keep the verified resource for the next call
+ * @return Status code
+ */
+static tStatus checkResourceCRC(const int8_t *res, const uint64_t size,
+                                int32_t remember) {
+  tModelHeader *res_hdr = (tModelHeader *)res;
+  if (res_hdr->crc32_ == 0) {
+    return T_SUCCESS;
+  }
+#if THINKER_CRC_CACHE_ENABLE
+  if (!remember && takeCRCCache(res, size, res_hdr->crc32_)) {
+    return T_SUCCESS;
+  }
+#endif
+
+  uint8_t *res_model_ptr = (uint8_t *)res + ALIGN16(sizeof(tModelHeader));
+  int32_t res_model_size = size - ALIGN16(sizeof(tModelHeader));
+  int32_t crc_check = crc24_calc(0, res_model_ptr, res_model_size);
+  if (res_hdr->crc32_ != crc_check) {
+    printf("%d,%d", res_hdr->crc32_, crc_check);
+    return T_ERR_RES_CRC_CHECK;
+  }
+
+#if THINKER_CRC_CACHE_ENABLE
+  if (remember) {
+    insertCRCCache(res, size, res_hdr->crc32_);
+  }
+#else
+  (void)remember;
+#endif
+  return T_SUCCESS;
+}
+#endif
+
+/**
+ * Calculate the size of the model instance memory
+ * Tables referenced in place by a mapped resource take no room.
+ * @param res Pointer to model resource data
+ * @param mapped Size for tModelInitMapped
+ * @return Size in bytes, without the scheduler graph
+ */
+static int32_t getModelSize(const int8_t *res, const int32_t mapped) {
+  tModelHeader *res_hdr = (tModelHeader *)res;
+  tMemoryList mem_hdr = *(tMemoryList *)(res + res_hdr->memory_offset_);
+  tTensorList tensor_hdr = *(tTensorList *)(res + res_hdr->tensor_offset_);
+  tIOHeader io_hdr = *(tIOHeader *)(res + res_hdr->io_offset_);
+  tOperatorList op_hdr = *(tOperatorList *)(res + res_hdr->op_offset_);
+  tDMAList dma_hdr = *(tDMAList *)(res + res_hdr->dma_offset_);
+
+  int32_t size = 0;
+  size += ALIGN16(sizeof(tModel));
+  size += ALIGN16(mem_hdr.total_count_ * sizeof(tMemory));
+  if (!mapped) {
+    size += ALIGN16(tensor_hdr.count_ * sizeof(tTensor));
+    size += ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * sizeof(int32_t));
+    size += ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * io_hdr.name_length_);
+  }
+  size += ALIGN16(io_hdr.num_input_ * sizeof(tShape));
+  size += ALIGN16(io_hdr.num_state_ * sizeof(tState));
+  size += ALIGN16(op_hdr.type_count_ * sizeof(tOperatorAPI));
+  if (!mapped) {
+    size += ALIGN16(op_hdr.op_size_);
+  }
+  size += ALIGN16(sizeof(tShapeInfer));
+  size += ALIGN16(sizeof(tDebugList));
+  size += ALIGN16(sizeof(tDMAList));
+  if (!mapped) {
+    size += ALIGN16(dma_hdr.count_ * sizeof(tDMA));
+  }
+  return size;
+}
+
 /**
  * Calculate memory requirements for model execution
  * @param memory_list Output array of memory requirements
  * @param num_memory Pointer to store number of memory entries
  * @param res Pointer to model resource data
  * @param size Size of model resource data
+ * @param mapped Plan for tModelInitMapped
  * @return Status code
  */
-tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
-                       const int8_t *res, const uint64_t size) {
+static tStatus getMemoryPlan(tMemory *memory_list, int32_t *num_memory,
+                             const int8_t *res, const uint64_t size,
+                             const int32_t mapped) {
   tModelHeader *res_hdr = (tModelHeader *)res;
 
   if (res_hdr->total_size_ > size) {
@@ -119,15 +654,12 @@ tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
 
   // check CRC
 #ifdef THINKER_CHECK_CRC
- if (res_hdr->crc32_ != 0) {
-   uint8_t *res_model_ptr = (uint8_t *)res + ALIGN16(sizeof(tModelHeader));
-   int32_t res_model_size = size - ALIGN16(sizeof(tModelHeader));
-   int32_t crc_check = crc24_calc(0, res_model_ptr, res_model_size);
-   if (res_hdr->crc32_ != crc_check) {
-     printf("%d,%d", res_hdr->crc32_, crc_check);
-     return T_ERR_RES_CRC_CHECK;
-   }
- }
+  if (!mapped || THINKER_MAPPED_CRC) {
+    tStatus crc_ret = checkResourceCRC(res, size, 1);
+    if (crc_ret != T_SUCCESS) {
+      return crc_ret;
+    }
+  }
 #endif
 
 #if THINKER_CHECK_PLATFORM
@@ -159,28 +691,27 @@ tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
 #endif
 
   // Calculate model instance size
-  int32_t model_inst_size = 0;
-  model_inst_size += ALIGN16(sizeof(tModel));
+  int32_t model_inst_size = getModelSize(res, mapped);
 
   tMemoryList mem_hdr = *(tMemoryList *)(res + res_hdr->memory_offset_);
   tTensorList tensor_hdr = *(tTensorList *)(res + res_hdr->tensor_offset_);
   tIOHeader io_hdr = *(tIOHeader *)(res + res_hdr->io_offset_);
   tOperatorList op_hdr = *(tOperatorList *)(res + res_hdr->op_offset_);
   tParameterList param_hdr = *(tParameterList *)(res + res_hdr->param_offset_);
-  tDebugList debug_hdr = *(tDebugList *)(res + res_hdr->debug_offset_);
   tDMAList dma_hdr = *(tDMAList *)(res + res_hdr->dma_offset_);
-
-  model_inst_size += ALIGN16(mem_hdr.total_count_ * sizeof(tMemory));
-  model_inst_size += ALIGN16(tensor_hdr.count_ * sizeof(tTensor));
-  model_inst_size += ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * sizeof(int32_t));
-  model_inst_size += ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * io_hdr.name_length_);
-  model_inst_size += ALIGN16(io_hdr.num_input_ * sizeof(tShape));
-  model_inst_size += ALIGN16(op_hdr.type_count_ * sizeof(tOperatorAPI));
-  model_inst_size += ALIGN16(op_hdr.op_size_);
-  model_inst_size += ALIGN16(sizeof(tShapeInfer));
-  model_inst_size += ALIGN16(sizeof(tDebugList));
-  model_inst_size += ALIGN16(sizeof(tDMAList));
-  model_inst_size += ALIGN16(dma_hdr.count_ * sizeof(tDMA));
+#if THINKER_SCHED_ENABLE
+  int32_t num_edge;
+  {
+    const tTensor *tensors = (const tTensor *)(res + res_hdr->tensor_offset_ + tensor_hdr.offset_);
+    const tDMA *dma = (const tDMA *)(res + res_hdr->dma_offset_ + dma_hdr.offset_);
+    const uint8_t *ops = (const uint8_t *)res + res_hdr->op_offset_ + op_hdr.op_offset_;
+    num_edge = walkSchedEdges(ops, op_hdr.op_count_, tensors, dma, dma_hdr.count_, NULL, 0);
+    if (num_edge < 0) {
+      return T_ERR_INDEX_OF_BOUND;
+    }
+  }
+  model_inst_size += sched_graph_size(op_hdr.op_count_, num_edge);
+#endif
 
   // Add model instance memory
   int32_t num = 0;
@@ -220,7 +751,20 @@ tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
   inst_size += ALIGN16(mem_hdr.total_count_ * sizeof(tMemory));
   inst_size += ALIGN16(tensor_hdr.count_ * sizeof(tTensor));
 
-  inst_size += ALIGN16(scalar_graph->num_scalars_*sizeof(double)); 
+  inst_size += ALIGN16(scalar_graph->num_scalars_*sizeof(tScalarReg)); 
+  inst_size += tShapeCacheSize(scalar_graph->num_input_, shape_hdr->num_id_pair_);
+
+  const uint8_t *op_buffer = (const uint8_t *)res + res_hdr->op_offset_ + op_hdr.op_offset_;
+  inst_size += getExecPlanSize(op_hdr.op_count_, getOpTensorCount(op_buffer, op_hdr.op_count_));
+  inst_size += ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * sizeof(tIOBind));
+  inst_size += THINKER_BATCH_MAX * getBatchStride(shared_memory, mem_hdr.shared_count_,
+                                                  mem_hdr.total_count_);
+  inst_size += getReplanSize(tensor_hdr.count_, mem_hdr.total_count_);
+  inst_size += getProfileSize();
+  inst_size += getStatsSize(op_hdr.op_count_);
+#if THINKER_SCHED_ENABLE
+  inst_size += sched_state_size(op_hdr.op_count_);
+#endif
 
   inst_size += ALIGN16(sizeof(tDMA_List));
   tMemory inst_memory;
@@ -232,10 +776,7 @@ tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
   num += 1;
 
   // Calculate shape inference workspace size
-  uint64_t total_size    = ALIGN16(sizeof(tScalarGraph));
-  total_size             += ALIGN16(shape_hdr->graph_size_);
-  total_size             += ALIGN16(shape_hdr->num_id_pair_ * sizeof(tTenDimPair));
-  total_size             += ALIGN16(shape_hdr->num_dy_axis_ * sizeof(tDyAxisInfo));
+  uint64_t total_size    = tShapeInferSize(shape_hdr);
   tMemory tShapeInfer_memory = { total_size, 1, 4, 0};
   memory_list[num] = tShapeInfer_memory;
   num += 1;
@@ -244,20 +785,54 @@ tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
   return T_SUCCESS;
 }
 
+/**
+ * Calculate memory requirements for model execution
+ * @param memory_list Output array of memory requirements
+ * @param num_memory Pointer to store number of memory entries
+ * @param res Pointer to model resource data
+ * @param size Size of model resource data
+ * @return Status code
+ */
+tStatus tGetMemoryPlan(tMemory *memory_list, int32_t *num_memory,
+                       const int8_t *res, const uint64_t size) {
+  return getMemoryPlan(memory_list, num_memory, res, size, 0);
+}
+
+/**
+ * Calculate memory requirements for a model loaded by tModelInitMapped
+ * The model instance memory leaves out the tables referenced in place.
+ * @param memory_list Output array of memory requirements
+ * @param num_memory Pointer to store number of memory entries
+ * @param res Pointer to mapped model resource data
+ * @param size Size of model resource data
+ * @return Status code
+ */
+tStatus tGetMemoryPlanMapped(tMemory *memory_list, int32_t *num_memory,
+                             const int8_t *res, const uint64_t size) {
+  return getMemoryPlan(memory_list, num_memory, res, size, 1);
+}
+
 /**
  * Initialize model from resource data
+ * Tables that are never written after loading (tensors, io ids, io names,
+ * operators, dma entries) are referenced in the resource when mapped is set.
+ * The memory table and the shape inference program are always copied since
+ * memory addresses and scalar registers are filled in here; parameter tensor
+ * addresses are resolved per executor.
  * @param hdl Output handle to model
  * @param res Pointer to model resource data
  * @param size Size of model resource data
  * @param memory_list Array of memory allocations
  * @param num_memory Number of memory entries
+ * @param mapped Resource outlives the model and can be referenced in place
  * @return Status code
  */
 #if !(defined(WIN32) || defined(linux))
 #pragma clang optimize off
 #endif
-tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
-                   const tMemory *memory_list, const int32_t num_memory) {
+static tStatus modelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
+                         const tMemory *memory_list, const int32_t num_memory,
+                         int32_t mapped) {
   tModelHeader *res_hdr = (tModelHeader *)res;
   int8_t *cpu_memory = NULL;
   int32_t i, j;
@@ -268,48 +843,33 @@ tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
   if (res_hdr->total_size_ > size) {
     return T_ERR_RES_INCOMPLETE;
   }
-  // CRC check
+  // CRC check, a mapped resource is only paged in where it is read
 #ifdef THINKER_CHECK_CRC
-  if (res_hdr->crc32_ != 0) {
-    uint8_t *res_model_ptr = (uint8_t *)res + ALIGN16(sizeof(tModelHeader));
-    int32_t res_model_size = size - ALIGN16(sizeof(tModelHeader));
-    int32_t crc_check = crc24_calc(0, res_model_ptr, res_model_size);
-    if (res_hdr->crc32_ != crc_check) {
-      return T_ERR_RES_CRC_CHECK;
+  if (!mapped || THINKER_MAPPED_CRC) {
+    tStatus crc_ret = checkResourceCRC(res, size, 0);
+    if (crc_ret != T_SUCCESS) {
+      return crc_ret;
     }
   }
 #endif
 
-  int32_t inst_size = 0;
-  inst_size += ALIGN16(sizeof(tModel));
+  int32_t inst_size = getModelSize(res, mapped);
   tMemoryList mem_hdr = *(tMemoryList *)(res + res_hdr->memory_offset_);
   tTensorList tensor_hdr = *(tTensorList *)(res + res_hdr->tensor_offset_);
   tIOHeader io_hdr = *(tIOHeader *)(res + res_hdr->io_offset_);
   tOperatorList op_hdr = *(tOperatorList *)(res + res_hdr->op_offset_);
-  tParameterList param_hdr = *(tParameterList *)(res + res_hdr->param_offset_);
   tDebugList debug_hdr = *(tDebugList *)(res + res_hdr->debug_offset_);
   tDMAList dma_hdr = *(tDMAList *)(res + res_hdr->dma_offset_);
 
-  inst_size += ALIGN16(mem_hdr.total_count_ * sizeof(tMemory));
-  inst_size += ALIGN16(tensor_hdr.count_ * sizeof(tTensor));
-  inst_size +=
-      ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * sizeof(int32_t));
-  inst_size +=
-      ALIGN16((io_hdr.num_input_ + io_hdr.num_output_) * io_hdr.name_length_);
-  inst_size += ALIGN16(io_hdr.num_input_ * sizeof(tShape));
-  inst_size += ALIGN16(op_hdr.type_count_ * sizeof(tOperatorAPI));
-  inst_size += ALIGN16(op_hdr.op_size_);
-  inst_size += ALIGN16(sizeof(tShapeInfer));
-  inst_size += ALIGN16(sizeof(tDebugList));
-  inst_size += ALIGN16(sizeof(tDMAList));
-  inst_size += ALIGN16(dma_hdr.count_ * sizeof(tDMA));
-
   tMemory inst_memory;
   inst_memory.size_ = inst_size;
   inst_memory.dptr_ = 0;
   for (i = 0; i < num_memory; i++) {
     if (memory_list[i].mem_type_ == 0) {
-      assert(inst_memory.size_ <= memory_list[i].size_);
+      // a plan from tGetMemoryPlanMapped is too small for a copying init
+      if (memory_list[i].size_ < inst_memory.size_) {
+        return T_ERR_NO_WORKSPACE;
+      }
       inst_memory = memory_list[i];
       break;
     }
@@ -339,25 +899,34 @@ tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
   }
 
   ptr += ALIGN16(inst->num_memory_ * sizeof(tMemory));
-  inst->tensor_ = (tTensor *)ptr;
   inst->num_tensor_ = tensor_hdr.count_;
   assert(tensor_hdr.elem_size_ == sizeof(tTensor));
-  memcpy(inst->tensor_, res + res_hdr->tensor_offset_ + tensor_hdr.offset_,
-         inst->num_tensor_ * sizeof(tTensor));
-  ptr += ALIGN16(inst->num_tensor_ * sizeof(tTensor));
+  if (mapped) {
+    inst->tensor_ = (tTensor *)(res + res_hdr->tensor_offset_ + tensor_hdr.offset_);
+  } else {
+    inst->tensor_ = (tTensor *)ptr;
+    memcpy(inst->tensor_, res + res_hdr->tensor_offset_ + tensor_hdr.offset_,
+           inst->num_tensor_ * sizeof(tTensor));
+    ptr += ALIGN16(inst->num_tensor_ * sizeof(tTensor));
+  }
 
   inst->num_input_ = io_hdr.num_input_;
   inst->num_output_ = io_hdr.num_output_;
-  inst->io_tensors_ = (int32_t *)ptr;
-  memcpy(inst->io_tensors_, res + res_hdr->io_offset_ + io_hdr.tensor_offset_,
-         (inst->num_input_ + inst->num_output_) * sizeof(int32_t));
-  ptr += ALIGN16((inst->num_input_ + inst->num_output_) * sizeof(int32_t));
-
-  inst->io_names_ = (char *)ptr;
   inst->io_name_len_ = io_hdr.name_length_;
-  memcpy(inst->io_names_, res + res_hdr->io_offset_ + io_hdr.name_offset_,
-         (inst->num_input_ + inst->num_output_) * io_hdr.name_length_);
-  ptr += ALIGN16((inst->num_input_ + inst->num_output_) * io_hdr.name_length_);
+  if (mapped) {
+    inst->io_tensors_ = (int32_t *)(res + res_hdr->io_offset_ + io_hdr.tensor_offset_);
+    inst->io_names_ = (char *)(res + res_hdr->io_offset_ + io_hdr.name_offset_);
+  } else {
+    inst->io_tensors_ = (int32_t *)ptr;
+    memcpy(inst->io_tensors_, res + res_hdr->io_offset_ + io_hdr.tensor_offset_,
+           (inst->num_input_ + inst->num_output_) * sizeof(int32_t));
+    ptr += ALIGN16((inst->num_input_ + inst->num_output_) * sizeof(int32_t));
+
+    inst->io_names_ = (char *)ptr;
+    memcpy(inst->io_names_, res + res_hdr->io_offset_ + io_hdr.name_offset_,
+           (inst->num_input_ + inst->num_output_) * io_hdr.name_length_);
+    ptr += ALIGN16((inst->num_input_ + inst->num_output_) * io_hdr.name_length_);
+  }
 
   inst->input_shape_ = (tShape *)ptr;
   for (i = 0; i < inst->num_input_; ++i) {
@@ -366,6 +935,19 @@ tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
   }
   ptr += ALIGN16(inst->num_input_ * sizeof(tShape));
 
+  // state ids follow input and output ids: all state inputs, then all state outputs
+  inst->num_state_ = io_hdr.num_state_;
+  inst->states_ = (tState *)ptr;
+  {
+    const int32_t *state_ids = (const int32_t *)(res + res_hdr->io_offset_ + io_hdr.tensor_offset_) +
+                               inst->num_input_ + inst->num_output_;
+    for (i = 0; i < inst->num_state_; ++i) {
+      inst->states_[i].input_tensor_id = state_ids[i];
+      inst->states_[i].output_tensor_id = state_ids[i + inst->num_state_];
+    }
+  }
+  ptr += ALIGN16(inst->num_state_ * sizeof(tState));
+
   inst->num_operator_ = op_hdr.op_count_;
   inst->op_api_ = (tOperatorAPI **)ptr;
   const char *type_ptr =
@@ -382,19 +964,13 @@ tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
   }
   ptr += ALIGN16(op_hdr.type_count_ * sizeof(tOperatorAPI));
 
-  inst->op_buffer_ = (uint8_t *)ptr;
-  memcpy(inst->op_buffer_, res + res_hdr->op_offset_ + op_hdr.op_offset_,
-         op_hdr.op_size_);
-  ptr += ALIGN16(op_hdr.op_size_);
-
-  for (i = 0; i < inst->num_tensor_; ++i) {
-    tTensor *tensor = inst->tensor_ + i;
-    tMemory *memory = &inst->memory_[tensor->mem_id_];
-    if (tensor->mem_id_ >= inst->num_shared_memory_) {
-      continue;
-    }
-    uint64_t offset = tensor->offset_;
-    tensor->dptr_ = memory->dptr_ + offset;
+  if (mapped) {
+    inst->op_buffer_ = (uint8_t *)(res + res_hdr->op_offset_ + op_hdr.op_offset_);
+  } else {
+    inst->op_buffer_ = (uint8_t *)ptr;
+    memcpy(inst->op_buffer_, res + res_hdr->op_offset_ + op_hdr.op_offset_,
+           op_hdr.op_size_);
+    ptr += ALIGN16(op_hdr.op_size_);
   }
 
 
@@ -422,9 +998,22 @@ tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
   inst->dma_info_->offset_ = dma_hdr.offset_;
   ptr += ALIGN16(sizeof(tDMAList));
 
-  inst->dma_ = (tDMA *)ptr;
-  memcpy(inst->dma_, res + res_hdr->dma_offset_ + dma_hdr.offset_,
-         dma_hdr.count_ * sizeof(tDMA));
+  if (mapped) {
+    inst->dma_ = (tDMA *)(res + res_hdr->dma_offset_ + dma_hdr.offset_);
+  } else {
+    inst->dma_ = (tDMA *)ptr;
+    memcpy(inst->dma_, res + res_hdr->dma_offset_ + dma_hdr.offset_,
+           dma_hdr.count_ * sizeof(tDMA));
+    ptr += ALIGN16(dma_hdr.count_ * sizeof(tDMA));
+  }
+
+#if THINKER_SCHED_ENABLE
+  // operator dependency graph for the parallel scheduler, sized by tGetMemoryPlan
+  tStatus sched_ret = buildSchedGraph(inst, ptr, (int64_t)inst_memory.size_ - inst_size);
+  if (sched_ret != T_SUCCESS) {
+    return sched_ret;
+  }
+#endif
   *hdl = ~((tModelHandle)inst);
   return T_SUCCESS;
 }
@@ -432,6 +1021,36 @@ tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
 #pragma clang optimize on
 #endif
 
+/**
+ * Initialize model from resource data
+ * @param hdl Output handle to model
+ * @param res Pointer to model resource data
+ * @param size Size of model resource data
+ * @param memory_list Array of memory allocations
+ * @param num_memory Number of memory entries
+ * @return Status code
+ */
+tStatus tModelInit(tModelHandle *hdl, const int8_t *res, const uint64_t size,
+                   const tMemory *memory_list, const int32_t num_memory) {
+  return modelInit(hdl, res, size, memory_list, num_memory, 0);
+}
+
+/**
+ * Initialize model from a resource that stays mapped for the model lifetime
+ * Read-only tables are used in place and parameters are never copied, so a
+ * file mapping is only paged in where it is read.
+ * @param hdl Output handle to model
+ * @param res Pointer to mapped model resource data
+ * @param size Size of model resource data
+ * @param memory_list Array of memory allocations
+ * @param num_memory Number of memory entries
+ * @return Status code
+ */
+tStatus tModelInitMapped(tModelHandle *hdl, const int8_t *res, const uint64_t size,
+                         const tMemory *memory_list, const int32_t num_memory) {
+  return modelInit(hdl, res, size, memory_list, num_memory, 1);
+}
+
 /**
  * Finalize model and free resources
  * @param hdl Model handle to finalize
@@ -580,30 +1199,85 @@ tShape tGetOutputShape(const tModelHandle hdl, const int32_t idx) {
   return tensor->shape_;
 }
 
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
 /**
- * Create executor for model execution
- * @param model_hdl Model handle
- * @param hdl Output execution handle
- * @param memory_list Memory allocation list
- * @param num_memory Number of memory entries
- * @return Status code
+ * Validate the DMA table of a resource against the executor DMA list
+ * tpacker writes the weight entries first, then the activation transfers
+ * ordered by the operator that issues them.
+ * @param model Model
+ * @return T_ERR_RES_DMA_LIST if the table overflows the list or is misordered
  */
-#if !(defined(WIN32) || defined(linux))
-#pragma clang optimize off
-#endif
-tStatus tCreateExecutor(const tModelHandle model_hdl, tExecHandle *hdl,
-                        const tMemory *memory_list, const int32_t num_memory) {
+static tStatus checkDMATable(const tModel *model) {
+  uint32_t num_weight = 0, num_act = 0;
+  uint32_t last_issue = 0;
+  for (uint32_t i = 0; i < model->dma_info_->count_; i++) {
+    const tDMA *dma = model->dma_ + i;
+    if (dma->src_tensor_id_ >= model->num_tensor_ || dma->dst_tensor_id_ >= model->num_tensor_) {
+      return T_ERR_RES_DMA_LIST;
+    }
+    if (!(model->tensor_[dma->src_tensor_id_].life_ & TENSOR_LIFE_VALID)) {
+      if (num_act > 0 || num_weight >= THINKER_DMA_MAX) {
+        return T_ERR_RES_DMA_LIST;
+      }
+      num_weight++;
+      continue;
+    }
+    uint32_t issue = TENSOR_LIFE_BEGIN(model->tensor_[dma->dst_tensor_id_].life_);
+    if (num_act >= THINKER_ACT_DMA_MAX || issue < last_issue) {
+      return T_ERR_RES_DMA_LIST;
+    }
+    last_issue = issue;
+    num_act++;
+  }
+  return T_SUCCESS;
+}
+#endif
+
+/**
+ * Create executor for model execution
+ * @param model_hdl Model handle
+ * @param hdl Output execution handle
+ * @param memory_list Memory allocation list
+ * @param num_memory Number of memory entries
+ * @return Status code
+ */
+#if !(defined(WIN32) || defined(linux))
+#pragma clang optimize off
+#endif
+tStatus tCreateExecutor(const tModelHandle model_hdl, tExecHandle *hdl,
+                        const tMemory *memory_list, const int32_t num_memory) {
   tModel *model = (tModel *)~model_hdl;
   if (hdl == NULL) {
     return T_ERR_INVALID_PARA;
   }
 
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  tStatus dma_ret = checkDMATable(model);
+  if (dma_ret != T_SUCCESS) {
+    return dma_ret;
+  }
+#endif
+
   uint16_t i = 0;
   uint16_t j = 0;
+  uint32_t num_tensor_ref = getOpTensorCount(model->op_buffer_, model->num_operator_);
   int32_t inst_size = 0;
   inst_size += ALIGN16(sizeof(tExecInst));
   inst_size += ALIGN16(model->num_memory_ * sizeof(tMemory));
   inst_size += ALIGN16(model->num_tensor_ * sizeof(tTensor));
+  inst_size += getExecPlanSize(model->num_operator_, num_tensor_ref);
+  inst_size += ALIGN16((model->num_input_ + model->num_output_) * sizeof(tIOBind));
+  inst_size += THINKER_BATCH_MAX * getBatchStride(model->memory_, model->num_shared_memory_,
+                                                  model->num_memory_);
+  inst_size += getReplanSize(model->num_tensor_, model->num_memory_);
+  inst_size += getProfileSize();
+  inst_size += getStatsSize(model->num_operator_);
+#if THINKER_SCHED_ENABLE
+  inst_size += sched_state_size(model->num_operator_);
+#endif
+  inst_size += ALIGN16(model->shape_infer->graph_->num_scalars_ * sizeof(tScalarReg));
+  inst_size += tShapeCacheSize(model->shape_infer->graph_->num_input_,
+                               model->shape_infer->num_id_pair_);
   inst_size += ALIGN16(sizeof(tDMA_List));
   tMemory inst_memory;
 
@@ -649,52 +1323,180 @@ tStatus tCreateExecutor(const tModelHandle model_hdl, tExecHandle *hdl,
         break;
       }
     }
+    // the model table keeps offsets (it may be mapped read-only), shared tensors
+    // resolve against the shared memories
     if (tensor->mem_id_ < model->num_shared_memory_) {
+      tensor->dptr_ = inst->memory_[tensor->mem_id_].dptr_ + tensor->offset_;
       continue;
     }
     uint64_t offset = tensor->offset_;
     tensor->dptr_ = memory->dptr_ + offset;
   }
 
+  // build execution plan: resolve op api, attrs and tensors once
+  inst->op_plan_ = (tOpPlan *)ptr;
+  ptr += ALIGN16(model->num_operator_ * sizeof(tOpPlan));
+  tTensor **plan_tensors = (tTensor **)ptr;
+  ptr += ALIGN16(num_tensor_ref * sizeof(tTensor *));
+
   uint8_t *p_op = model->op_buffer_;
-  tTensor *local_tensor[512];
   for (i = 0; i < model->num_operator_; i++) {
     tOperator *op = (tOperator *)p_op;
+    tOpPlan *plan = inst->op_plan_ + i;
     uint32_t *tensor_ids = (uint32_t *)(p_op + op->tensor_offset_);
     uint32_t num_tensor = op->num_input_ + op->num_output_ + op->num_temp_;
     tOperatorAPI *op_api = model->op_api_[op->op_id_];
     for (j = 0; j < num_tensor; j++) {
-      local_tensor[j] = inst->tensor_ + tensor_ids[j];
+      plan_tensors[j] = inst->tensor_ + tensor_ids[j];
     }
+    plan->forward_ = op_api->forward;
+    plan->op_ = op;
+    plan->attrs_ = (void *)(p_op + op->attr_offset_);
+    plan->tensors_ = plan_tensors;
+    plan->num_tensor_ = num_tensor;
+    plan->api_ = op_api;
+    plan_tensors += num_tensor;
+
     tStatus ret;
     tHypeparam parm = {-1, NULL, NULL};
-    ret = op_api->init(op, local_tensor, num_tensor, &parm);
+    ret = op_api->init(op, plan->tensors_, num_tensor, &parm);
     if (ret != T_SUCCESS) {
       return ret;
     }
     p_op += op->total_size_;
   }
 
+  inst->io_bind_ = (tIOBind *)ptr;
+  for (i = 0; i < model->num_input_ + model->num_output_; i++) {
+    tTensor *tensor = inst->tensor_ + model->io_tensors_[i];
+    inst->io_bind_[i].bind_ptr_ = 0;
+    inst->io_bind_[i].plan_ptr_ = tensor->dptr_;
+    inst->io_bind_[i].copy_ = (tensor->mem_.type_ == SHARE_MEM);
+  }
+  ptr += ALIGN16((model->num_input_ + model->num_output_) * sizeof(tIOBind));
+  inst->state_ready_ = 0;
+
+  inst->batch_stride_ = getBatchStride(model->memory_, model->num_shared_memory_,
+                                       model->num_memory_);
+  inst->batch_buf_ = ptr;
+  ptr += THINKER_BATCH_MAX * inst->batch_stride_;
+
+#if defined(linux)
+  pthread_mutex_init(&inst->async_.lock_, NULL);
+  pthread_cond_init(&inst->async_.done_cond_, NULL);
+  inst->async_.busy_ = 0;
+  inst->async_.in_callback_ = 0;
+  inst->async_.status_ = T_SUCCESS;
+  inst->async_.callback_ = NULL;
+  inst->async_.user_ = NULL;
+#endif
+
+#if THINKER_SCHED_ENABLE
+  // dependencies are shared with the model, pending counters and queues are ours
+  inst->sched_ = model->sched_;
+  sched_state_init(&inst->sched_, ptr);
+  ptr += sched_state_size(model->num_operator_);
+#endif
 
   // // copy scalars of scalar graph to executor
-  inst->shape_scalars_ = (double *) ptr;
-  memcpy(inst->shape_scalars_, model->shape_infer->graph_->scalars_, 
-         sizeof(double) * model->shape_infer->graph_->num_scalars_);
-  ptr += ALIGN16(model->shape_infer->graph_->num_scalars_*sizeof(double));        
+  inst->shape_scalars_ = (tScalarReg *) ptr;
+  memcpy(inst->shape_scalars_, model->shape_infer->program_.regs_,
+         sizeof(tScalarReg) * model->shape_infer->graph_->num_scalars_);
+  ptr += ALIGN16(model->shape_infer->graph_->num_scalars_*sizeof(tScalarReg));        
+
+  tShapeCacheInit(&inst->shape_cache_, (char *)ptr, model->shape_infer->graph_->num_input_,
+                  model->shape_infer->num_id_pair_);
+  ptr += tShapeCacheSize(model->shape_infer->graph_->num_input_,
+                         model->shape_infer->num_id_pair_);
+
+#if THINKER_REPLAN_ENABLE
+  inst->mem_peak_ = (uint64_t *)ptr;
+  for (i = 0; i < model->num_memory_; i++) {
+    inst->mem_peak_[i] = model->memory_[i].size_;
+  }
+  ptr += ALIGN16(model->num_memory_ * sizeof(uint64_t));
+  inst->replan_ = (tReplanGroup *)ptr;
+  ptr += ALIGN16(model->num_tensor_ * sizeof(tReplanGroup));
+  inst->replan_index_ = (int32_t *)ptr;
+  ptr += ALIGN16(2 * model->num_tensor_ * sizeof(int32_t));
+  inst->replan_stamp_ = inst->shape_cache_.stamp_;
+#endif
+
+#if THINKER_PROFILE
+  inst->profile_ = (tProfileRecord *)ptr;
+  inst->profile_count_ = 0;
+  inst->profile_forward_ = 0;
+  ptr += getProfileSize();
+#endif
+
+#if THINKER_STATS
+  memset(&inst->stats_, 0, sizeof(inst->stats_));
+  inst->stats_ops_ = (uint32_t *)ptr;
+  memset(inst->stats_ops_, 0, model->num_operator_ * sizeof(uint32_t));
+  ptr += getStatsSize(model->num_operator_);
+#endif
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
   inst->dma_list_ = (tDMA_List *)ptr;
-  inst->dma_list_->total_ = model->dma_info_->count_;
+  inst->dma_list_->total_ = 0;
   inst->dma_list_->cout_ = 0;
+  inst->dma_list_->use_ = 0;
+  inst->dma_list_->ready_ = 0;
+  inst->dma_list_->depth_ = 0;
+  inst->dma_list_->offset_ = 0;
+  inst->dma_list_->act_total_ = 0;
+  inst->dma_list_->act_cout_ = 0;
+  inst->dma_list_->act_ready_ = 0;
+  inst->dma_list_->wait_ = 0;
+#if THINKER_PROFILE
+  memset(inst->dma_list_->stat_, 0, sizeof(inst->dma_list_->stat_));
+#endif
+#if THINKER_STATS
+  inst->dma_list_->stats_ = &inst->stats_;
+#endif
   tDMA *dma_temp = model->dma_;
-  for (i = 0; i < inst->dma_list_->total_; i++) {
+  for (i = 0; i < model->dma_info_->count_; i++) {
     uint32_t src_id = dma_temp->src_tensor_id_;
     uint32_t dst_id = dma_temp->dst_tensor_id_;
+    if (model->tensor_[src_id].life_ & TENSOR_LIFE_VALID) {
+      // activation spill or fill, timed by the liveness tpacker planned for both ends
+      thinkerActDMA *act = inst->dma_list_->act_ + inst->dma_list_->act_total_;
+      act->src_tensors_ = inst->tensor_ + src_id;
+      act->dst_tensors_ = inst->tensor_ + dst_id;
+      act->size_ = dma_temp->size_;
+      act->issue_op_ = TENSOR_LIFE_BEGIN(model->tensor_[dst_id].life_);
+      act->wait_op_ = TENSOR_LIFE_END(model->tensor_[src_id].life_);
+      inst->dma_list_->act_total_++;
+      dma_temp++;
+      continue;
+    }
+    inst->dma_list_->total_++;
     inst->dma_list_->dma_[i].src_tensors_ = inst->tensor_ + src_id;
     inst->dma_list_->dma_[i].dst_tensors_ = inst->tensor_ + dst_id;
     inst->dma_list_->dma_[i].size_ = dma_temp->size_;
+    inst->dma_list_->dma_[i].offset_ = 0;
+    if (dma_temp->size_ == 0 && i > 0) {
+      // merged by tpacker into the burst of the previous entry, contiguous in the parameters
+      uint32_t prev_id = (dma_temp - 1)->src_tensor_id_;
+      inst->dma_list_->dma_[i].offset_ = inst->dma_list_->dma_[i - 1].offset_ +
+          (uint32_t)(model->tensor_[src_id].offset_ - model->tensor_[prev_id].offset_);
+    }
+    // tpacker rotates the entries through a ring of buffers, its size bounds the prefetch depth
+    int32_t k = 0;
+    while (k < i && inst->dma_list_->dma_[k].dst_tensors_ != inst->dma_list_->dma_[i].dst_tensors_) {
+      k++;
+    }
+    if (k == i) {
+      inst->dma_list_->depth_++;
+    }
     dma_temp++;
   }
+#if THINKER_SCHED_ENABLE
+  // the scheduler reorders operators, activation transfers are timed by operator index
+  if (inst->dma_list_->act_total_ > 0) {
+    return T_ERR_NO_IMPLEMENTED;
+  }
+#endif
 #else
     return T_ERR_INVALID_PLATFROM;
 #endif
@@ -717,29 +1519,64 @@ tStatus tReleaseExecutor(tExecHandle hdl) {
   if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
     return T_ERR_INVALID_INST;
   }
-  uint8_t *p_op = model->op_buffer_;
-  tTensor *local_tensor[512];
+#if defined(linux)
+  tWait(hdl);
+  pthread_cond_destroy(&inst->async_.done_cond_);
+  pthread_mutex_destroy(&inst->async_.lock_);
+#endif
   for (int32_t i = 0; i < model->num_operator_; ++i) {
-    tOperator *op = (tOperator *)p_op;
-    uint32_t *tensor_ids = (uint32_t *)(p_op + op->tensor_offset_);
-    uint32_t num_tensor = op->num_input_ + op->num_output_ + op->num_temp_;
-    tOperatorAPI *op_api = model->op_api_[op->op_id_];
-    for (int32_t ii = 0; ii < num_tensor; ++ii) {
-      local_tensor[ii] = inst->tensor_ + tensor_ids[ii];
-    }
-
-    tStatus ret = op_api->fini(op, local_tensor, num_tensor);
+    tOpPlan *plan = inst->op_plan_ + i;
+    tStatus ret = plan->api_->fini(plan->op_, plan->tensors_, plan->num_tensor_);
     if (ret != T_SUCCESS) {
       return ret;
     }
-    p_op += op->total_size_;
   }
 
   return T_SUCCESS;
 }
 
+/**
+ * Copy data into tensor memory and flush the data cache if needed
+ * @param dst Destination address
+ * @param src Source address
+ * @param bytes Number of bytes to copy
+ */
+static void copyTensorData(void *dst, const void *src, uint64_t bytes) {
+  memcpy(dst, src, bytes);
+#if !(defined(WIN32) || defined(linux))
+#if THINKER_USE_ARCS
+  if (((uint32_t)(dst) & 0x28000000) == 0x28000000)
+  {
+    HAL_FlushDCache_by_Addr((uint32_t *)(dst), bytes);
+  }
+#elif THINKER_USE_VENUSA
+  if (((uint32_t)(dst) & 0x38000000) == 0x38000000)
+  {
+    HAL_FlushDCache_by_Addr((uint32_t *)(dst), bytes);
+  }
+#endif
+#endif
+}
+
+/**
+ * Check whether a tensor is the input or output of a state pair
+ * @param model Model
+ * @param tensor_id Tensor index
+ * @return 1 if the tensor is swapped by tForward
+ */
+static int32_t isStateTensor(const tModel *model, const int32_t tensor_id) {
+  for (int32_t i = 0; i < model->num_state_; i++) {
+    if (model->states_[i].input_tensor_id == tensor_id ||
+        model->states_[i].output_tensor_id == tensor_id) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 /**
  * Set input tensor by index
+ * State inputs are carried over by tForward and can not be set.
  * @param hdl Execution handle
  * @param idx Input index
  * @param input Input data
@@ -761,6 +1598,11 @@ tStatus tSetInput(const tExecHandle hdl, const int32_t idx,
     return T_ERR_INVALID_DATA;
   }
 
+  // the swap in tForward would drop the data, tResetState starts a new stream
+  if (isStateTensor(model, model->io_tensors_[idx])) {
+    return T_ERR_INVALID_PARA;
+  }
+
   {
     tTensor *tensor = inst->tensor_ + model->io_tensors_[idx];
     tDType dtype = input->dtype_;
@@ -789,20 +1631,8 @@ tStatus tSetInput(const tExecHandle hdl, const int32_t idx,
     uint64_t bytes = getShapeSize(&tensor->shape_) * (dtype & 0xFF);
     if ((uint64_t)tensor->dptr_ != (uint64_t)input->dptr_ && bytes != 0)
     {
-		memcpy((void *)tensor->dptr_, input->dptr_, bytes);
-#if !(defined(WIN32) || defined(linux))
-#if THINKER_USE_ARCS
-		if (((uint32_t)(tensor->dptr_) & 0x28000000) == 0x28000000)
-		{
-			HAL_FlushDCache_by_Addr((uint32_t *)(tensor->dptr_), bytes);
-		}
-#elif THINKER_USE_VENUSA
-		if (((uint32_t)(tensor->dptr_) & 0x38000000) == 0x38000000)
-		{
-			HAL_FlushDCache_by_Addr((uint32_t *)(tensor->dptr_), bytes);
-		}
-#endif
-#endif
+      copyTensorData((void *)tensor->dptr_, input->dptr_, bytes);
+      THINKER_STATS_COUNT(&inst->stats_, io, bytes);
     }
   }
   return T_SUCCESS;
@@ -862,7 +1692,8 @@ tStatus tGetOutput(const tExecHandle hdl, const int32_t idx, tData *output) {
   {
     int32_t id = idx + model->num_input_;
     tTensor *tensor = inst->tensor_ + model->io_tensors_[id];
-    output->dptr_ = (void *)tensor->dptr_;
+    tIOBind *bind = inst->io_bind_ + id;
+    output->dptr_ = (void *)(bind->bind_ptr_ ? bind->bind_ptr_ : tensor->dptr_);
     output->dtype_ = tensor->dtype_;
     output->shape_ = tensor->shape_;
     output->scale_ = tensor->scale_;
@@ -899,251 +1730,1501 @@ tStatus tGetOutputByName(const tExecHandle hdl, const char *name,
 }
 
 /**
- * Execute forward pass
- * @param hdl Execution handle
+ * Check whether the memory plan shares a tensor in place with another one
+ * Reshape chains keep one planned buffer for all of their tensors, so the
+ * alias would keep reading and writing the planned buffer after binding.
+ * Without liveness only tensors starting at the same offset are aliases.
+ * @param model Model
+ * @param tensor_id Tensor index
+ * @return 1 if another tensor uses the same bytes while the tensor is alive
+ */
+static int32_t isPlanShared(const tModel *model, const int32_t tensor_id) {
+  const tTensor *a = model->tensor_ + tensor_id;
+  uint64_t a_end = a->offset_ + getShapeSize((tShape *)&a->shape_) * (a->dtype_ & 0xFF);
+  for (uint32_t k = 0; k < model->num_tensor_; k++) {
+    const tTensor *b = model->tensor_ + k;
+    if (k == (uint32_t)tensor_id || b->mem_id_ != a->mem_id_) {
+      continue;
+    }
+    if (!(a->life_ & TENSOR_LIFE_VALID) || !(b->life_ & TENSOR_LIFE_VALID)) {
+      if (b->offset_ == a->offset_) {
+        return 1;
+      }
+      continue;
+    }
+    uint64_t b_end = b->offset_ + getShapeSize((tShape *)&b->shape_) * (b->dtype_ & 0xFF);
+    if (a->offset_ < b_end && b->offset_ < a_end &&
+        TENSOR_LIFE_BEGIN(a->life_) <= TENSOR_LIFE_END(b->life_) &&
+        TENSOR_LIFE_BEGIN(b->life_) <= TENSOR_LIFE_END(a->life_)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Check whether a caller buffer overlaps the buffer bound to another io tensor
+ * @param inst Execution instance
+ * @param id Index into io_tensors_ being bound
+ * @param ptr Caller buffer
+ * @param bytes Bytes the tensor needs
+ * @return 1 if overlapped
+ */
+static int32_t isBindOverlap(const tExecInst *inst, const int32_t id,
+                             const addr_type ptr, const uint64_t bytes) {
+  const tModel *model = inst->model_;
+  for (int32_t i = 0; i < model->num_input_ + model->num_output_; i++) {
+    const tIOBind *bind = inst->io_bind_ + i;
+    if (i == id || bind->bind_ptr_ == 0) {
+      continue;
+    }
+    const tTensor *tensor = model->tensor_ + model->io_tensors_[i];
+    uint64_t size = getShapeSize((tShape *)&tensor->shape_) * (tensor->dtype_ & 0xFF);
+    if (ptr < bind->bind_ptr_ + size && bind->bind_ptr_ < ptr + bytes) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Bind caller buffer to an io tensor
+ * @param inst Execution instance
+ * @param id Index into io_tensors_ (inputs first, then outputs)
+ * @param data Caller buffer, NULL or NULL dptr_ to unbind
  * @return Status code
  */
-tStatus tForward(const tExecHandle hdl) {
-  tStatus ret = T_SUCCESS;
-  tExecInst *inst = (tExecInst *)~hdl;
+static tStatus bindIOTensor(tExecInst *inst, const int32_t id, const tData *data) {
   tModel *model = inst->model_;
-  tTensor *local_tensor[512];
-  uint8_t *p_op = NULL;
-  int32_t i;
-  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
-    return T_ERR_INVALID_INST;
+  int32_t tensor_id = model->io_tensors_[id];
+  tTensor *tensor = inst->tensor_ + tensor_id;
+  tIOBind *bind = inst->io_bind_ + id;
+
+  if (data == NULL || data->dptr_ == NULL) {
+    bind->bind_ptr_ = 0;
+    tensor->dptr_ = bind->plan_ptr_;
+    return T_SUCCESS;
   }
-  p_op = model->op_buffer_;
 
-#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-  tDMA_List *dma_list = inst->dma_list_;
-  if (dma_list->total_ > 0) {
-	  dma_list->cout_ = 0;
-	  int32_t index = dma_list->cout_;
-	  tTensor *src = dma_list->dma_[index].src_tensors_;
-	  tTensor *dst = dma_list->dma_[index].dst_tensors_;
-	  int32_t size = dma_list->dma_[index].size_;
-#if !defined(THINKER_USE_VENUSA)
-	  if (size > 0) {
-      dma_cpy_async(0, (void *)dst->dptr_, (void *)src->dptr_, size);
-      dma_list->cout_++;
-	  }
-  }
-#else 
-  #include "core/ops/venusA/luna/luna_misc_math.h"
-  if (size > 0) {
-    dma_cpy_async(5, (int8_t *)dst->dptr_, (int8_t *)src->dptr_, size);
-		dma_list->cout_++;
-	  }
-  }
-#endif // !defined(THINKER_USE_VENUSA)
-#endif // defined(THINKER_USE_VENUS) || defined(THINKER_USE_ARCS) || defined(THINKER_USE_VENUSA)
+  if ((data->dtype_ & 0xFF) != (tensor->dtype_ & 0xFF)) {
+    printf("bind dtype :%d, model need type:%d\n", data->dtype_, tensor->dtype_);
+    return T_ERR_INVALID_DATATYPE;
+  }
 
-  for (i = 0; i < model->num_operator_; ++i) {
-    int32_t ii = 0;
-    tOperator *op = (tOperator *)p_op;
-    uint32_t *tensor_ids = (uint32_t *)(p_op + op->tensor_offset_);
-    uint32_t num_tensor = op->num_input_ + op->num_output_ + op->num_temp_;
-    tOperatorAPI *op_api = model->op_api_[op->op_id_];
+  // state tensors are swapped by tForward and can not be bound
+  if (isStateTensor(model, tensor_id)) {
+    return T_ERR_INVALID_PARA;
+  }
 
-    if (T_FORCE_STOP_VALUE == inst->force_stop_flag)  //user force to stop
-    {
-#if THINKER_USE_VENUS || THINKER_USE_ARCS
-		if (dma_list->cout_ && (dma_list->cout_ < dma_list->total_))
-		{
-			dma_wait_complete(0);
-		}
-#elif THINKER_USE_VENUSA
-    if (dma_list->cout_ && (dma_list->cout_ < dma_list->total_))
-		{
-      luna_gpdma_wait(5);
-		}
-#endif // defined(THINKER_USE_VENUSA)
-        return T_FORCE_STOP_VALUE;
-    }
+  // constant tensors in flash can not be redirected
+  if (tensor->mem_.type_ != PSRAM && tensor->mem_.type_ != SHARE_MEM) {
+    return T_ERR_INVALID_DATA;
+  }
 
-    for (ii = 0; ii < num_tensor; ++ii) {
-      local_tensor[ii] = inst->tensor_ + tensor_ids[ii];
+  // a redirected tensor must own its planned bytes: no in-place alias and
+  // no second io slot (input passed through to an output) on the same tensor
+  if (!bind->copy_) {
+    if (isPlanShared(model, tensor_id)) {
+      return T_ERR_INVALID_PARA;
     }
-    PROFILE_BEGIN
-    ret = op_api->forward(op, local_tensor, num_tensor, inst->dma_list_);
-  //  printf("[%d]op_name:%s\n", i, op_api->name());
-    if (ret != T_SUCCESS) {
-      printf("forward error code :%d, op index :%d, op name: %s\n", ret, i,
-             op_api->name());
-      return ret;
+    for (int32_t i = 0; i < model->num_input_ + model->num_output_; i++) {
+      if (i != id && model->io_tensors_[i] == tensor_id) {
+        return T_ERR_INVALID_PARA;
+      }
     }
-    tTensorName *name_list =
-        (tTensorName *)inst->model_->debug_info->tensor_name_list_;
+  }
 
-#if THINKER_DUMP 
-#if (defined(WIN32) || defined(linux))
-    for (size_t j = 0; j < op->num_output_; j++) {
-      tTensor *out_tensor = local_tensor[op->num_input_ + j];
-      int32_t tensor_id = tensor_ids[op->num_input_ + j];
-      write_file(name_list[tensor_id].name_, out_tensor);
-    }
-#endif
-#endif
+  // buffer must be able to hold the largest shape planned for this tensor
+  tShape *max_shape = &model->tensor_[tensor_id].shape_;
+  uint64_t need = getShapeSize(max_shape) * (tensor->dtype_ & 0xFF);
+  uint64_t bytes = getShapeSize((tShape *)&data->shape_) * (data->dtype_ & 0xFF);
+  if (bytes < need) {
+    printf("bind size :%d, model need size:%d\n", (int32_t)bytes, (int32_t)need);
+    return T_ERR_INVALID_DATA;
+  }
 
-#ifdef THINKER_RESULT_CRC_PRINT
-    for (size_t j = 0; j < op->num_output_; j++) {
-      tTensor *out_tensor = local_tensor[op->num_input_ + j];
-      int32_t tensor_id = tensor_ids[op->num_input_ + j];
-      uint8_t *data = (uint8_t *)out_tensor->dptr_;
-      uint32_t data_size = getTensorSize(out_tensor)*out_tensor->byte_;
-#if !(defined(WIN32) || defined(linux))
-#if THINKER_USE_ARCS
-		if (((uint32_t)(out_tensor->dptr_) & 0x28000000) == 0x28000000)
-		{
-			HAL_FlushDCache_by_Addr((uint32_t *)(out_tensor->dptr_), data_size);
-		}
-#elif THINKER_USE_VENUSA
-		if (((uint32_t)(out_tensor->dptr_) & 0x38000000) == 0x38000000)
-		{
-			HAL_FlushInvalidateDCache_by_Addr((uint32_t *)(out_tensor->dptr_), data_size);
-		}
-#endif
-#endif
-      int32_t result_crc = crc32_calc(data, data_size);
-      printf("crc32_calc = 0x%08x, data = [0x%08x-0x%08x-0x%08x], name = %s\n", result_crc,
-            ((uint32_t *)(data))[0], ((uint32_t *)(data + data_size / 2))[0],
-            ((uint32_t *)(data + data_size - 4))[0], name_list[tensor_id].name_);
-    }
-#endif
-    PROFILE_END
+  if (((addr_type)data->dptr_ & 0xF) != 0) {
+    return T_ERR_INVALID_DATA;
+  }
 
-    p_op += op->total_size_;
+  // outputs written while a bound input is still read must not land on it
+  if (isBindOverlap(inst, id, (addr_type)data->dptr_, need)) {
+    return T_ERR_INVALID_DATA;
+  }
+
+  bind->bind_ptr_ = (addr_type)data->dptr_;
+  if (!bind->copy_) {
+    tensor->dptr_ = bind->bind_ptr_;
   }
   return T_SUCCESS;
 }
 
 /**
- * Update dynamic shapes during execution
+ * Bind caller buffer to input tensor for the executor lifetime
  * @param hdl Execution handle
- * @param axis_names Array of axis names
- * @param axis_sizes Array of axis sizes
- * @param num Number of axes to update
+ * @param idx Input index
+ * @param input Caller buffer, NULL dptr_ to unbind
  * @return Status code
  */
-tStatus tUpdateShape(tExecHandle hdl, const char **axis_names, const uint32_t *axis_sizes, int32_t num)
-{
-    tExecInst *inst = (tExecInst *)~hdl;
-    tModel *model   = inst->model_;
-    tStatus ret     = T_SUCCESS;
-    if (num != 0)
-        ret = tSetShapeInferInputByNames(model->shape_infer, inst->shape_scalars_, axis_names, axis_sizes, num);
-    else
-        ret = tSetShapeInferInputByTensors(model->shape_infer, inst->shape_scalars_, inst->tensor_);
-    if (ret != T_SUCCESS) return ret;
-    ret = tShapeInferForward(model->shape_infer, inst->shape_scalars_, inst->tensor_);
-    return ret;
+tStatus tBindInput(const tExecHandle hdl, const int32_t idx, const tData *input) {
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+
+  if (idx < 0 || idx >= inst->model_->num_input_) {
+    return T_ERR_INDEX_OF_BOUND;
+  }
+
+  return bindIOTensor(inst, idx, input);
 }
 
 /**
- * Start execution
+ * Bind caller buffer to output tensor for the executor lifetime
  * @param hdl Execution handle
+ * @param idx Output index
+ * @param output Caller buffer, NULL dptr_ to unbind
  * @return Status code
  */
-tStatus tExecutorStart(tExecHandle hdl)
-{
-    tExecInst *inst = (tExecInst *)~hdl;
-    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
-    {
-        return T_ERR_INVALID_INST;
-    }
-    inst->force_stop_flag = 0;
-    return T_SUCCESS;
+tStatus tBindOutput(const tExecHandle hdl, const int32_t idx, const tData *output) {
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+
+  if (idx < 0 || idx >= inst->model_->num_output_) {
+    return T_ERR_INDEX_OF_BOUND;
+  }
+
+  return bindIOTensor(inst, idx + inst->model_->num_input_, output);
 }
 
 /**
- * Stop execution
- * @param hdl Execution handle
- * @return Status code
+ * Copy bound buffers of tensors placed in share memory
+ * @param inst Execution instance
+ * @param is_output 0: caller buffer to input tensors, 1: output tensors to caller buffer
  */
-tStatus tExecutorStop(tExecHandle hdl)
-{
-    tExecInst *inst = (tExecInst *)~hdl;
-    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
-    {
-        return T_ERR_INVALID_INST;
+static void syncBoundIO(tExecInst *inst, int32_t is_output) {
+  tModel *model = inst->model_;
+  int32_t start = is_output ? model->num_input_ : 0;
+  int32_t end = is_output ? model->num_input_ + model->num_output_ : model->num_input_;
+  for (int32_t i = start; i < end; i++) {
+    tIOBind *bind = inst->io_bind_ + i;
+    if (bind->bind_ptr_ == 0 || !bind->copy_) {
+      continue;
     }
-    inst->force_stop_flag = T_FORCE_STOP_VALUE;
-    return T_SUCCESS;
+    tTensor *tensor = inst->tensor_ + model->io_tensors_[i];
+    uint64_t bytes = getShapeSize(&tensor->shape_) * (tensor->dtype_ & 0xFF);
+    if (bytes == 0) {
+      continue;
+    }
+    if (is_output) {
+      memcpy((void *)bind->bind_ptr_, (void *)tensor->dptr_, bytes);
+    } else {
+      copyTensorData((void *)tensor->dptr_, (void *)bind->bind_ptr_, bytes);
+    }
+    THINKER_STATS_COUNT(&inst->stats_, io, bytes);
+  }
 }
 
-#if THINKER_USE_MTQ
 /**
- * Get Luna list size information
+ * Swap state input and output buffers so the state produced by the last
+ * forward pass becomes the input of the next one
+ * @param inst Execution instance
+ */
+static void swapStates(tExecInst *inst) {
+  tModel *model = inst->model_;
+  for (int32_t i = 0; i < model->num_state_; i++) {
+    tTensor *in = inst->tensor_ + model->states_[i].input_tensor_id;
+    tTensor *out = inst->tensor_ + model->states_[i].output_tensor_id;
+    addr_type dptr = in->dptr_;
+    in->dptr_ = out->dptr_;
+    out->dptr_ = dptr;
+  }
+}
+
+/**
+ * Reset recurrent states to zero
  * @param hdl Execution handle
- * @param list_size Output list size
- * @param list_length Output list length
- * @param total_param Output total parameter size
+ * @return Status code
+ */
+tStatus tResetState(tExecHandle hdl) {
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+
+  tModel *model = inst->model_;
+  for (int32_t i = 0; i < model->num_state_; i++) {
+    tTensor *in = inst->tensor_ + model->states_[i].input_tensor_id;
+    uint64_t bytes = getShapeSize(&model->tensor_[model->states_[i].input_tensor_id].shape_) *
+                     (in->dtype_ & 0xFF);
+    memset((void *)in->dptr_, 0, bytes);
+  }
+  inst->state_ready_ = 0;
+  return T_SUCCESS;
+}
+
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+/**
+ * Restart the weight prefetch ring from one DMA list entry
+ * Entries from index on are considered not transferred, the channel must be idle.
+ * @param inst Execution instance
+ * @param index DMA entry handed to the next operator fetching weights
+ */
+static void startWeightDMA(tExecInst *inst, const uint32_t index) {
+  tDMA_List *dma_list = inst->dma_list_;
+  dma_list->cout_ = index;
+  dma_list->use_ = index;
+  dma_list->ready_ = index;
+  prefetchWeightData(dma_list, 0);
+}
+#endif
+
+/**
+ * Wait for the weight prefetch still in flight when forward is stopped early
+ * @param inst Execution instance
+ */
+static void waitPendingDMA(tExecInst *inst) {
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  waitWeightData(inst->dma_list_);
+#endif
+}
+
+#if THINKER_PROFILE || THINKER_DUMP || defined(THINKER_RESULT_CRC_PRINT)
+/**
+ * Look up the debug name of a tensor
+ * @param model Model
+ * @param tensor_id Tensor index
+ * @return Name, NULL if the resource carries no name for the tensor
+ */
+static const char *getTensorName(const tModel *model, const int32_t tensor_id) {
+  if (model->debug_info == NULL || model->debug_info->tensor_name_list_ == NULL ||
+      tensor_id < 0 || (uint32_t)tensor_id >= model->debug_info->tensor_name_count_) {
+    return NULL;
+  }
+  return ((const tTensorName *)model->debug_info->tensor_name_list_)[tensor_id].name_;
+}
+#endif
+
+#if THINKER_PROFILE
+/**
+ * Append the record of one operator execution to the profile ring
+ * @param inst Execution instance
+ * @param i Operator index
+ * @param start Tick when the operator started
+ * @param wait DMA wait ticks of the calling thread when the operator started
+ */
+static void recordProfile(tExecInst *inst, const int32_t i, const uint64_t start,
+                          const uint64_t wait) {
+  uint64_t end = tick_count();
+  tOpPlan *plan = inst->op_plan_ + i;
+  tOperator *op = plan->op_;
+#if THINKER_SCHED_ENABLE
+  uint32_t slot = __atomic_fetch_add(&inst->profile_count_, 1, __ATOMIC_RELAXED);
+#else
+  uint32_t slot = inst->profile_count_++;
+#endif
+  tProfileRecord *record = inst->profile_ + slot % THINKER_PROFILE_RECORDS;
+  record->start_ = start;
+  record->end_ = end;
+  record->dma_wait_ = g_thinker_dma_wait - wait;
+  record->bytes_in_ = 0;
+  record->bytes_out_ = 0;
+  for (int32_t j = 0; j < op->num_input_ + op->num_output_; j++) {
+    tTensor *tensor = plan->tensors_[j];
+    uint64_t bytes = getShapeSize(&tensor->shape_) * (tensor->dtype_ & 0xFF);
+    if (j < op->num_input_) {
+      record->bytes_in_ += bytes;
+    } else {
+      record->bytes_out_ += bytes;
+    }
+  }
+  record->name_ = plan->api_->name();
+  record->forward_ = inst->profile_forward_;
+  record->tensor_id_ = op->num_output_ ? (int32_t)(plan->tensors_[op->num_input_] - inst->tensor_) : -1;
+  record->tensor_name_ = getTensorName(inst->model_, record->tensor_id_);
+  record->op_index_ = (uint16_t)i;
+}
+#endif
+
+#if THINKER_STATS
+/**
+ * Count one operator invocation and the bytes of its tensors
+ * @param inst Execution instance
+ * @param i Operator index
+ */
+static void recordStats(tExecInst *inst, const int32_t i) {
+  tOpPlan *plan = inst->op_plan_ + i;
+  tOperator *op = plan->op_;
+  tStats *stats = &inst->stats_;
+  THINKER_STATS_ADD(&inst->stats_ops_[i], 1);
+  THINKER_STATS_ADD(&stats->op_count_, 1);
+  for (int32_t j = 0; j < op->num_input_ + op->num_output_; j++) {
+    tTensor *tensor = plan->tensors_[j];
+    uint64_t bytes = getShapeSize(&tensor->shape_) * (tensor->dtype_ & 0xFF);
+    uint32_t type = (tensor->mem_.type_ <= SHARE_MEM) ? tensor->mem_.type_ : SHARE_MEM;
+    if (j < op->num_input_) {
+      THINKER_STATS_ADD(&stats->bytes_read_, bytes);
+      THINKER_STATS_ADD(&stats->mem_read_[type], bytes);
+    } else {
+      THINKER_STATS_ADD(&stats->bytes_written_, bytes);
+      THINKER_STATS_ADD(&stats->mem_written_[type], bytes);
+    }
+  }
+}
+#endif
+
+#if THINKER_SCHED_ENABLE
+/**
+ * Scheduler entry running one operator of the execution plan
+ * @param ctx Execution instance
+ * @param i Operator index
+ * @return Status code
+ */
+static tStatus runPlanOp(void *ctx, int32_t i) {
+  tExecInst *inst = (tExecInst *)ctx;
+  tOpPlan *plan = inst->op_plan_ + i;
+  if (T_FORCE_STOP_VALUE == inst->force_stop_flag) {
+    return (tStatus)T_FORCE_STOP_VALUE;
+  }
+#if THINKER_PROFILE
+  uint64_t profile_start = tick_count();
+  uint64_t profile_wait = g_thinker_dma_wait;
+#endif
+#if THINKER_STATS
+  // worker threads count into the executor only while they run its operator
+  tStats *prev_stats = g_thinker_stats;
+  g_thinker_stats = &inst->stats_;
+#endif
+  tStatus ret = plan->forward_(plan->op_, plan->tensors_, plan->num_tensor_, inst->dma_list_);
+#if THINKER_STATS
+  g_thinker_stats = prev_stats;
+#endif
+  if (ret != T_SUCCESS) {
+    printf("forward error code :%d, op index :%d, op name: %s\n", ret, i,
+           plan->api_->name());
+  }
+#if THINKER_PROFILE
+  recordProfile(inst, i, profile_start, profile_wait);
+#endif
+#if THINKER_STATS
+  recordStats(inst, i);
+#endif
+  return ret;
+}
+#endif
+
+/**
+ * Run the operators of one forward pass
+ * @param inst Execution instance
+ * @return Status code
+ */
+static tStatus runForward(tExecInst *inst) {
+  tStatus ret = T_SUCCESS;
+  tModel *model = inst->model_;
+  int32_t i;
+
+  syncBoundIO(inst, 0);
+  if (inst->state_ready_) {
+    swapStates(inst);
+    inst->state_ready_ = 0;
+  }
+#if THINKER_PROFILE
+  inst->profile_forward_++;
+#endif
+#if THINKER_STATS
+  inst->stats_.forward_++;
+#endif
+
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  if (inst->dma_list_->total_ > 0) {
+    startWeightDMA(inst, 0);
+  }
+  inst->dma_list_->act_cout_ = 0;
+  inst->dma_list_->act_ready_ = 0;
+#endif
+
+#if THINKER_SCHED_ENABLE
+  ret = sched_run(&inst->sched_, runPlanOp, inst);
+  if (ret != T_SUCCESS) {
+    if (T_FORCE_STOP_VALUE == ret) {
+      waitPendingDMA(inst);
+    }
+    return ret;
+  }
+#else
+  for (i = 0; i < model->num_operator_; ++i) {
+    tOpPlan *plan = inst->op_plan_ + i;
+    tOperator *op = plan->op_;
+    tTensor **local_tensor = plan->tensors_;
+    tOperatorAPI *op_api = plan->api_;
+
+    if (T_FORCE_STOP_VALUE == inst->force_stop_flag)  //user force to stop
+    {
+        waitPendingDMA(inst);
+        return T_FORCE_STOP_VALUE;
+    }
+
+#if THINKER_PROFILE
+    uint64_t profile_start = tick_count();
+    uint64_t profile_wait = g_thinker_dma_wait;
+#endif
+    ret = plan->forward_(op, local_tensor, plan->num_tensor_, inst->dma_list_);
+  //  printf("[%d]op_name:%s\n", i, op_api->name());
+    if (ret != T_SUCCESS) {
+      printf("forward error code :%d, op index :%d, op name: %s\n", ret, i,
+             op_api->name());
+      return ret;
+    }
+#if THINKER_PROFILE
+    recordProfile(inst, i, profile_start, profile_wait);
+#endif
+#if THINKER_STATS
+    recordStats(inst, i);
+#endif
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+    if (inst->dma_list_->act_total_ > 0) {
+      stepActivationData(inst->dma_list_, i);
+    }
+    // buffers read by the op are free now, keep the channel busy across ops without weights
+    if (inst->dma_list_->total_ > 0) {
+      prefetchWeightData(inst->dma_list_, 0);
+    }
+#endif
+#if THINKER_DUMP 
+#if (defined(WIN32) || defined(linux))
+    for (size_t j = 0; j < op->num_output_; j++) {
+      tTensor *out_tensor = local_tensor[op->num_input_ + j];
+      const char *tensor_name = getTensorName(model, (int32_t)(out_tensor - inst->tensor_));
+      if (tensor_name != NULL) {
+        write_file((char *)tensor_name, out_tensor);
+      }
+    }
+#endif
+#endif
+
+#ifdef THINKER_RESULT_CRC_PRINT
+    for (size_t j = 0; j < op->num_output_; j++) {
+      tTensor *out_tensor = local_tensor[op->num_input_ + j];
+      const char *tensor_name = getTensorName(model, (int32_t)(out_tensor - inst->tensor_));
+      uint8_t *data = (uint8_t *)out_tensor->dptr_;
+      uint32_t data_size = getTensorSize(out_tensor)*out_tensor->byte_;
+#if !(defined(WIN32) || defined(linux))
+#if THINKER_USE_ARCS
+		if (((uint32_t)(out_tensor->dptr_) & 0x28000000) == 0x28000000)
+		{
+			HAL_FlushDCache_by_Addr((uint32_t *)(out_tensor->dptr_), data_size);
+		}
+#elif THINKER_USE_VENUSA
+		if (((uint32_t)(out_tensor->dptr_) & 0x38000000) == 0x38000000)
+		{
+			HAL_FlushInvalidateDCache_by_Addr((uint32_t *)(out_tensor->dptr_), data_size);
+		}
+#endif
+#endif
+      int32_t result_crc = crc32_calc(data, data_size);
+      printf("crc32_calc = 0x%08x, data = [0x%08x-0x%08x-0x%08x], name = %s\n", result_crc,
+            ((uint32_t *)(data))[0], ((uint32_t *)(data + data_size / 2))[0],
+            ((uint32_t *)(data + data_size - 4))[0], tensor_name ? tensor_name : "");
+    }
+#endif
+  }
+#endif  // THINKER_SCHED_ENABLE
+
+  syncBoundIO(inst, 1);
+  inst->state_ready_ = (model->num_state_ > 0);
+  return T_SUCCESS;
+}
+
+/**
+ * Execute forward pass
+ * @param hdl Execution handle
+ * @return Status code
+ */
+tStatus tForward(const tExecHandle hdl) {
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+#if THINKER_STATS
+  // operator copies count into this executor until the forward returns
+  tStats *prev_stats = g_thinker_stats;
+  g_thinker_stats = &inst->stats_;
+#endif
+  tStatus ret = runForward(inst);
+#if THINKER_STATS
+  g_thinker_stats = prev_stats;
+#endif
+  return ret;
+}
+
+#if defined(linux)
+/**
+ * Worker job of tForwardAsync
+ * The executor is marked idle before the callback runs, so the callback can
+ * read outputs, call tWait or chain the next tForwardAsync. Waiters on other
+ * threads are held until the callback returned.
+ * @param arg Execution instance
+ */
+static void forwardAsyncJob(void *arg) {
+  tExecInst *inst = (tExecInst *)arg;
+  tExecHandle hdl = ~((tExecHandle)inst);
+  tAsyncCtx *ctx = &inst->async_;
+  tStatus ret = tForward(hdl);
+
+  pthread_mutex_lock(&ctx->lock_);
+  tForwardCallback callback = ctx->callback_;
+  void *user = ctx->user_;
+  ctx->status_ = ret;
+  ctx->busy_ = 0;
+  if (callback != NULL) {
+    ctx->in_callback_++;
+  }
+  pthread_cond_broadcast(&ctx->done_cond_);
+  pthread_mutex_unlock(&ctx->lock_);
+
+  if (callback != NULL) {
+    t_callback_ctx = ctx;
+    callback(hdl, ret, user);
+    t_callback_ctx = NULL;
+    pthread_mutex_lock(&ctx->lock_);
+    ctx->in_callback_--;
+    pthread_cond_broadcast(&ctx->done_cond_);
+    pthread_mutex_unlock(&ctx->lock_);
+  }
+}
+#endif
+
+/**
+ * Execute forward pass on a worker thread
+ * @param hdl Execution handle
+ * @param callback Called on the worker thread when forward finished, may be NULL
+ * @param user User data passed to callback
+ * @return Status code
+ */
+tStatus tForwardAsync(const tExecHandle hdl, tForwardCallback callback, void *user) {
+#if defined(linux)
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+
+  tStatus ret = worker_pool_init();
+  if (ret != T_SUCCESS) {
+    return ret;
+  }
+
+  tAsyncCtx *ctx = &inst->async_;
+  pthread_mutex_lock(&ctx->lock_);
+  if (ctx->busy_) {
+    pthread_mutex_unlock(&ctx->lock_);
+    return T_ERR_EXEC_BUSY;
+  }
+  ctx->busy_ = 1;
+  ctx->callback_ = callback;
+  ctx->user_ = user;
+  pthread_mutex_unlock(&ctx->lock_);
+
+  ret = worker_pool_submit(forwardAsyncJob, inst);
+  if (ret != T_SUCCESS) {
+    pthread_mutex_lock(&ctx->lock_);
+    ctx->busy_ = 0;
+    pthread_cond_broadcast(&ctx->done_cond_);
+    pthread_mutex_unlock(&ctx->lock_);
+  }
+  return ret;
+#else
+  return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Wait for the forward pass started by tForwardAsync
+ * @param hdl Execution handle
+ * @return Status code of the finished forward pass
+ */
+tStatus tWait(const tExecHandle hdl) {
+#if defined(linux)
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+
+  tAsyncCtx *ctx = &inst->async_;
+  pthread_mutex_lock(&ctx->lock_);
+  // a callback only waits for the forward it chained, never for callbacks
+  while (ctx->busy_ || (ctx->in_callback_ > 0 && t_callback_ctx != ctx)) {
+    pthread_cond_wait(&ctx->done_cond_, &ctx->lock_);
+  }
+  tStatus ret = ctx->status_;
+  pthread_mutex_unlock(&ctx->lock_);
+  return ret;
+#else
+  return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Address of a runtime tensor in the memory copy of one batch sample
+ * @param inst Execution instance
+ * @param tensor Tensor of the instance
+ * @param sample Sample slot
+ * @return Address, NULL if the tensor is shared by all samples
+ */
+static int8_t *getBatchTensorPtr(tExecInst *inst, const tTensor *tensor, const int32_t sample) {
+  tModel *model = inst->model_;
+  if (tensor->mem_id_ < model->num_shared_memory_) {
+    return NULL;
+  }
+
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  // prefetched weights are shared by all samples
+  for (uint32_t k = 0; k < inst->dma_list_->total_; k++) {
+    if (inst->dma_list_->dma_[k].dst_tensors_ == tensor) {
+      return NULL;
+    }
+  }
+#endif
+
+  int8_t *ptr = inst->batch_buf_ + sample * inst->batch_stride_;
+  for (int32_t j = model->num_shared_memory_; j < model->num_memory_; j++) {
+    if (model->memory_[j].dev_type_ == tensor->mem_.type_) {
+      return ptr + model->tensor_[tensor - inst->tensor_].offset_;
+    }
+    ptr += ALIGN16(model->memory_[j].size_);
+  }
+  return NULL;
+}
+
+/**
+ * Move tensors between the runtime memory and the memory copy of a sample
+ * @param inst Execution instance
+ * @param tensors Tensors to move
+ * @param num_tensor Number of tensors
+ * @param sample Sample slot
+ * @param is_save 0: sample copy to runtime memory, 1: runtime memory to sample copy
+ */
+static void syncBatchTensors(tExecInst *inst, tTensor **tensors, const int32_t num_tensor,
+                             const int32_t sample, const int32_t is_save) {
+  for (int32_t t = 0; t < num_tensor; t++) {
+    tTensor *tensor = tensors[t];
+    int8_t *copy = getBatchTensorPtr(inst, tensor, sample);
+    uint64_t bytes = getTensorSize(tensor) * tensor->byte_;
+    if (copy == NULL || bytes == 0) {
+      continue;
+    }
+    if (is_save) {
+      memcpy(copy, (void *)tensor->dptr_, bytes);
+    } else {
+      copyTensorData((void *)tensor->dptr_, copy, bytes);
+    }
+    THINKER_STATS_COUNT(&inst->stats_, memcpy, bytes);
+  }
+}
+
+/**
+ * Run one operator for every sample of a batch group
+ * Weights fetched for the operator stay in their DMA buffer, so the DMA
+ * cursor is parked at the end of the list while the other samples run.
+ * Operators streaming several DMA entries reuse their buffers and have the
+ * prefetch replayed for every sample instead.
+ * @param inst Execution instance
+ * @param i Operator index
+ * @param num_sample Number of samples in the group
+ * @return Status code
+ */
+static tStatus runBatchOp(tExecInst *inst, const int32_t i, const int32_t num_sample) {
+  tOpPlan *plan = inst->op_plan_ + i;
+  int32_t num_input = plan->op_->num_input_;
+  int32_t num_output = plan->op_->num_output_;
+  tStatus ret = T_SUCCESS;
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  tDMA_List *dma_list = inst->dma_list_;
+  uint32_t first = dma_list->use_;
+#endif
+#if THINKER_PROFILE
+  uint64_t profile_start = tick_count();
+  uint64_t profile_wait = g_thinker_dma_wait;
+#endif
+
+  for (int32_t s = 0; s < num_sample; s++) {
+    if (num_sample > 1) {
+      syncBatchTensors(inst, plan->tensors_, num_input, s, 0);
+    }
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+    if (s > 0 && dma_list->use_ - first > 1) {
+      // prefetch of later entries may have refilled the first buffers of the op
+      waitWeightData(dma_list);
+      startWeightDMA(inst, first);
+    } else if (s > 0) {
+      dma_list->use_ = first;
+    }
+#endif
+    ret = plan->forward_(plan->op_, plan->tensors_, plan->num_tensor_, inst->dma_list_);
+    if (ret != T_SUCCESS) {
+      printf("forward error code :%d, op index :%d, op name: %s\n", ret, i,
+             plan->api_->name());
+      return ret;
+    }
+    if (num_sample > 1) {
+      syncBatchTensors(inst, plan->tensors_ + num_input, num_output, s, 1);
+    }
+#if THINKER_STATS
+    recordStats(inst, i);
+#endif
+  }
+#if THINKER_PROFILE
+  recordProfile(inst, i, profile_start, profile_wait);
+#endif
+  return ret;
+}
+
+/**
+ * Run one group of samples operator by operator
+ * @param inst Execution instance
+ * @param inputs Inputs of the group, num_sample * num_input entries
+ * @param outputs Outputs of the group, num_sample * num_output entries
+ * @param num_sample Number of samples, at most THINKER_BATCH_MAX
+ * @return Status code
+ */
+static tStatus runBatchGroup(tExecInst *inst, const tData *inputs, tData *outputs,
+                             const int32_t num_sample) {
+  tModel *model = inst->model_;
+  tExecHandle hdl = ~((tExecHandle)inst);
+  int32_t num_input = model->num_input_;
+  int32_t num_output = model->num_output_;
+  tStatus ret = T_SUCCESS;
+  int32_t i, s;
+
+  for (s = 0; s < num_sample; s++) {
+    const tData *sample_inputs = inputs + s * num_input;
+    for (i = 0; i < num_input; i++) {
+      // state inputs are carried over from the previous sample
+      if (isStateTensor(model, model->io_tensors_[i])) {
+        continue;
+      }
+      // all samples of a group share the shapes of the first one
+      if (!equalShape((tShape *)&inputs[i].shape_, (tShape *)&sample_inputs[i].shape_)) {
+        return T_ERR_INVALID_DATA;
+      }
+      ret = tSetInput(hdl, i, sample_inputs + i);
+      if (ret != T_SUCCESS) {
+        return ret;
+      }
+      if (num_sample > 1) {
+        tTensor *tensor = inst->tensor_ + model->io_tensors_[i];
+        syncBatchTensors(inst, &tensor, 1, s, 1);
+      }
+    }
+  }
+
+  if (inst->state_ready_) {
+    swapStates(inst);
+    inst->state_ready_ = 0;
+  }
+#if THINKER_PROFILE
+  inst->profile_forward_++;
+#endif
+
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  if (inst->dma_list_->total_ > 0) {
+    startWeightDMA(inst, 0);
+  }
+#endif
+
+  for (i = 0; i < model->num_operator_; i++) {
+    if (T_FORCE_STOP_VALUE == inst->force_stop_flag) {
+      waitPendingDMA(inst);
+      return T_FORCE_STOP_VALUE;
+    }
+    ret = runBatchOp(inst, i, num_sample);
+    if (ret != T_SUCCESS) {
+      return ret;
+    }
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+    if (inst->dma_list_->total_ > 0) {
+      prefetchWeightData(inst->dma_list_, 0);
+    }
+#endif
+  }
+
+  for (s = 0; s < num_sample; s++) {
+    for (i = 0; i < num_output; i++) {
+      tTensor *tensor = inst->tensor_ + model->io_tensors_[num_input + i];
+      tData *output = outputs + s * num_output + i;
+      int8_t *src = (num_sample > 1) ? getBatchTensorPtr(inst, tensor, s) : NULL;
+      uint64_t bytes = getShapeSize(&tensor->shape_) * (tensor->dtype_ & 0xFF);
+      memcpy(output->dptr_, src ? (void *)src : (void *)tensor->dptr_, bytes);
+      THINKER_STATS_COUNT(&inst->stats_, io, bytes);
+      output->dtype_ = tensor->dtype_;
+      output->shape_ = tensor->shape_;
+      output->scale_ = tensor->scale_;
+    }
+  }
+
+  inst->state_ready_ = (model->num_state_ > 0);
+  return T_SUCCESS;
+}
+
+/**
+ * Execute forward pass for a batch of input sets
+ * Samples are run in groups of up to THINKER_BATCH_MAX, every operator is
+ * executed for all samples of a group before moving on to the next one so
+ * its weights are fetched once per group. Models with recurrent states run
+ * sample by sample.
+ * @param hdl Execution handle
+ * @param inputs Input data, num_batch * input count entries, sample major
+ * @param outputs Caller buffers receiving output data, num_batch * output count entries
+ * @param num_batch Number of samples
+ * @return Status code
+ */
+tStatus tForwardBatch(const tExecHandle hdl, const tData *inputs, tData *outputs,
+                      const int32_t num_batch) {
+  tExecInst *inst = (tExecInst *)~hdl;
+  if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
+    return T_ERR_INVALID_INST;
+  }
+
+  if (inputs == NULL || outputs == NULL || num_batch <= 0) {
+    return T_ERR_INVALID_PARA;
+  }
+
+  tModel *model = inst->model_;
+  int32_t num_io = model->num_input_ + model->num_output_;
+  int32_t i;
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+  // spilled activations are not sliced per sample
+  if (inst->dma_list_->act_total_ > 0) {
+    return T_ERR_NO_IMPLEMENTED;
+  }
+#endif
+  for (i = 0; i < num_batch * model->num_output_; i++) {
+    if (outputs[i].dptr_ == NULL) {
+      return T_ERR_INVALID_DATA;
+    }
+  }
+
+  // batch data goes through the planned buffers, bindings are restored afterwards;
+  // state tensors can not be bound and keep the buffers swapped by the last forward
+  for (i = 0; i < num_io; i++) {
+    if (isStateTensor(model, model->io_tensors_[i])) {
+      continue;
+    }
+    inst->tensor_[model->io_tensors_[i]].dptr_ = inst->io_bind_[i].plan_ptr_;
+  }
+
+#if THINKER_STATS
+  tStats *prev_stats = g_thinker_stats;
+  g_thinker_stats = &inst->stats_;
+  inst->stats_.forward_ += num_batch;
+#endif
+  int32_t group = (model->num_state_ > 0) ? 1 : THINKER_BATCH_MAX;
+  tStatus ret = T_SUCCESS;
+  for (int32_t b = 0; b < num_batch && ret == T_SUCCESS; b += group) {
+    int32_t num_sample = (num_batch - b < group) ? (num_batch - b) : group;
+    ret = runBatchGroup(inst, inputs + b * model->num_input_,
+                        outputs + b * model->num_output_, num_sample);
+  }
+#if THINKER_STATS
+  g_thinker_stats = prev_stats;
+#endif
+
+  for (i = 0; i < num_io; i++) {
+    tIOBind *bind = inst->io_bind_ + i;
+    if (bind->bind_ptr_ && !bind->copy_) {
+      inst->tensor_[model->io_tensors_[i]].dptr_ = bind->bind_ptr_;
+    }
+  }
+  return ret;
+}
+
+#if THINKER_REPLAN_ENABLE
+/**
+ * Order tensors of an arena by static offset and first operator so aliases are adjacent
+ */
+static int compareReplanKey(const void *a, const void *b) {
+  const tReplanGroup *x = (const tReplanGroup *)a;
+  const tReplanGroup *y = (const tReplanGroup *)b;
+  if (x->offset_ != y->offset_) {
+    return (x->offset_ < y->offset_) ? -1 : 1;
+  }
+  if (TENSOR_LIFE_BEGIN(x->life_) != TENSOR_LIFE_BEGIN(y->life_)) {
+    return (TENSOR_LIFE_BEGIN(x->life_) < TENSOR_LIFE_BEGIN(y->life_)) ? -1 : 1;
+  }
+  return x->id_ - y->id_;
+}
+
+/**
+ * Order groups for placement: states, graph inputs by static offset, then others by size
+ */
+static int compareReplanOrder(const void *a, const void *b) {
+  const tReplanGroup *x = (const tReplanGroup *)a;
+  const tReplanGroup *y = (const tReplanGroup *)b;
+  if (x->rank_ != y->rank_) {
+    return x->rank_ - y->rank_;
+  }
+  if (x->rank_ == 2 && x->size_ != y->size_) {
+    return (x->size_ > y->size_) ? -1 : 1;
+  }
+  if (x->offset_ != y->offset_) {
+    return (x->offset_ < y->offset_) ? -1 : 1;
+  }
+  return x->id_ - y->id_;
+}
+
+/**
+ * Bytes of a tensor rounded up to 16
+ * @param tensor Tensor
+ * @return Size in bytes
+ */
+static uint64_t getTensorBytes(const tTensor *tensor) {
+  return ALIGN16(getShapeSize((tShape *)&tensor->shape_) * (uint64_t)(tensor->dtype_ & 0xFF));
+}
+
+/**
+ * Check whether two liveness intervals share an operator
+ * @param a Packed liveness
+ * @param b Packed liveness
+ * @return 1 if overlapped, otherwise 0
+ */
+static int32_t lifeOverlap(const uint32_t a, const uint32_t b) {
+  return TENSOR_LIFE_BEGIN(a) <= TENSOR_LIFE_END(b) && TENSOR_LIFE_BEGIN(b) <= TENSOR_LIFE_END(a);
+}
+
+/**
+ * Move graph inputs already written by tSetInput to their new place.
+ * Inputs are placed by first fit in static offset order with their maximum
+ * size, so their new offsets never exceed the static ones and the other way
+ * round. Moving down in ascending and up in descending static order never
+ * overwrites an input that has not moved yet.
+ * @param inst Execution instance
+ * @param groups Sorted groups of the arena
+ * @param num_group Number of groups
+ * @param base Arena address
+ */
+static void moveReplanInputs(tExecInst *inst, const tReplanGroup *groups,
+                             const int32_t num_group, const addr_type base) {
+  tModel *model = inst->model_;
+  int32_t pass, g;
+  for (pass = 0; pass < 2; pass++) {
+    for (g = 0; g < num_group; g++) {
+      const tReplanGroup *group = groups + (pass ? num_group - 1 - g : g);
+      if (group->input_ < 0) {
+        continue;
+      }
+      tIOBind *bind = inst->io_bind_ + group->input_;
+      addr_type src = bind->plan_ptr_;
+      addr_type dst = base + group->place_;
+      if (bind->bind_ptr_ != 0 || (pass == 0 && dst >= src) || (pass == 1 && dst <= src)) {
+        continue;
+      }
+      tTensor *tensor = inst->tensor_ + model->io_tensors_[group->input_];
+      memmove((void *)dst, (void *)src, getTensorBytes(tensor));
+    }
+  }
+}
+
+/**
+ * Re-plan tensor offsets of one runtime arena for the current shapes.
+ * In-place alias chains share a static offset and overlapping lives, tpacker
+ * extends the lives along each chain only, so siblings may still differ.
+ * Tensors at one offset whose lives overlap are merged into one group that
+ * lives for their union; tensors reusing an offset never overlap.
+ * Groups are placed by offset-based first fit against groups alive at the
+ * same time; state tensors keep their static offsets. The static plan is
+ * restored when the new plan does not fit into the arena.
+ * @param inst Execution instance
+ * @param j Index of the runtime memory
+ */
+static void replanArena(tExecInst *inst, const int32_t j) {
+  tModel *model = inst->model_;
+  tMemory *memory = inst->memory_ + j;
+  tReplanGroup *groups = inst->replan_;
+  int32_t *group_of = inst->replan_index_;
+  int32_t *order = inst->replan_index_ + model->num_tensor_;
+  int32_t num_group = 0;
+  int32_t i, k;
+
+  for (i = 0; i < model->num_tensor_; i++) {
+    const tTensor *plan = model->tensor_ + i;
+    group_of[i] = -1;
+    if (plan->mem_id_ < model->num_shared_memory_ || plan->mem_.type_ != memory->dev_type_) {
+      continue;
+    }
+    tReplanGroup *group = groups + num_group++;
+    group->offset_ = plan->offset_;
+    group->size_ = getTensorBytes(inst->tensor_ + i);
+    group->max_size_ = getTensorBytes(plan);
+    group->life_ = plan->life_;
+    group->rank_ = 2;
+    group->id_ = i;
+    group->input_ = -1;
+  }
+  if (num_group == 0) {
+    return;
+  }
+
+  // merge aliases, group_of maps tensors to groups
+  qsort(groups, num_group, sizeof(tReplanGroup), compareReplanKey);
+  k = 0;
+  for (i = 0; i < num_group; i++) {
+    tReplanGroup *group = groups + i;
+    int32_t tensor_id = group->id_;
+    if (k > 0 && groups[k - 1].offset_ == group->offset_ &&
+        TENSOR_LIFE_BEGIN(group->life_) <= TENSOR_LIFE_END(groups[k - 1].life_)) {
+      tReplanGroup *prev = groups + k - 1;
+      prev->size_ = (group->size_ > prev->size_) ? group->size_ : prev->size_;
+      prev->max_size_ = (group->max_size_ > prev->max_size_) ? group->max_size_ : prev->max_size_;
+      if (TENSOR_LIFE_END(group->life_) > TENSOR_LIFE_END(prev->life_)) {
+        prev->life_ = (prev->life_ & ~(0x7FFFu << 16)) | (group->life_ & (0x7FFFu << 16));
+      }
+    } else {
+      groups[k] = *group;
+      groups[k].id_ = k;
+      k++;
+    }
+    group_of[tensor_id] = k - 1;
+  }
+  num_group = k;
+
+  for (i = 0; i < model->num_state_; i++) {
+    int32_t in = group_of[model->states_[i].input_tensor_id];
+    int32_t out = group_of[model->states_[i].output_tensor_id];
+    if (in >= 0) groups[in].rank_ = 0;
+    if (out >= 0) groups[out].rank_ = 0;
+  }
+  for (i = 0; i < model->num_input_; i++) {
+    int32_t g = group_of[model->io_tensors_[i]];
+    if (g >= 0 && groups[g].rank_ != 0) {
+      groups[g].rank_ = 1;
+      groups[g].input_ = i;
+    }
+  }
+  for (i = 0; i < num_group; i++) {
+    // inputs may be set before tUpdateShape, states persist, both keep room for any shape
+    if (groups[i].rank_ < 2) {
+      groups[i].size_ = groups[i].max_size_;
+    }
+  }
+
+  qsort(groups, num_group, sizeof(tReplanGroup), compareReplanOrder);
+  for (i = 0; i < num_group; i++) {
+    order[groups[i].id_] = i;
+  }
+  for (i = 0; i < model->num_tensor_; i++) {
+    if (group_of[i] >= 0) {
+      group_of[i] = order[group_of[i]];
+    }
+  }
+
+  // offset-based first fit, order keeps placed groups sorted by offset
+  uint64_t peak = 0;
+  int32_t num_placed = 0;
+  for (i = 0; i < num_group; i++) {
+    tReplanGroup *group = groups + i;
+    uint64_t offset = 0;
+    if (group->rank_ == 0) {
+      offset = group->offset_;
+    } else {
+      for (k = 0; k < num_placed; k++) {
+        const tReplanGroup *placed = groups + order[k];
+        if (!lifeOverlap(group->life_, placed->life_)) {
+          continue;
+        }
+        if (offset + group->size_ <= placed->place_) {
+          break;
+        }
+        if (offset < placed->place_ + placed->size_) {
+          offset = placed->place_ + placed->size_;
+        }
+      }
+    }
+    group->place_ = offset;
+    if (peak < offset + group->size_) {
+      peak = offset + group->size_;
+    }
+    for (k = num_placed; k > 0 && groups[order[k - 1]].place_ > offset; k--) {
+      order[k] = order[k - 1];
+    }
+    order[k] = i;
+    num_placed++;
+  }
+
+  if (peak > memory->size_) {
+    for (i = 0; i < num_group; i++) {
+      groups[i].place_ = groups[i].offset_;
+    }
+    peak = model->memory_[j].size_;
+  }
+  inst->mem_peak_[j] = peak;
+
+  moveReplanInputs(inst, groups, num_group, memory->dptr_);
+
+  for (i = 0; i < model->num_tensor_; i++) {
+    int32_t g = group_of[i];
+    if (g >= 0 && groups[g].rank_ != 0) {
+      inst->tensor_[i].dptr_ = memory->dptr_ + groups[g].place_;
+    }
+  }
+  for (i = 0; i < model->num_input_ + model->num_output_; i++) {
+    tIOBind *bind = inst->io_bind_ + i;
+    tTensor *tensor = inst->tensor_ + model->io_tensors_[i];
+    int32_t g = group_of[model->io_tensors_[i]];
+    if (g < 0 || groups[g].rank_ == 0) {
+      continue;
+    }
+    bind->plan_ptr_ = tensor->dptr_;
+    if (bind->bind_ptr_ && !bind->copy_) {
+      tensor->dptr_ = bind->bind_ptr_;
+    }
+  }
+}
+
+/**
+ * Re-plan runtime memory after the dims of the tensors changed
+ * @param inst Execution instance
+ */
+static void replanMemory(tExecInst *inst) {
+  tModel *model = inst->model_;
+  int32_t i, j;
+
+  // resources packed without liveness keep the static plan
+  for (i = 0; i < model->num_tensor_; i++) {
+    const tTensor *plan = model->tensor_ + i;
+    if (plan->mem_id_ >= model->num_shared_memory_ && !(plan->life_ & TENSOR_LIFE_VALID)) {
+      return;
+    }
+  }
+
+  for (j = model->num_shared_memory_; j < model->num_memory_; j++) {
+    // tensors live in the first runtime memory of their device type
+    for (i = model->num_shared_memory_; i < j; i++) {
+      if (model->memory_[i].dev_type_ == model->memory_[j].dev_type_) {
+        break;
+      }
+    }
+    if (i == j) {
+      replanArena(inst, j);
+    }
+  }
+}
+#endif  // THINKER_REPLAN_ENABLE
+
+/**
+ * Update dynamic shapes during execution
+ * @param hdl Execution handle
+ * @param axis_names Array of axis names
+ * @param axis_sizes Array of axis sizes
+ * @param num Number of axes to update
+ * @return Status code
+ */
+tStatus tUpdateShape(tExecHandle hdl, const char **axis_names, const uint32_t *axis_sizes, int32_t num)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    tModel *model   = inst->model_;
+    tStatus ret     = T_SUCCESS;
+    if (num != 0)
+        ret = tSetShapeInferInputByNames(model->shape_infer, inst->shape_scalars_, axis_names, axis_sizes, num);
+    else
+        ret = tSetShapeInferInputByTensors(model->shape_infer, inst->shape_scalars_, inst->tensor_);
+    if (ret != T_SUCCESS) return ret;
+    ret = tShapeInferForwardCached(model->shape_infer, &inst->shape_cache_, inst->shape_scalars_, inst->tensor_);
+#if THINKER_REPLAN_ENABLE
+    if (ret == T_SUCCESS && inst->replan_stamp_ != inst->shape_cache_.stamp_)
+    {
+        replanMemory(inst);
+        inst->replan_stamp_ = inst->shape_cache_.stamp_;
+    }
+#endif
+    return ret;
+}
+
+/**
+ * Get peak usage of a runtime memory under the current plan
+ * @param hdl Execution handle
+ * @param dev_type Device type of the runtime memory
+ * @param peak Peak usage in bytes
+ * @return Status code
+ */
+tStatus tGetMemoryPeak(const tExecHandle hdl, const int32_t dev_type, uint64_t *peak)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+    if (peak == NULL)
+    {
+        return T_ERR_INVALID_PARA;
+    }
+
+    tModel *model = inst->model_;
+    for (int32_t j = model->num_shared_memory_; j < model->num_memory_; j++)
+    {
+        if (model->memory_[j].dev_type_ == dev_type)
+        {
+#if THINKER_REPLAN_ENABLE
+            *peak = inst->mem_peak_[j];
+#else
+            *peak = model->memory_[j].size_;
+#endif
+            return T_SUCCESS;
+        }
+    }
+    return T_ERR_INVALID_PARA;
+}
+
+/**
+ * Copy the most recent operator records, oldest first
+ * @param hdl Execution handle
+ * @param records Caller buffer
+ * @param num Capacity of records on input, number of records copied on output
+ * @return Status code
+ */
+tStatus tGetProfile(const tExecHandle hdl, tProfileRecord *records, int32_t *num)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+    if (records == NULL || num == NULL || *num < 0)
+    {
+        return T_ERR_INVALID_PARA;
+    }
+#if THINKER_PROFILE
+    uint32_t count = inst->profile_count_;
+    uint32_t avail = (count < THINKER_PROFILE_RECORDS) ? count : THINKER_PROFILE_RECORDS;
+    uint32_t copy = ((uint32_t)*num < avail) ? (uint32_t)*num : avail;
+    for (uint32_t k = 0; k < copy; k++)
+    {
+        records[k] = inst->profile_[(count - copy + k) % THINKER_PROFILE_RECORDS];
+    }
+    *num = (int32_t)copy;
+    return T_SUCCESS;
+#else
+    *num = 0;
+    return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Drop all operator records and DMA counters
+ * @param hdl Execution handle
+ * @return Status code
+ */
+tStatus tResetProfile(const tExecHandle hdl)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+#if THINKER_PROFILE
+    inst->profile_count_ = 0;
+    inst->profile_forward_ = 0;
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+    inst->dma_list_->wait_ = 0;
+    memset(inst->dma_list_->stat_, 0, sizeof(inst->dma_list_->stat_));
+#endif
+    return T_SUCCESS;
+#else
+    return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Copy the counters of the weight prefetch DMA entries
+ * The overlap is the share of the transfer time hidden behind compute,
+ * 1 - wait / busy summed over all entries, 1 when nothing was transferred.
+ * @param hdl Execution handle
+ * @param records Caller buffer, one record per DMA entry
+ * @param num Capacity of records on input, number of records copied on output
+ * @param overlap Output overlap efficiency of the model, 0 to 1
+ * @return Status code
+ */
+tStatus tGetDMAProfile(const tExecHandle hdl, tDMARecord *records, int32_t *num, float *overlap)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+    if (records == NULL || num == NULL || *num < 0 || overlap == NULL)
+    {
+        return T_ERR_INVALID_PARA;
+    }
+#if THINKER_PROFILE && (THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA)
+    tDMA_List *dma_list = inst->dma_list_;
+    uint32_t copy = ((uint32_t)*num < dma_list->total_) ? (uint32_t)*num : dma_list->total_;
+    uint64_t busy = 0;
+    uint64_t wait = 0;
+    for (uint32_t k = 0; k < dma_list->total_; k++)
+    {
+        busy += dma_list->stat_[k].busy_;
+        wait += dma_list->stat_[k].wait_;
+        if (k < copy)
+        {
+            records[k] = dma_list->stat_[k];
+            records[k].tensor_id_ = (int32_t)(dma_list->dma_[k].dst_tensors_ - inst->tensor_);
+        }
+    }
+    *num = (int32_t)copy;
+    *overlap = (busy > wait) ? (float)(busy - wait) / (float)busy : (busy ? 0.0f : 1.0f);
+    return T_SUCCESS;
+#else
+    *num = 0;
+    *overlap = 1.0f;
+    return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Copy the runtime counters of an executor
+ * @param hdl Execution handle
+ * @param stats Output counters
+ * @param op_counts Caller buffer for the invocations of each operator, may be NULL
+ * @param num Capacity of op_counts on input, number of operators copied on output
+ * @return Status code
+ */
+tStatus tGetStats(const tExecHandle hdl, tStats *stats, uint32_t *op_counts, int32_t *num)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+    if (stats == NULL || (op_counts != NULL && (num == NULL || *num < 0)))
+    {
+        return T_ERR_INVALID_PARA;
+    }
+#if THINKER_STATS
+    *stats = inst->stats_;
+    if (op_counts != NULL)
+    {
+        int32_t copy = (*num < inst->model_->num_operator_) ? *num : inst->model_->num_operator_;
+        memcpy(op_counts, inst->stats_ops_, copy * sizeof(uint32_t));
+        *num = copy;
+    }
+    return T_SUCCESS;
+#else
+    memset(stats, 0, sizeof(tStats));
+    if (op_counts != NULL)
+    {
+        *num = 0;
+    }
+    return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Zero the runtime counters of an executor
+ * @param hdl Execution handle
+ * @return Status code
+ */
+tStatus tResetStats(const tExecHandle hdl)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+#if THINKER_STATS
+    memset(&inst->stats_, 0, sizeof(inst->stats_));
+    memset(inst->stats_ops_, 0, inst->model_->num_operator_ * sizeof(uint32_t));
+    return T_SUCCESS;
+#else
+    return T_ERR_NO_IMPLEMENTED;
+#endif
+}
+
+/**
+ * Start execution
+ * @param hdl Execution handle
+ * @return Status code
+ */
+tStatus tExecutorStart(tExecHandle hdl)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+    inst->force_stop_flag = 0;
+    return T_SUCCESS;
+}
+
+/**
+ * Stop execution
+ * @param hdl Execution handle
+ * @return Status code
+ */
+tStatus tExecutorStop(tExecHandle hdl)
+{
+    tExecInst *inst = (tExecInst *)~hdl;
+    if (inst == NULL || inst->flag_ != THINKER_INST_FLAG)
+    {
+        return T_ERR_INVALID_INST;
+    }
+    inst->force_stop_flag = T_FORCE_STOP_VALUE;
+    return T_SUCCESS;
+}
+
+#if THINKER_USE_MTQ
+/**
+ * Get Luna list size information
+ * @param hdl Execution handle
+ * @param list_size Output list size
+ * @param list_length Output list length
+ * @param total_param Output total parameter size
  * @return Status code
  */
 tStatus tGetLunaListSize(const tExecHandle hdl, uint32_t *list_size, uint32_t *list_length, uint32_t *total_param) {
   tStatus ret = T_SUCCESS;
   tExecInst *inst = (tExecInst *)~hdl;
   tModel *model = inst->model_;
-  tTensor *local_tensor[512];
-  uint8_t *p_op = NULL;
   g_submit_pos = 0;
   g_param_size = 0;
   int32_t i;
   if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
     return T_ERR_INVALID_INST;
   }
-  p_op = model->op_buffer_;
+
+#if THINKER_USE_VENUSA
+  // activation transfers are not part of the command list
+  if (inst->dma_list_->act_total_ > 0) {
+    return T_ERR_NO_IMPLEMENTED;
+  }
+#endif
 
   luna_register_hook(luna_execute_cmd_hook_for_get_list_length, 0);
 
 #if THINKER_USE_VENUSA
-  #include "core/ops/venusA/luna/luna_misc_math.h"
-  tDMA_List *dma_list = inst->dma_list_;
-  if (dma_list->total_ > 0) {
-	  dma_list->cout_ = 0;
-	  int32_t index = dma_list->cout_;
-	  tTensor *src = dma_list->dma_[index].src_tensors_;
-	  tTensor *dst = dma_list->dma_[index].dst_tensors_;
-	  int32_t size = dma_list->dma_[index].size_;
-    if (size > 0) {
-      dma_cpy_async(5, (int8_t *)dst->dptr_, (int8_t *)src->dptr_, size);
-      dma_list->cout_++;
-    }
+  if (inst->dma_list_->total_ > 0) {
+    startWeightDMA(inst, 0);
   }
 #endif // defined(THINKER_USE_VENUSA)
 
   for (i = 0; i < model->num_operator_; ++i) {
-    int32_t ii = 0;
-    tOperator *op = (tOperator *)p_op;
-    uint32_t *tensor_ids = (uint32_t *)(p_op + op->tensor_offset_);
-    uint32_t num_tensor = op->num_input_ + op->num_output_ + op->num_temp_;
-    tOperatorAPI *op_api = model->op_api_[op->op_id_];
+    tOpPlan *plan = inst->op_plan_ + i;
+    tOperatorAPI *op_api = plan->api_;
 
     if (T_FORCE_STOP_VALUE == inst->force_stop_flag)  //user force to stop
     {
 #if THINKER_USE_VENUSA
-    if (dma_list->cout_ && (dma_list->cout_ < dma_list->total_))
-		{
-      dma_wait_complete(5);
-		}
+      waitPendingDMA(inst);
 #endif // defined(THINKER_USE_VENUSA)
         return T_FORCE_STOP_VALUE;
     }
 
-    for (ii = 0; ii < num_tensor; ++ii) {
-      local_tensor[ii] = inst->tensor_ + tensor_ids[ii];
-    }
-
-    ret = op_api->forward(op, local_tensor, num_tensor, inst->dma_list_);
+    ret = plan->forward_(plan->op_, plan->tensors_, plan->num_tensor_, inst->dma_list_);
   //  printf("[%d]op_name:%s\n", i, op_api->name());
     if (ret != T_SUCCESS) {
       printf("forward error code :%d, op index :%d, op name: %s\n", ret, i,
              op_api->name());
       return ret;
     }
-
-    p_op += op->total_size_;
   }
 
   luna_register_hook(0, 0);
@@ -1174,65 +3255,45 @@ tStatus tBuildLunaList(const tExecHandle hdl, int8_t *base_addr, uint32_t sq_len
   tStatus ret = T_SUCCESS;
   tExecInst *inst = (tExecInst *)~hdl;
   tModel *model = inst->model_;
-  tTensor *local_tensor[512];
-  uint8_t *p_op = NULL;
   int32_t i;
   if (inst == NULL || inst->flag_ != THINKER_INST_FLAG) {
     return T_ERR_INVALID_INST;
   }
-  p_op = model->op_buffer_;
+
+#if THINKER_USE_VENUSA
+  // activation transfers are not part of the command list
+  if (inst->dma_list_->act_total_ > 0) {
+    return T_ERR_NO_IMPLEMENTED;
+  }
+#endif
 
   luna_register_hook(luna_execute_cmd_hook_for_build_list, 0);
 
 #if THINKER_USE_VENUSA
-  #include "core/ops/venusA/luna/luna_misc_math.h"
-  tDMA_List *dma_list = inst->dma_list_;
-  if (dma_list->total_ > 0) {
-	  dma_list->cout_ = 0;
-	  int32_t index = dma_list->cout_;
-	  tTensor *src = dma_list->dma_[index].src_tensors_;
-	  tTensor *dst = dma_list->dma_[index].dst_tensors_;
-	  int32_t size = dma_list->dma_[index].size_;
-    if (size > 0) {
-      dma_cpy_async(5, (int8_t *)dst->dptr_, (int8_t *)src->dptr_, size);
-      dma_list->cout_++;
-    }
+  if (inst->dma_list_->total_ > 0) {
+    startWeightDMA(inst, 0);
   }
 #endif // defined(THINKER_USE_VENUSA)
 
   for (i = 0; i < model->num_operator_; ++i) {
-    int32_t ii = 0;
-    tOperator *op = (tOperator *)p_op;
-    uint32_t *tensor_ids = (uint32_t *)(p_op + op->tensor_offset_);
-    uint32_t num_tensor = op->num_input_ + op->num_output_ + op->num_temp_;
-    tOperatorAPI *op_api = model->op_api_[op->op_id_];
+    tOpPlan *plan = inst->op_plan_ + i;
+    tOperatorAPI *op_api = plan->api_;
 
     if (T_FORCE_STOP_VALUE == inst->force_stop_flag)  //user force to stop
     {
 #if THINKER_USE_VENUSA
-    if (dma_list->cout_ && (dma_list->cout_ < dma_list->total_))
-		{
-      dma_wait_complete(5);
-		}
+      waitPendingDMA(inst);
 #endif // defined(THINKER_USE_VENUSA)
         return T_FORCE_STOP_VALUE;
     }
 
-    for (ii = 0; ii < num_tensor; ++ii) {
-      local_tensor[ii] = inst->tensor_ + tensor_ids[ii];
-    }
-
-    ret = op_api->forward(op, local_tensor, num_tensor, inst->dma_list_);
+    ret = plan->forward_(plan->op_, plan->tensors_, plan->num_tensor_, inst->dma_list_);
   //  printf("[%d]op_name:%s\n", i, op_api->name());
     if (ret != T_SUCCESS) {
       printf("forward error code :%d, op index :%d, op name: %s\n", ret, i,
              op_api->name());
       return ret;
     }
-    tTensorName *name_list =
-        (tTensorName *)inst->model_->debug_info->tensor_name_list_;
-
-    p_op += op->total_size_;
   }
 
   luna_register_hook(0, 0);
@@ -1298,6 +3359,20 @@ const thinkerApi *thinkerGetApi() {
         g_api.tUpdateShape = tUpdateShape;
         g_api.tGetOutput = tGetOutput;
         g_api.tGetOutputByName = tGetOutputByName;
+        g_api.tBindInput = tBindInput;
+        g_api.tBindOutput = tBindOutput;
+        g_api.tResetState = tResetState;
+        g_api.tForwardAsync = tForwardAsync;
+        g_api.tWait = tWait;
+        g_api.tForwardBatch = tForwardBatch;
+        g_api.tModelInitMapped = tModelInitMapped;
+        g_api.tGetMemoryPeak = tGetMemoryPeak;
+        g_api.tGetProfile = tGetProfile;
+        g_api.tResetProfile = tResetProfile;
+        g_api.tGetDMAProfile = tGetDMAProfile;
+        g_api.tGetStats = tGetStats;
+        g_api.tResetStats = tResetStats;
+        g_api.tGetMemoryPlanMapped = tGetMemoryPlanMapped;
         g_api.tForward = tForward;
 
         g_api.tExecutorStart = tExecutorStart;
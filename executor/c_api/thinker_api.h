@@ -53,6 +53,12 @@ THINKER_API(tStatus, tGetMemoryPlan,
 THINKER_API(tStatus, tModelInit,
             (tModelHandle * model, const int8_t *res, const uint64_t size,
              const tMemory *memory, int32_t num_memory));
+THINKER_API(tStatus, tModelInitMapped,
+            (tModelHandle * model, const int8_t *res, const uint64_t size,
+             const tMemory *memory, int32_t num_memory));
+THINKER_API(tStatus, tGetMemoryPlanMapped,
+            (tMemory * memory, int32_t *num_memory, const int8_t *res,
+             const uint64_t size));
 THINKER_API(tStatus, tModelFini, (tModelHandle model));
 
 // input
@@ -95,9 +101,33 @@ THINKER_API(tStatus, tGetOutput,
 THINKER_API(tStatus, tGetOutputByName,
             (const tExecHandle hdl, const char *name, tData *input));
 
+THINKER_API(tStatus, tBindInput,
+            (const tExecHandle hdl, const int32_t idx, const tData *input));
+THINKER_API(tStatus, tBindOutput,
+            (const tExecHandle hdl, const int32_t idx, const tData *output));
+THINKER_API(tStatus, tResetState, (tExecHandle hdl));
+
 THINKER_API(tStatus, tForward, (const tExecHandle hdl));
 
+typedef void (*tForwardCallback)(tExecHandle hdl, tStatus status, void *user);
+THINKER_API(tStatus, tForwardAsync,
+            (const tExecHandle hdl, tForwardCallback callback, void *user));
+THINKER_API(tStatus, tWait, (const tExecHandle hdl));
+THINKER_API(tStatus, tForwardBatch,
+            (const tExecHandle hdl, const tData *inputs, tData *outputs,
+             const int32_t num_batch));
+
 THINKER_API(tStatus, tUpdateShape, (tExecHandle hdl, const char **axis_names, const uint32_t *axis_sizes, int32_t num));
+THINKER_API(tStatus, tGetMemoryPeak,
+            (const tExecHandle hdl, const int32_t dev_type, uint64_t *peak));
+THINKER_API(tStatus, tGetProfile,
+            (const tExecHandle hdl, tProfileRecord *records, int32_t *num));
+THINKER_API(tStatus, tResetProfile, (const tExecHandle hdl));
+THINKER_API(tStatus, tGetDMAProfile,
+            (const tExecHandle hdl, tDMARecord *records, int32_t *num, float *overlap));
+THINKER_API(tStatus, tGetStats,
+            (const tExecHandle hdl, tStats *stats, uint32_t *op_counts, int32_t *num));
+THINKER_API(tStatus, tResetStats, (const tExecHandle hdl));
 
 THINKER_API(tStatus, tExecutorStart, (tExecHandle hdl));
 THINKER_API(tStatus, tExecutorStop, (tExecHandle hdl));
@@ -154,6 +184,21 @@ typedef struct _thinkerApi {
   Proc_tSubLunaList tSubLunaList;
   Proc_tGetListResult tGetListResult;
 #endif
+
+  Proc_tBindInput tBindInput;
+  Proc_tBindOutput tBindOutput;
+  Proc_tResetState tResetState;
+  Proc_tForwardAsync tForwardAsync;
+  Proc_tWait tWait;
+  Proc_tForwardBatch tForwardBatch;
+  Proc_tModelInitMapped tModelInitMapped;
+  Proc_tGetMemoryPeak tGetMemoryPeak;
+  Proc_tGetProfile tGetProfile;
+  Proc_tResetProfile tResetProfile;
+  Proc_tGetDMAProfile tGetDMAProfile;
+  Proc_tGetStats tGetStats;
+  Proc_tResetStats tResetStats;
+  Proc_tGetMemoryPlanMapped tGetMemoryPlanMapped;
   void * reserve[3];  // aligned 4*sizeof(pointer)
 
 } thinkerApi;
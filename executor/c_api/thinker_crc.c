@@ -0,0 +1,882 @@
+/**
+ * @file    thinker_crc.c
+ * @brief   CRC calculation functions for x Engine @listenai
+ *
+ * Both checksums are reflected CRCs processed eight bytes per step with
+ * slicing-by-8 tables: table[k][b] is the CRC of byte b followed by k zero
+ * bytes. On x86 hosts with PCLMULQDQ, long buffers are first folded 64 bytes
+ * at a time with carry-less multiplies. The result is identical to the
+ * byte-wise algorithm.
+ *
+ * Copyright (C) 2022 listenai Co.Ltd
+ * All rights reserved.
+ */
+
+#include "thinker_crc.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <wmmintrin.h>
+#define THINKER_CRC_CLMUL 1
+#endif
+
+/* CRC-24 lookup tables, reflected polynomial 0xC60001 */
+static const uint32_t crc24_table[8][256] = {
+    {
+        0x00000000, 0x00848401, 0x00850801, 0x00018c00, 0x00861001, 0x00029400,
+        0x00031800, 0x00879c01, 0x00802001, 0x0004a400, 0x00052800, 0x0081ac01,
+        0x00063000, 0x0082b401, 0x00833801, 0x0007bc00, 0x008c4001, 0x0008c400,
+        0x00094800, 0x008dcc01, 0x000a5000, 0x008ed401, 0x008f5801, 0x000bdc00,
+        0x000c6000, 0x0088e401, 0x00896801, 0x000dec00, 0x008a7001, 0x000ef400,
+        0x000f7800, 0x008bfc01, 0x00948001, 0x00100400, 0x00118800, 0x00950c01,
+        0x00129000, 0x00961401, 0x00979801, 0x00131c00, 0x0014a000, 0x00902401,
+        0x0091a801, 0x00152c00, 0x0092b001, 0x00163400, 0x0017b800, 0x00933c01,
+        0x0018c000, 0x009c4401, 0x009dc801, 0x00194c00, 0x009ed001, 0x001a5400,
+        0x001bd800, 0x009f5c01, 0x0098e001, 0x001c6400, 0x001de800, 0x00996c01,
+        0x001ef000, 0x009a7401, 0x009bf801, 0x001f7c00, 0x00a50001, 0x00218400,
+        0x00200800, 0x00a48c01, 0x00231000, 0x00a79401, 0x00a61801, 0x00229c00,
+        0x00252000, 0x00a1a401, 0x00a02801, 0x0024ac00, 0x00a33001, 0x0027b400,
+        0x00263800, 0x00a2bc01, 0x00294000, 0x00adc401, 0x00ac4801, 0x0028cc00,
+        0x00af5001, 0x002bd400, 0x002a5800, 0x00aedc01, 0x00a96001, 0x002de400,
+        0x002c6800, 0x00a8ec01, 0x002f7000, 0x00abf401, 0x00aa7801, 0x002efc00,
+        0x00318000, 0x00b50401, 0x00b48801, 0x00300c00, 0x00b79001, 0x00331400,
+        0x00329800, 0x00b61c01, 0x00b1a001, 0x00352400, 0x0034a800, 0x00b02c01,
+        0x0037b000, 0x00b33401, 0x00b2b801, 0x00363c00, 0x00bdc001, 0x00394400,
+        0x0038c800, 0x00bc4c01, 0x003bd000, 0x00bf5401, 0x00bed801, 0x003a5c00,
+        0x003de000, 0x00b96401, 0x00b8e801, 0x003c6c00, 0x00bbf001, 0x003f7400,
+        0x003ef800, 0x00ba7c01, 0x00c60001, 0x00428400, 0x00430800, 0x00c78c01,
+        0x00401000, 0x00c49401, 0x00c51801, 0x00419c00, 0x00462000, 0x00c2a401,
+        0x00c32801, 0x0047ac00, 0x00c03001, 0x0044b400, 0x00453800, 0x00c1bc01,
+        0x004a4000, 0x00cec401, 0x00cf4801, 0x004bcc00, 0x00cc5001, 0x0048d400,
+        0x00495800, 0x00cddc01, 0x00ca6001, 0x004ee400, 0x004f6800, 0x00cbec01,
+        0x004c7000, 0x00c8f401, 0x00c97801, 0x004dfc00, 0x00528000, 0x00d60401,
+        0x00d78801, 0x00530c00, 0x00d49001, 0x00501400, 0x00519800, 0x00d51c01,
+        0x00d2a001, 0x00562400, 0x0057a800, 0x00d32c01, 0x0054b000, 0x00d03401,
+        0x00d1b801, 0x00553c00, 0x00dec001, 0x005a4400, 0x005bc800, 0x00df4c01,
+        0x0058d000, 0x00dc5401, 0x00ddd801, 0x00595c00, 0x005ee000, 0x00da6401,
+        0x00dbe801, 0x005f6c00, 0x00d8f001, 0x005c7400, 0x005df800, 0x00d97c01,
+        0x00630000, 0x00e78401, 0x00e60801, 0x00628c00, 0x00e51001, 0x00619400,
+        0x00601800, 0x00e49c01, 0x00e32001, 0x0067a400, 0x00662800, 0x00e2ac01,
+        0x00653000, 0x00e1b401, 0x00e03801, 0x0064bc00, 0x00ef4001, 0x006bc400,
+        0x006a4800, 0x00eecc01, 0x00695000, 0x00edd401, 0x00ec5801, 0x0068dc00,
+        0x006f6000, 0x00ebe401, 0x00ea6801, 0x006eec00, 0x00e97001, 0x006df400,
+        0x006c7800, 0x00e8fc01, 0x00f78001, 0x00730400, 0x00728800, 0x00f60c01,
+        0x00719000, 0x00f51401, 0x00f49801, 0x00701c00, 0x0077a000, 0x00f32401,
+        0x00f2a801, 0x00762c00, 0x00f1b001, 0x00753400, 0x0074b800, 0x00f03c01,
+        0x007bc000, 0x00ff4401, 0x00fec801, 0x007a4c00, 0x00fdd001, 0x00795400,
+        0x0078d800, 0x00fc5c01, 0x00fbe001, 0x007f6400, 0x007ee800, 0x00fa6c01,
+        0x007df000, 0x00f97401, 0x00f8f801, 0x007c7c00
+    },
+    {
+        0x00000000, 0x00840085, 0x00840109, 0x0000018c, 0x00840211, 0x00000294,
+        0x00000318, 0x0084039d, 0x00840421, 0x000004a4, 0x00000528, 0x008405ad,
+        0x00000630, 0x008406b5, 0x00840739, 0x000007bc, 0x00840841, 0x000008c4,
+        0x00000948, 0x008409cd, 0x00000a50, 0x00840ad5, 0x00840b59, 0x00000bdc,
+        0x00000c60, 0x00840ce5, 0x00840d69, 0x00000dec, 0x00840e71, 0x00000ef4,
+        0x00000f78, 0x00840ffd, 0x00841081, 0x00001004, 0x00001188, 0x0084110d,
+        0x00001290, 0x00841215, 0x00841399, 0x0000131c, 0x000014a0, 0x00841425,
+        0x008415a9, 0x0000152c, 0x008416b1, 0x00001634, 0x000017b8, 0x0084173d,
+        0x000018c0, 0x00841845, 0x008419c9, 0x0000194c, 0x00841ad1, 0x00001a54,
+        0x00001bd8, 0x00841b5d, 0x00841ce1, 0x00001c64, 0x00001de8, 0x00841d6d,
+        0x00001ef0, 0x00841e75, 0x00841ff9, 0x00001f7c, 0x00842101, 0x00002184,
+        0x00002008, 0x0084208d, 0x00002310, 0x00842395, 0x00842219, 0x0000229c,
+        0x00002520, 0x008425a5, 0x00842429, 0x000024ac, 0x00842731, 0x000027b4,
+        0x00002638, 0x008426bd, 0x00002940, 0x008429c5, 0x00842849, 0x000028cc,
+        0x00842b51, 0x00002bd4, 0x00002a58, 0x00842add, 0x00842d61, 0x00002de4,
+        0x00002c68, 0x00842ced, 0x00002f70, 0x00842ff5, 0x00842e79, 0x00002efc,
+        0x00003180, 0x00843105, 0x00843089, 0x0000300c, 0x00843391, 0x00003314,
+        0x00003298, 0x0084321d, 0x008435a1, 0x00003524, 0x000034a8, 0x0084342d,
+        0x000037b0, 0x00843735, 0x008436b9, 0x0000363c, 0x008439c1, 0x00003944,
+        0x000038c8, 0x0084384d, 0x00003bd0, 0x00843b55, 0x00843ad9, 0x00003a5c,
+        0x00003de0, 0x00843d65, 0x00843ce9, 0x00003c6c, 0x00843ff1, 0x00003f74,
+        0x00003ef8, 0x00843e7d, 0x00844201, 0x00004284, 0x00004308, 0x0084438d,
+        0x00004010, 0x00844095, 0x00844119, 0x0000419c, 0x00004620, 0x008446a5,
+        0x00844729, 0x000047ac, 0x00844431, 0x000044b4, 0x00004538, 0x008445bd,
+        0x00004a40, 0x00844ac5, 0x00844b49, 0x00004bcc, 0x00844851, 0x000048d4,
+        0x00004958, 0x008449dd, 0x00844e61, 0x00004ee4, 0x00004f68, 0x00844fed,
+        0x00004c70, 0x00844cf5, 0x00844d79, 0x00004dfc, 0x00005280, 0x00845205,
+        0x00845389, 0x0000530c, 0x00845091, 0x00005014, 0x00005198, 0x0084511d,
+        0x008456a1, 0x00005624, 0x000057a8, 0x0084572d, 0x000054b0, 0x00845435,
+        0x008455b9, 0x0000553c, 0x00845ac1, 0x00005a44, 0x00005bc8, 0x00845b4d,
+        0x000058d0, 0x00845855, 0x008459d9, 0x0000595c, 0x00005ee0, 0x00845e65,
+        0x00845fe9, 0x00005f6c, 0x00845cf1, 0x00005c74, 0x00005df8, 0x00845d7d,
+        0x00006300, 0x00846385, 0x00846209, 0x0000628c, 0x00846111, 0x00006194,
+        0x00006018, 0x0084609d, 0x00846721, 0x000067a4, 0x00006628, 0x008466ad,
+        0x00006530, 0x008465b5, 0x00846439, 0x000064bc, 0x00846b41, 0x00006bc4,
+        0x00006a48, 0x00846acd, 0x00006950, 0x008469d5, 0x00846859, 0x000068dc,
+        0x00006f60, 0x00846fe5, 0x00846e69, 0x00006eec, 0x00846d71, 0x00006df4,
+        0x00006c78, 0x00846cfd, 0x00847381, 0x00007304, 0x00007288, 0x0084720d,
+        0x00007190, 0x00847115, 0x00847099, 0x0000701c, 0x000077a0, 0x00847725,
+        0x008476a9, 0x0000762c, 0x008475b1, 0x00007534, 0x000074b8, 0x0084743d,
+        0x00007bc0, 0x00847b45, 0x00847ac9, 0x00007a4c, 0x008479d1, 0x00007954,
+        0x000078d8, 0x0084785d, 0x00847fe1, 0x00007f64, 0x00007ee8, 0x00847e6d,
+        0x00007df0, 0x00847d75, 0x00847cf9, 0x00007c7c
+    },
+    {
+        0x00000000, 0x00c41001, 0x00042001, 0x00c03000, 0x00084002, 0x00cc5003,
+        0x000c6003, 0x00c87002, 0x00108004, 0x00d49005, 0x0014a005, 0x00d0b004,
+        0x0018c006, 0x00dcd007, 0x001ce007, 0x00d8f006, 0x00210008, 0x00e51009,
+        0x00252009, 0x00e13008, 0x0029400a, 0x00ed500b, 0x002d600b, 0x00e9700a,
+        0x0031800c, 0x00f5900d, 0x0035a00d, 0x00f1b00c, 0x0039c00e, 0x00fdd00f,
+        0x003de00f, 0x00f9f00e, 0x00420010, 0x00861011, 0x00462011, 0x00823010,
+        0x004a4012, 0x008e5013, 0x004e6013, 0x008a7012, 0x00528014, 0x00969015,
+        0x0056a015, 0x0092b014, 0x005ac016, 0x009ed017, 0x005ee017, 0x009af016,
+        0x00630018, 0x00a71019, 0x00672019, 0x00a33018, 0x006b401a, 0x00af501b,
+        0x006f601b, 0x00ab701a, 0x0073801c, 0x00b7901d, 0x0077a01d, 0x00b3b01c,
+        0x007bc01e, 0x00bfd01f, 0x007fe01f, 0x00bbf01e, 0x00840020, 0x00401021,
+        0x00802021, 0x00443020, 0x008c4022, 0x00485023, 0x00886023, 0x004c7022,
+        0x00948024, 0x00509025, 0x0090a025, 0x0054b024, 0x009cc026, 0x0058d027,
+        0x0098e027, 0x005cf026, 0x00a50028, 0x00611029, 0x00a12029, 0x00653028,
+        0x00ad402a, 0x0069502b, 0x00a9602b, 0x006d702a, 0x00b5802c, 0x0071902d,
+        0x00b1a02d, 0x0075b02c, 0x00bdc02e, 0x0079d02f, 0x00b9e02f, 0x007df02e,
+        0x00c60030, 0x00021031, 0x00c22031, 0x00063030, 0x00ce4032, 0x000a5033,
+        0x00ca6033, 0x000e7032, 0x00d68034, 0x00129035, 0x00d2a035, 0x0016b034,
+        0x00dec036, 0x001ad037, 0x00dae037, 0x001ef036, 0x00e70038, 0x00231039,
+        0x00e32039, 0x00273038, 0x00ef403a, 0x002b503b, 0x00eb603b, 0x002f703a,
+        0x00f7803c, 0x0033903d, 0x00f3a03d, 0x0037b03c, 0x00ffc03e, 0x003bd03f,
+        0x00fbe03f, 0x003ff03e, 0x00840043, 0x00401042, 0x00802042, 0x00443043,
+        0x008c4041, 0x00485040, 0x00886040, 0x004c7041, 0x00948047, 0x00509046,
+        0x0090a046, 0x0054b047, 0x009cc045, 0x0058d044, 0x0098e044, 0x005cf045,
+        0x00a5004b, 0x0061104a, 0x00a1204a, 0x0065304b, 0x00ad4049, 0x00695048,
+        0x00a96048, 0x006d7049, 0x00b5804f, 0x0071904e, 0x00b1a04e, 0x0075b04f,
+        0x00bdc04d, 0x0079d04c, 0x00b9e04c, 0x007df04d, 0x00c60053, 0x00021052,
+        0x00c22052, 0x00063053, 0x00ce4051, 0x000a5050, 0x00ca6050, 0x000e7051,
+        0x00d68057, 0x00129056, 0x00d2a056, 0x0016b057, 0x00dec055, 0x001ad054,
+        0x00dae054, 0x001ef055, 0x00e7005b, 0x0023105a, 0x00e3205a, 0x0027305b,
+        0x00ef4059, 0x002b5058, 0x00eb6058, 0x002f7059, 0x00f7805f, 0x0033905e,
+        0x00f3a05e, 0x0037b05f, 0x00ffc05d, 0x003bd05c, 0x00fbe05c, 0x003ff05d,
+        0x00000063, 0x00c41062, 0x00042062, 0x00c03063, 0x00084061, 0x00cc5060,
+        0x000c6060, 0x00c87061, 0x00108067, 0x00d49066, 0x0014a066, 0x00d0b067,
+        0x0018c065, 0x00dcd064, 0x001ce064, 0x00d8f065, 0x0021006b, 0x00e5106a,
+        0x0025206a, 0x00e1306b, 0x00294069, 0x00ed5068, 0x002d6068, 0x00e97069,
+        0x0031806f, 0x00f5906e, 0x0035a06e, 0x00f1b06f, 0x0039c06d, 0x00fdd06c,
+        0x003de06c, 0x00f9f06d, 0x00420073, 0x00861072, 0x00462072, 0x00823073,
+        0x004a4071, 0x008e5070, 0x004e6070, 0x008a7071, 0x00528077, 0x00969076,
+        0x0056a076, 0x0092b077, 0x005ac075, 0x009ed074, 0x005ee074, 0x009af075,
+        0x0063007b, 0x00a7107a, 0x0067207a, 0x00a3307b, 0x006b4079, 0x00af5078,
+        0x006f6078, 0x00ab7079, 0x0073807f, 0x00b7907e, 0x0077a07e, 0x00b3b07f,
+        0x007bc07d, 0x00bfd07c, 0x007fe07c, 0x00bbf07d
+    },
+    {
+        0x00000000, 0x00844011, 0x00848021, 0x0000c030, 0x00850041, 0x00014050,
+        0x00018060, 0x0085c071, 0x00860081, 0x00024090, 0x000280a0, 0x0086c0b1,
+        0x000300c0, 0x008740d1, 0x008780e1, 0x0003c0f0, 0x00800101, 0x00044110,
+        0x00048120, 0x0080c131, 0x00050140, 0x00814151, 0x00818161, 0x0005c170,
+        0x00060180, 0x00824191, 0x008281a1, 0x0006c1b0, 0x008301c1, 0x000741d0,
+        0x000781e0, 0x0083c1f1, 0x008c0201, 0x00084210, 0x00088220, 0x008cc231,
+        0x00090240, 0x008d4251, 0x008d8261, 0x0009c270, 0x000a0280, 0x008e4291,
+        0x008e82a1, 0x000ac2b0, 0x008f02c1, 0x000b42d0, 0x000b82e0, 0x008fc2f1,
+        0x000c0300, 0x00884311, 0x00888321, 0x000cc330, 0x00890341, 0x000d4350,
+        0x000d8360, 0x0089c371, 0x008a0381, 0x000e4390, 0x000e83a0, 0x008ac3b1,
+        0x000f03c0, 0x008b43d1, 0x008b83e1, 0x000fc3f0, 0x00940401, 0x00104410,
+        0x00108420, 0x0094c431, 0x00110440, 0x00954451, 0x00958461, 0x0011c470,
+        0x00120480, 0x00964491, 0x009684a1, 0x0012c4b0, 0x009704c1, 0x001344d0,
+        0x001384e0, 0x0097c4f1, 0x00140500, 0x00904511, 0x00908521, 0x0014c530,
+        0x00910541, 0x00154550, 0x00158560, 0x0091c571, 0x00920581, 0x00164590,
+        0x001685a0, 0x0092c5b1, 0x001705c0, 0x009345d1, 0x009385e1, 0x0017c5f0,
+        0x00180600, 0x009c4611, 0x009c8621, 0x0018c630, 0x009d0641, 0x00194650,
+        0x00198660, 0x009dc671, 0x009e0681, 0x001a4690, 0x001a86a0, 0x009ec6b1,
+        0x001b06c0, 0x009f46d1, 0x009f86e1, 0x001bc6f0, 0x00980701, 0x001c4710,
+        0x001c8720, 0x0098c731, 0x001d0740, 0x00994751, 0x00998761, 0x001dc770,
+        0x001e0780, 0x009a4791, 0x009a87a1, 0x001ec7b0, 0x009b07c1, 0x001f47d0,
+        0x001f87e0, 0x009bc7f1, 0x00a40801, 0x00204810, 0x00208820, 0x00a4c831,
+        0x00210840, 0x00a54851, 0x00a58861, 0x0021c870, 0x00220880, 0x00a64891,
+        0x00a688a1, 0x0022c8b0, 0x00a708c1, 0x002348d0, 0x002388e0, 0x00a7c8f1,
+        0x00240900, 0x00a04911, 0x00a08921, 0x0024c930, 0x00a10941, 0x00254950,
+        0x00258960, 0x00a1c971, 0x00a20981, 0x00264990, 0x002689a0, 0x00a2c9b1,
+        0x002709c0, 0x00a349d1, 0x00a389e1, 0x0027c9f0, 0x00280a00, 0x00ac4a11,
+        0x00ac8a21, 0x0028ca30, 0x00ad0a41, 0x00294a50, 0x00298a60, 0x00adca71,
+        0x00ae0a81, 0x002a4a90, 0x002a8aa0, 0x00aecab1, 0x002b0ac0, 0x00af4ad1,
+        0x00af8ae1, 0x002bcaf0, 0x00a80b01, 0x002c4b10, 0x002c8b20, 0x00a8cb31,
+        0x002d0b40, 0x00a94b51, 0x00a98b61, 0x002dcb70, 0x002e0b80, 0x00aa4b91,
+        0x00aa8ba1, 0x002ecbb0, 0x00ab0bc1, 0x002f4bd0, 0x002f8be0, 0x00abcbf1,
+        0x00300c00, 0x00b44c11, 0x00b48c21, 0x0030cc30, 0x00b50c41, 0x00314c50,
+        0x00318c60, 0x00b5cc71, 0x00b60c81, 0x00324c90, 0x00328ca0, 0x00b6ccb1,
+        0x00330cc0, 0x00b74cd1, 0x00b78ce1, 0x0033ccf0, 0x00b00d01, 0x00344d10,
+        0x00348d20, 0x00b0cd31, 0x00350d40, 0x00b14d51, 0x00b18d61, 0x0035cd70,
+        0x00360d80, 0x00b24d91, 0x00b28da1, 0x0036cdb0, 0x00b30dc1, 0x00374dd0,
+        0x00378de0, 0x00b3cdf1, 0x00bc0e01, 0x00384e10, 0x00388e20, 0x00bcce31,
+        0x00390e40, 0x00bd4e51, 0x00bd8e61, 0x0039ce70, 0x003a0e80, 0x00be4e91,
+        0x00be8ea1, 0x003aceb0, 0x00bf0ec1, 0x003b4ed0, 0x003b8ee0, 0x00bfcef1,
+        0x003c0f00, 0x00b84f11, 0x00b88f21, 0x003ccf30, 0x00b90f41, 0x003d4f50,
+        0x003d8f60, 0x00b9cf71, 0x00ba0f81, 0x003e4f90, 0x003e8fa0, 0x00bacfb1,
+        0x003f0fc0, 0x00bb4fd1, 0x00bb8fe1, 0x003fcff0
+    },
+    {
+        0x00000000, 0x00084040, 0x00108080, 0x0018c0c0, 0x00210100, 0x00294140,
+        0x00318180, 0x0039c1c0, 0x00420200, 0x004a4240, 0x00528280, 0x005ac2c0,
+        0x00630300, 0x006b4340, 0x00738380, 0x007bc3c0, 0x00840400, 0x008c4440,
+        0x00948480, 0x009cc4c0, 0x00a50500, 0x00ad4540, 0x00b58580, 0x00bdc5c0,
+        0x00c60600, 0x00ce4640, 0x00d68680, 0x00dec6c0, 0x00e70700, 0x00ef4740,
+        0x00f78780, 0x00ffc7c0, 0x00840803, 0x008c4843, 0x00948883, 0x009cc8c3,
+        0x00a50903, 0x00ad4943, 0x00b58983, 0x00bdc9c3, 0x00c60a03, 0x00ce4a43,
+        0x00d68a83, 0x00decac3, 0x00e70b03, 0x00ef4b43, 0x00f78b83, 0x00ffcbc3,
+        0x00000c03, 0x00084c43, 0x00108c83, 0x0018ccc3, 0x00210d03, 0x00294d43,
+        0x00318d83, 0x0039cdc3, 0x00420e03, 0x004a4e43, 0x00528e83, 0x005acec3,
+        0x00630f03, 0x006b4f43, 0x00738f83, 0x007bcfc3, 0x00841005, 0x008c5045,
+        0x00949085, 0x009cd0c5, 0x00a51105, 0x00ad5145, 0x00b59185, 0x00bdd1c5,
+        0x00c61205, 0x00ce5245, 0x00d69285, 0x00ded2c5, 0x00e71305, 0x00ef5345,
+        0x00f79385, 0x00ffd3c5, 0x00001405, 0x00085445, 0x00109485, 0x0018d4c5,
+        0x00211505, 0x00295545, 0x00319585, 0x0039d5c5, 0x00421605, 0x004a5645,
+        0x00529685, 0x005ad6c5, 0x00631705, 0x006b5745, 0x00739785, 0x007bd7c5,
+        0x00001806, 0x00085846, 0x00109886, 0x0018d8c6, 0x00211906, 0x00295946,
+        0x00319986, 0x0039d9c6, 0x00421a06, 0x004a5a46, 0x00529a86, 0x005adac6,
+        0x00631b06, 0x006b5b46, 0x00739b86, 0x007bdbc6, 0x00841c06, 0x008c5c46,
+        0x00949c86, 0x009cdcc6, 0x00a51d06, 0x00ad5d46, 0x00b59d86, 0x00bdddc6,
+        0x00c61e06, 0x00ce5e46, 0x00d69e86, 0x00dedec6, 0x00e71f06, 0x00ef5f46,
+        0x00f79f86, 0x00ffdfc6, 0x00842009, 0x008c6049, 0x0094a089, 0x009ce0c9,
+        0x00a52109, 0x00ad6149, 0x00b5a189, 0x00bde1c9, 0x00c62209, 0x00ce6249,
+        0x00d6a289, 0x00dee2c9, 0x00e72309, 0x00ef6349, 0x00f7a389, 0x00ffe3c9,
+        0x00002409, 0x00086449, 0x0010a489, 0x0018e4c9, 0x00212509, 0x00296549,
+        0x0031a589, 0x0039e5c9, 0x00422609, 0x004a6649, 0x0052a689, 0x005ae6c9,
+        0x00632709, 0x006b6749, 0x0073a789, 0x007be7c9, 0x0000280a, 0x0008684a,
+        0x0010a88a, 0x0018e8ca, 0x0021290a, 0x0029694a, 0x0031a98a, 0x0039e9ca,
+        0x00422a0a, 0x004a6a4a, 0x0052aa8a, 0x005aeaca, 0x00632b0a, 0x006b6b4a,
+        0x0073ab8a, 0x007bebca, 0x00842c0a, 0x008c6c4a, 0x0094ac8a, 0x009cecca,
+        0x00a52d0a, 0x00ad6d4a, 0x00b5ad8a, 0x00bdedca, 0x00c62e0a, 0x00ce6e4a,
+        0x00d6ae8a, 0x00deeeca, 0x00e72f0a, 0x00ef6f4a, 0x00f7af8a, 0x00ffefca,
+        0x0000300c, 0x0008704c, 0x0010b08c, 0x0018f0cc, 0x0021310c, 0x0029714c,
+        0x0031b18c, 0x0039f1cc, 0x0042320c, 0x004a724c, 0x0052b28c, 0x005af2cc,
+        0x0063330c, 0x006b734c, 0x0073b38c, 0x007bf3cc, 0x0084340c, 0x008c744c,
+        0x0094b48c, 0x009cf4cc, 0x00a5350c, 0x00ad754c, 0x00b5b58c, 0x00bdf5cc,
+        0x00c6360c, 0x00ce764c, 0x00d6b68c, 0x00def6cc, 0x00e7370c, 0x00ef774c,
+        0x00f7b78c, 0x00fff7cc, 0x0084380f, 0x008c784f, 0x0094b88f, 0x009cf8cf,
+        0x00a5390f, 0x00ad794f, 0x00b5b98f, 0x00bdf9cf, 0x00c63a0f, 0x00ce7a4f,
+        0x00d6ba8f, 0x00defacf, 0x00e73b0f, 0x00ef7b4f, 0x00f7bb8f, 0x00fffbcf,
+        0x00003c0f, 0x00087c4f, 0x0010bc8f, 0x0018fccf, 0x00213d0f, 0x00297d4f,
+        0x0031bd8f, 0x0039fdcf, 0x00423e0f, 0x004a7e4f, 0x0052be8f, 0x005afecf,
+        0x00633f0f, 0x006b7f4f, 0x0073bf8f, 0x007bffcf
+    },
+    {
+        0x00000000, 0x00a50841, 0x00c61081, 0x006318c0, 0x00002101, 0x00a52940,
+        0x00c63180, 0x006339c1, 0x00004202, 0x00a54a43, 0x00c65283, 0x00635ac2,
+        0x00006303, 0x00a56b42, 0x00c67382, 0x00637bc3, 0x00008404, 0x00a58c45,
+        0x00c69485, 0x00639cc4, 0x0000a505, 0x00a5ad44, 0x00c6b584, 0x0063bdc5,
+        0x0000c606, 0x00a5ce47, 0x00c6d687, 0x0063dec6, 0x0000e707, 0x00a5ef46,
+        0x00c6f786, 0x0063ffc7, 0x00010808, 0x00a40049, 0x00c71889, 0x006210c8,
+        0x00012909, 0x00a42148, 0x00c73988, 0x006231c9, 0x00014a0a, 0x00a4424b,
+        0x00c75a8b, 0x006252ca, 0x00016b0b, 0x00a4634a, 0x00c77b8a, 0x006273cb,
+        0x00018c0c, 0x00a4844d, 0x00c79c8d, 0x006294cc, 0x0001ad0d, 0x00a4a54c,
+        0x00c7bd8c, 0x0062b5cd, 0x0001ce0e, 0x00a4c64f, 0x00c7de8f, 0x0062d6ce,
+        0x0001ef0f, 0x00a4e74e, 0x00c7ff8e, 0x0062f7cf, 0x00021010, 0x00a71851,
+        0x00c40091, 0x006108d0, 0x00023111, 0x00a73950, 0x00c42190, 0x006129d1,
+        0x00025212, 0x00a75a53, 0x00c44293, 0x00614ad2, 0x00027313, 0x00a77b52,
+        0x00c46392, 0x00616bd3, 0x00029414, 0x00a79c55, 0x00c48495, 0x00618cd4,
+        0x0002b515, 0x00a7bd54, 0x00c4a594, 0x0061add5, 0x0002d616, 0x00a7de57,
+        0x00c4c697, 0x0061ced6, 0x0002f717, 0x00a7ff56, 0x00c4e796, 0x0061efd7,
+        0x00031818, 0x00a61059, 0x00c50899, 0x006000d8, 0x00033919, 0x00a63158,
+        0x00c52998, 0x006021d9, 0x00035a1a, 0x00a6525b, 0x00c54a9b, 0x006042da,
+        0x00037b1b, 0x00a6735a, 0x00c56b9a, 0x006063db, 0x00039c1c, 0x00a6945d,
+        0x00c58c9d, 0x006084dc, 0x0003bd1d, 0x00a6b55c, 0x00c5ad9c, 0x0060a5dd,
+        0x0003de1e, 0x00a6d65f, 0x00c5ce9f, 0x0060c6de, 0x0003ff1f, 0x00a6f75e,
+        0x00c5ef9e, 0x0060e7df, 0x00042020, 0x00a12861, 0x00c230a1, 0x006738e0,
+        0x00040121, 0x00a10960, 0x00c211a0, 0x006719e1, 0x00046222, 0x00a16a63,
+        0x00c272a3, 0x00677ae2, 0x00044323, 0x00a14b62, 0x00c253a2, 0x00675be3,
+        0x0004a424, 0x00a1ac65, 0x00c2b4a5, 0x0067bce4, 0x00048525, 0x00a18d64,
+        0x00c295a4, 0x00679de5, 0x0004e626, 0x00a1ee67, 0x00c2f6a7, 0x0067fee6,
+        0x0004c727, 0x00a1cf66, 0x00c2d7a6, 0x0067dfe7, 0x00052828, 0x00a02069,
+        0x00c338a9, 0x006630e8, 0x00050929, 0x00a00168, 0x00c319a8, 0x006611e9,
+        0x00056a2a, 0x00a0626b, 0x00c37aab, 0x006672ea, 0x00054b2b, 0x00a0436a,
+        0x00c35baa, 0x006653eb, 0x0005ac2c, 0x00a0a46d, 0x00c3bcad, 0x0066b4ec,
+        0x00058d2d, 0x00a0856c, 0x00c39dac, 0x006695ed, 0x0005ee2e, 0x00a0e66f,
+        0x00c3feaf, 0x0066f6ee, 0x0005cf2f, 0x00a0c76e, 0x00c3dfae, 0x0066d7ef,
+        0x00063030, 0x00a33871, 0x00c020b1, 0x006528f0, 0x00061131, 0x00a31970,
+        0x00c001b0, 0x006509f1, 0x00067232, 0x00a37a73, 0x00c062b3, 0x00656af2,
+        0x00065333, 0x00a35b72, 0x00c043b2, 0x00654bf3, 0x0006b434, 0x00a3bc75,
+        0x00c0a4b5, 0x0065acf4, 0x00069535, 0x00a39d74, 0x00c085b4, 0x00658df5,
+        0x0006f636, 0x00a3fe77, 0x00c0e6b7, 0x0065eef6, 0x0006d737, 0x00a3df76,
+        0x00c0c7b6, 0x0065cff7, 0x00073838, 0x00a23079, 0x00c128b9, 0x006420f8,
+        0x00071939, 0x00a21178, 0x00c109b8, 0x006401f9, 0x00077a3a, 0x00a2727b,
+        0x00c16abb, 0x006462fa, 0x00075b3b, 0x00a2537a, 0x00c14bba, 0x006443fb,
+        0x0007bc3c, 0x00a2b47d, 0x00c1acbd, 0x0064a4fc, 0x00079d3d, 0x00a2957c,
+        0x00c18dbc, 0x006485fd, 0x0007fe3e, 0x00a2f67f, 0x00c1eebf, 0x0064e6fe,
+        0x0007df3f, 0x00a2d77e, 0x00c1cfbe, 0x0064c7ff
+    },
+    {
+        0x00000000, 0x00212108, 0x00424210, 0x00636318, 0x00848420, 0x00a5a528,
+        0x00c6c630, 0x00e7e738, 0x00850843, 0x00a4294b, 0x00c74a53, 0x00e66b5b,
+        0x00018c63, 0x0020ad6b, 0x0043ce73, 0x0062ef7b, 0x00861085, 0x00a7318d,
+        0x00c45295, 0x00e5739d, 0x000294a5, 0x0023b5ad, 0x0040d6b5, 0x0061f7bd,
+        0x000318c6, 0x002239ce, 0x00415ad6, 0x00607bde, 0x00879ce6, 0x00a6bdee,
+        0x00c5def6, 0x00e4fffe, 0x00802109, 0x00a10001, 0x00c26319, 0x00e34211,
+        0x0004a529, 0x00258421, 0x0046e739, 0x0067c631, 0x0005294a, 0x00240842,
+        0x00476b5a, 0x00664a52, 0x0081ad6a, 0x00a08c62, 0x00c3ef7a, 0x00e2ce72,
+        0x0006318c, 0x00271084, 0x0044739c, 0x00655294, 0x0082b5ac, 0x00a394a4,
+        0x00c0f7bc, 0x00e1d6b4, 0x008339cf, 0x00a218c7, 0x00c17bdf, 0x00e05ad7,
+        0x0007bdef, 0x00269ce7, 0x0045ffff, 0x0064def7, 0x008c4211, 0x00ad6319,
+        0x00ce0001, 0x00ef2109, 0x0008c631, 0x0029e739, 0x004a8421, 0x006ba529,
+        0x00094a52, 0x00286b5a, 0x004b0842, 0x006a294a, 0x008dce72, 0x00acef7a,
+        0x00cf8c62, 0x00eead6a, 0x000a5294, 0x002b739c, 0x00481084, 0x0069318c,
+        0x008ed6b4, 0x00aff7bc, 0x00cc94a4, 0x00edb5ac, 0x008f5ad7, 0x00ae7bdf,
+        0x00cd18c7, 0x00ec39cf, 0x000bdef7, 0x002affff, 0x00499ce7, 0x0068bdef,
+        0x000c6318, 0x002d4210, 0x004e2108, 0x006f0000, 0x0088e738, 0x00a9c630,
+        0x00caa528, 0x00eb8420, 0x00896b5b, 0x00a84a53, 0x00cb294b, 0x00ea0843,
+        0x000def7b, 0x002cce73, 0x004fad6b, 0x006e8c63, 0x008a739d, 0x00ab5295,
+        0x00c8318d, 0x00e91085, 0x000ef7bd, 0x002fd6b5, 0x004cb5ad, 0x006d94a5,
+        0x000f7bde, 0x002e5ad6, 0x004d39ce, 0x006c18c6, 0x008bfffe, 0x00aadef6,
+        0x00c9bdee, 0x00e89ce6, 0x00948421, 0x00b5a529, 0x00d6c631, 0x00f7e739,
+        0x00100001, 0x00312109, 0x00524211, 0x00736319, 0x00118c62, 0x0030ad6a,
+        0x0053ce72, 0x0072ef7a, 0x00950842, 0x00b4294a, 0x00d74a52, 0x00f66b5a,
+        0x001294a4, 0x0033b5ac, 0x0050d6b4, 0x0071f7bc, 0x00961084, 0x00b7318c,
+        0x00d45294, 0x00f5739c, 0x00979ce7, 0x00b6bdef, 0x00d5def7, 0x00f4ffff,
+        0x001318c7, 0x003239cf, 0x00515ad7, 0x00707bdf, 0x0014a528, 0x00358420,
+        0x0056e738, 0x0077c630, 0x00902108, 0x00b10000, 0x00d26318, 0x00f34210,
+        0x0091ad6b, 0x00b08c63, 0x00d3ef7b, 0x00f2ce73, 0x0015294b, 0x00340843,
+        0x00576b5b, 0x00764a53, 0x0092b5ad, 0x00b394a5, 0x00d0f7bd, 0x00f1d6b5,
+        0x0016318d, 0x00371085, 0x0054739d, 0x00755295, 0x0017bdee, 0x00369ce6,
+        0x0055fffe, 0x0074def6, 0x009339ce, 0x00b218c6, 0x00d17bde, 0x00f05ad6,
+        0x0018c630, 0x0039e738, 0x005a8420, 0x007ba528, 0x009c4210, 0x00bd6318,
+        0x00de0000, 0x00ff2108, 0x009dce73, 0x00bcef7b, 0x00df8c63, 0x00fead6b,
+        0x00194a53, 0x00386b5b, 0x005b0843, 0x007a294b, 0x009ed6b5, 0x00bff7bd,
+        0x00dc94a5, 0x00fdb5ad, 0x001a5295, 0x003b739d, 0x00581085, 0x0079318d,
+        0x001bdef6, 0x003afffe, 0x00599ce6, 0x0078bdee, 0x009f5ad6, 0x00be7bde,
+        0x00dd18c6, 0x00fc39ce, 0x0098e739, 0x00b9c631, 0x00daa529, 0x00fb8421,
+        0x001c6319, 0x003d4211, 0x005e2109, 0x007f0001, 0x001def7a, 0x003cce72,
+        0x005fad6a, 0x007e8c62, 0x00996b5a, 0x00b84a52, 0x00db294a, 0x00fa0842,
+        0x001ef7bc, 0x003fd6b4, 0x005cb5ac, 0x007d94a4, 0x009a739c, 0x00bb5294,
+        0x00d8318c, 0x00f91084, 0x009bffff, 0x00badef7, 0x00d9bdef, 0x00f89ce7,
+        0x001f7bdf, 0x003e5ad7, 0x005d39cf, 0x007c18c7
+    },
+    {
+        0x00000000, 0x00800120, 0x008c0243, 0x000c0363, 0x00940485, 0x001405a5,
+        0x001806c6, 0x009807e6, 0x00a40909, 0x00240829, 0x00280b4a, 0x00a80a6a,
+        0x00300d8c, 0x00b00cac, 0x00bc0fcf, 0x003c0eef, 0x00c41211, 0x00441331,
+        0x00481052, 0x00c81172, 0x00501694, 0x00d017b4, 0x00dc14d7, 0x005c15f7,
+        0x00601b18, 0x00e01a38, 0x00ec195b, 0x006c187b, 0x00f41f9d, 0x00741ebd,
+        0x00781dde, 0x00f81cfe, 0x00042421, 0x00842501, 0x00882662, 0x00082742,
+        0x009020a4, 0x00102184, 0x001c22e7, 0x009c23c7, 0x00a02d28, 0x00202c08,
+        0x002c2f6b, 0x00ac2e4b, 0x003429ad, 0x00b4288d, 0x00b82bee, 0x00382ace,
+        0x00c03630, 0x00403710, 0x004c3473, 0x00cc3553, 0x005432b5, 0x00d43395,
+        0x00d830f6, 0x005831d6, 0x00643f39, 0x00e43e19, 0x00e83d7a, 0x00683c5a,
+        0x00f03bbc, 0x00703a9c, 0x007c39ff, 0x00fc38df, 0x00084842, 0x00884962,
+        0x00844a01, 0x00044b21, 0x009c4cc7, 0x001c4de7, 0x00104e84, 0x00904fa4,
+        0x00ac414b, 0x002c406b, 0x00204308, 0x00a04228, 0x003845ce, 0x00b844ee,
+        0x00b4478d, 0x003446ad, 0x00cc5a53, 0x004c5b73, 0x00405810, 0x00c05930,
+        0x00585ed6, 0x00d85ff6, 0x00d45c95, 0x00545db5, 0x0068535a, 0x00e8527a,
+        0x00e45119, 0x00645039, 0x00fc57df, 0x007c56ff, 0x0070559c, 0x00f054bc,
+        0x000c6c63, 0x008c6d43, 0x00806e20, 0x00006f00, 0x009868e6, 0x001869c6,
+        0x00146aa5, 0x00946b85, 0x00a8656a, 0x0028644a, 0x00246729, 0x00a46609,
+        0x003c61ef, 0x00bc60cf, 0x00b063ac, 0x0030628c, 0x00c87e72, 0x00487f52,
+        0x00447c31, 0x00c47d11, 0x005c7af7, 0x00dc7bd7, 0x00d078b4, 0x00507994,
+        0x006c777b, 0x00ec765b, 0x00e07538, 0x00607418, 0x00f873fe, 0x007872de,
+        0x007471bd, 0x00f4709d, 0x00109084, 0x009091a4, 0x009c92c7, 0x001c93e7,
+        0x00849401, 0x00049521, 0x00089642, 0x00889762, 0x00b4998d, 0x003498ad,
+        0x00389bce, 0x00b89aee, 0x00209d08, 0x00a09c28, 0x00ac9f4b, 0x002c9e6b,
+        0x00d48295, 0x005483b5, 0x005880d6, 0x00d881f6, 0x00408610, 0x00c08730,
+        0x00cc8453, 0x004c8573, 0x00708b9c, 0x00f08abc, 0x00fc89df, 0x007c88ff,
+        0x00e48f19, 0x00648e39, 0x00688d5a, 0x00e88c7a, 0x0014b4a5, 0x0094b585,
+        0x0098b6e6, 0x0018b7c6, 0x0080b020, 0x0000b100, 0x000cb263, 0x008cb343,
+        0x00b0bdac, 0x0030bc8c, 0x003cbfef, 0x00bcbecf, 0x0024b929, 0x00a4b809,
+        0x00a8bb6a, 0x0028ba4a, 0x00d0a6b4, 0x0050a794, 0x005ca4f7, 0x00dca5d7,
+        0x0044a231, 0x00c4a311, 0x00c8a072, 0x0048a152, 0x0074afbd, 0x00f4ae9d,
+        0x00f8adfe, 0x0078acde, 0x00e0ab38, 0x0060aa18, 0x006ca97b, 0x00eca85b,
+        0x0018d8c6, 0x0098d9e6, 0x0094da85, 0x0014dba5, 0x008cdc43, 0x000cdd63,
+        0x0000de00, 0x0080df20, 0x00bcd1cf, 0x003cd0ef, 0x0030d38c, 0x00b0d2ac,
+        0x0028d54a, 0x00a8d46a, 0x00a4d709, 0x0024d629, 0x00dccad7, 0x005ccbf7,
+        0x0050c894, 0x00d0c9b4, 0x0048ce52, 0x00c8cf72, 0x00c4cc11, 0x0044cd31,
+        0x0078c3de, 0x00f8c2fe, 0x00f4c19d, 0x0074c0bd, 0x00ecc75b, 0x006cc67b,
+        0x0060c518, 0x00e0c438, 0x001cfce7, 0x009cfdc7, 0x0090fea4, 0x0010ff84,
+        0x0088f862, 0x0008f942, 0x0004fa21, 0x0084fb01, 0x00b8f5ee, 0x0038f4ce,
+        0x0034f7ad, 0x00b4f68d, 0x002cf16b, 0x00acf04b, 0x00a0f328, 0x0020f208,
+        0x00d8eef6, 0x0058efd6, 0x0054ecb5, 0x00d4ed95, 0x004cea73, 0x00cceb53,
+        0x00c0e830, 0x0040e910, 0x007ce7ff, 0x00fce6df, 0x00f0e5bc, 0x0070e49c,
+        0x00e8e37a, 0x0068e25a, 0x0064e139, 0x00e4e019
+    }
+};
+
+/* CRC-32 lookup tables, reflected polynomial 0xEDB88320 */
+static const uint32_t crc32_table[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
+        0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+        0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
+        0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
+        0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+        0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
+        0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
+        0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+        0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
+        0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
+        0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+        0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
+        0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
+        0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+        0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
+        0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
+        0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
+        0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
+        0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
+        0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+        0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
+        0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
+        0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+        0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
+        0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
+        0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
+        0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
+        0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
+        0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+        0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
+        0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
+        0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+        0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+    },
+    {
+        0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445,
+        0x565aa786, 0x4f4196c7, 0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb,
+        0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf, 0x4ac21251, 0x53d92310,
+        0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+        0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c,
+        0xd4413fdf, 0xcd5a0e9e, 0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761,
+        0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265, 0x5d5daeaa, 0x44469feb,
+        0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+        0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6,
+        0x891c9175, 0x9007a034, 0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38,
+        0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c, 0xf0794f05, 0xe9627e44,
+        0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+        0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148,
+        0x6efa628b, 0x77e153ca, 0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97,
+        0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93, 0x7262d75c, 0x6b79e61d,
+        0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+        0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2,
+        0x33a7cc21, 0x2abcfd60, 0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c,
+        0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768, 0x2f3f79f6, 0x362448b7,
+        0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+        0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb,
+        0xb1bc5478, 0xa8a76539, 0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88,
+        0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c, 0xf35a1243, 0xea412302,
+        0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+        0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f,
+        0x271b2d9c, 0x3e001cdd, 0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1,
+        0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5, 0xae07bce9, 0xb71c8da8,
+        0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+        0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4,
+        0x30849167, 0x299fa026, 0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b,
+        0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f, 0x2c1c24b0, 0x350715f1,
+        0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+        0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b,
+        0x9da070c8, 0x84bb4189, 0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85,
+        0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81, 0x8138c51f, 0x9823f45e,
+        0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+        0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52,
+        0x1fbbe891, 0x06a0d9d0, 0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f,
+        0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b, 0x96a779e4, 0x8fbc48a5,
+        0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+        0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8,
+        0x42e6463b, 0x5bfd777a, 0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876,
+        0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72
+    },
+    {
+        0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb,
+        0x048d7cb2, 0x054f1685, 0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1,
+        0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d, 0x1c26a370, 0x1de4c947,
+        0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+        0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023,
+        0x16b88e7a, 0x177ae44d, 0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9,
+        0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065, 0x365e1758, 0x379c7d6f,
+        0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+        0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b,
+        0x20e69922, 0x2124f315, 0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71,
+        0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad, 0x709a8dc0, 0x7158e7f7,
+        0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+        0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93,
+        0x7a04a0ca, 0x7bc6cafd, 0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9,
+        0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835, 0x62af7f08, 0x636d153f,
+        0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+        0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb,
+        0x4c5ab792, 0x4d98dda5, 0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1,
+        0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d, 0x54f16850, 0x55330267,
+        0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+        0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03,
+        0x5e6f455a, 0x5fad2f6d, 0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9,
+        0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05, 0xef264a38, 0xeee4200f,
+        0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+        0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b,
+        0xf99ec442, 0xf85cae75, 0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711,
+        0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd, 0xd9785d60, 0xd8ba3757,
+        0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+        0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33,
+        0xd3e6706a, 0xd2241a5d, 0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049,
+        0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895, 0xcb4dafa8, 0xca8fc59f,
+        0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+        0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab,
+        0x9522eaf2, 0x94e080c5, 0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1,
+        0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d, 0x8d893530, 0x8c4b5f07,
+        0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+        0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663,
+        0x8717183a, 0x86d5720d, 0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9,
+        0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625, 0xa7f18118, 0xa633eb2f,
+        0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+        0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b,
+        0xb1490f62, 0xb08b6555, 0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31,
+        0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed
+    },
+    {
+        0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032,
+        0x256b5fdc, 0x9dd738b9, 0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701,
+        0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056, 0x5019579f, 0xe8a530fa,
+        0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+        0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42,
+        0xb0c620ac, 0x087a47c9, 0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0,
+        0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787, 0x658687d1, 0xdd3ae0b4,
+        0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+        0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893,
+        0xd540a77d, 0x6dfcc018, 0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0,
+        0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7, 0x9b14583d, 0x23a83f58,
+        0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+        0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0,
+        0x7bcb2f0e, 0xc377486b, 0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c,
+        0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b, 0x0eb9274d, 0xb6054028,
+        0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+        0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731,
+        0x1e4da8df, 0xa6f1cfba, 0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002,
+        0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755, 0x6b3fa09c, 0xd383c7f9,
+        0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+        0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841,
+        0x8be0d7af, 0x335cb0ca, 0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5,
+        0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82, 0x28ed9ed4, 0x9051f9b1,
+        0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+        0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196,
+        0x982bbe78, 0x2097d91d, 0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5,
+        0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2, 0x4d6b1905, 0xf5d77e60,
+        0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+        0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8,
+        0xadb46e36, 0x15080953, 0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174,
+        0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623, 0xd8c66675, 0x607a0110,
+        0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+        0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34,
+        0x5326b1da, 0xeb9ad6bf, 0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907,
+        0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50, 0x2654b999, 0x9ee8defc,
+        0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+        0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144,
+        0xc68bceaa, 0x7e37a9cf, 0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6,
+        0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981, 0x13cb69d7, 0xab770eb2,
+        0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+        0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695,
+        0xa30d497b, 0x1bb12e1e, 0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6,
+        0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1
+    },
+    {
+        0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70,
+        0x8f40f5a0, 0xb220dc10, 0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111,
+        0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1, 0x60e09782, 0x5d80be32,
+        0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+        0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333,
+        0xdfd029e3, 0xe2b00053, 0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4,
+        0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314, 0xf1b164c5, 0xccd14d75,
+        0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+        0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6,
+        0x2e614d26, 0x13016496, 0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997,
+        0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57, 0x58f35849, 0x659371f9,
+        0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+        0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8,
+        0xe7c3e628, 0xdaa3cf98, 0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b,
+        0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db, 0x0863840a, 0x3503adba,
+        0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+        0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d,
+        0x167282ed, 0x2b12ab5d, 0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c,
+        0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c, 0xf9d2e0cf, 0xc4b2c97f,
+        0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+        0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e,
+        0x46e25eae, 0x7b82771e, 0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42,
+        0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82, 0x8196fb53, 0xbcf6d2e3,
+        0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+        0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860,
+        0x5e46d2b0, 0x6326fb00, 0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601,
+        0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1, 0x70279f96, 0x4d47b626,
+        0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+        0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27,
+        0xcf1721f7, 0xf2770847, 0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4,
+        0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404, 0x20b743d5, 0x1dd76a65,
+        0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+        0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab,
+        0x66551d7b, 0x5b3534cb, 0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca,
+        0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a, 0x89f57f59, 0xb49556e9,
+        0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+        0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8,
+        0x36c5c138, 0x0ba5e888, 0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f,
+        0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf, 0x18a48c1e, 0x25c4a5ae,
+        0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+        0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d,
+        0xc774a5fd, 0xfa148c4d, 0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c,
+        0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c
+    },
+    {
+        0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3,
+        0xd659e31d, 0x1d0530b8, 0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3,
+        0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5, 0x03d6029b, 0xc88ad13e,
+        0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+        0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145,
+        0x39dc63eb, 0xf280b04e, 0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798,
+        0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e, 0xebff875b, 0x20a354fe,
+        0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+        0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e,
+        0xd223e4b0, 0x197f3715, 0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e,
+        0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578, 0x0f580a6c, 0xc404d9c9,
+        0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+        0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2,
+        0x35526b1c, 0xfe0eb8b9, 0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59,
+        0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f, 0xe0dd8a9a, 0x2b81593f,
+        0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+        0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9,
+        0xdeadec47, 0x15f13fe2, 0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99,
+        0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f, 0x0b220dc1, 0xc07ede64,
+        0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+        0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f,
+        0x31286cb1, 0xfa74bf14, 0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676,
+        0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460, 0xf2e396b5, 0x39bf4510,
+        0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+        0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0,
+        0xcb3ff55e, 0x006326fb, 0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680,
+        0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496, 0x191c11ee, 0xd240c24b,
+        0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+        0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230,
+        0x2316709e, 0xe84aa33b, 0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db,
+        0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd, 0xf6999118, 0x3dc542bd,
+        0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+        0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07,
+        0xc7b1fda9, 0x0ced2e0c, 0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77,
+        0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61, 0x123e1c2f, 0xd962cf8a,
+        0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+        0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1,
+        0x28347d5f, 0xe368aefa, 0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c,
+        0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a, 0xfa1799ef, 0x314b4a4a,
+        0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+        0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa,
+        0xc3cbfa04, 0x089729a1, 0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da,
+        0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc
+    },
+    {
+        0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7,
+        0x63d0353a, 0xc5a73e8e, 0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa,
+        0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9, 0x67de9cce, 0xc1a9977a,
+        0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+        0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e,
+        0x37e1e793, 0x9196ec27, 0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301,
+        0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712, 0xfc5277fb, 0x5a257c4f,
+        0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+        0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5,
+        0xcbb39068, 0x6dc49bdc, 0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8,
+        0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb, 0x440b7579, 0xe27c7ecd,
+        0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+        0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9,
+        0x14340e24, 0xb2430590, 0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a,
+        0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739, 0x103aa7d0, 0xb64dac64,
+        0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+        0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342,
+        0xe86679df, 0x4e11726b, 0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f,
+        0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c, 0xec68d02b, 0x4a1fdb9f,
+        0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+        0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb,
+        0xbc57ab76, 0x1a20a0c2, 0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f,
+        0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c, 0xbbf9a495, 0x1d8eaf21,
+        0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+        0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b,
+        0x8c184306, 0x2a6f48b2, 0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6,
+        0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5, 0x47abd36e, 0xe1dcd8da,
+        0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+        0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae,
+        0x1794a833, 0xb1e3a387, 0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d,
+        0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e, 0x139a01c7, 0xb5ed0a73,
+        0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+        0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c,
+        0xafcdaab1, 0x09baa105, 0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71,
+        0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62, 0xabc30345, 0x0db408f1,
+        0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+        0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285,
+        0xfbfc7818, 0x5d8b73ac, 0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a,
+        0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899, 0x304fe870, 0x9638e3c4,
+        0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+        0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e,
+        0x07ae0fe3, 0xa1d90457, 0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23,
+        0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30
+    },
+    {
+        0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64,
+        0xc66f0987, 0x0ac50919, 0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56,
+        0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac, 0x7cbb312b, 0xb01131b5,
+        0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+        0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa,
+        0x69312319, 0xa59b2387, 0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5,
+        0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f, 0x2a9379e3, 0xe639797d,
+        0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+        0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19,
+        0x43a25afa, 0x8f085a64, 0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b,
+        0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1, 0x299dc2ed, 0xe537c273,
+        0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+        0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c,
+        0x3c17d0df, 0xf0bdd041, 0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425,
+        0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf, 0x86c3e873, 0x4a69e8ed,
+        0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+        0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf,
+        0x1684a93c, 0xda2ea9a2, 0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced,
+        0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217, 0xac509190, 0x60fa910e,
+        0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+        0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441,
+        0xb9da83a2, 0x7570833c, 0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239,
+        0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3, 0x80de9e6f, 0x4c749ef1,
+        0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+        0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95,
+        0xe9efbd76, 0x2545bde8, 0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7,
+        0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d, 0xaa4de78c, 0x66e7e712,
+        0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+        0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d,
+        0xbfc7f5be, 0x736df520, 0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144,
+        0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe, 0x0513cd12, 0xc9b9cd8c,
+        0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+        0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953,
+        0xbcc94eb0, 0x70634e2e, 0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61,
+        0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b, 0x061d761c, 0xcab77682,
+        0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+        0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd,
+        0x1397642e, 0xdf3d64b0, 0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282,
+        0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78, 0x50353ed4, 0x9c9f3e4a,
+        0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+        0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e,
+        0x39041dcd, 0xf5ae1d53, 0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c,
+        0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6
+    }
+};
+
+/**
+ * Update a reflected CRC register of up to 32 bits
+ * @param crc Current register value
+ * @param table Slicing-by-8 tables of the polynomial
+ * @param buffer Data buffer
+ * @param len Length of data buffer
+ * @return Updated register value
+ */
+static uint32_t crc_update(uint32_t crc, const uint32_t table[8][256],
+                           const uint8_t *buffer, size_t len) {
+    while (len >= 8) {
+        crc = table[7][(crc ^ buffer[0]) & 0xFF] ^
+              table[6][((crc >> 8) ^ buffer[1]) & 0xFF] ^
+              table[5][((crc >> 16) ^ buffer[2]) & 0xFF] ^
+              table[4][((crc >> 24) ^ buffer[3]) & 0xFF] ^
+              table[3][buffer[4]] ^ table[2][buffer[5]] ^
+              table[1][buffer[6]] ^ table[0][buffer[7]];
+        buffer += 8;
+        len -= 8;
+    }
+    while (len--) {
+        crc = (crc >> 8) ^ table[0][(crc ^ *buffer++) & 0xFF];
+    }
+    return crc;
+}
+
+#if THINKER_CRC_CLMUL
+/* Folding constants x^n mod P bit-reflected into 64 bits, n = 575, 511, 191, 127 */
+static const uint64_t crc24_fold[4] = {
+    0x2ddd010000000000ULL, 0x0428cc0000000000ULL, 0x4110000000000000ULL, 0x8448510000000000ULL};
+static const uint64_t crc32_fold[4] = {
+    0x653d982200000000ULL, 0xcad38e8f00000000ULL, 0x65673b4600000000ULL, 0x9ba54c6f00000000ULL};
+
+/**
+ * Fold a 128-bit block forward by the distance encoded in k and add data
+ * @param v Block to fold, low half holds the first 8 bytes
+ * @param k Constants for the low and high half
+ * @param data Block at the folding distance
+ * @return Block congruent to v shifted onto data
+ */
+__attribute__((target("pclmul,sse2")))
+static inline __m128i crc_fold(__m128i v, __m128i k, __m128i data) {
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(v, k, 0x00),
+                                       _mm_clmulepi64_si128(v, k, 0x11)),
+                         data);
+}
+
+/**
+ * Update a reflected CRC register with carry-less multiply folding
+ * Consumes a multiple of 16 bytes, at least 64; the caller handles the tail.
+ * @param crc Current register value
+ * @param table Slicing-by-8 tables of the polynomial
+ * @param fold Folding constants of the polynomial
+ * @param buffer Data buffer
+ * @param len Number of bytes to consume
+ * @return Updated register value
+ */
+__attribute__((target("pclmul,sse2")))
+static uint32_t crc_update_clmul(uint32_t crc, const uint32_t table[8][256],
+                                 const uint64_t fold[4], const uint8_t *buffer, size_t len) {
+    const __m128i k512 = _mm_set_epi64x((int64_t)fold[1], (int64_t)fold[0]);
+    const __m128i k128 = _mm_set_epi64x((int64_t)fold[3], (int64_t)fold[2]);
+    __m128i v0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)buffer),
+                               _mm_cvtsi32_si128((int32_t)crc));
+    __m128i v1 = _mm_loadu_si128((const __m128i *)(buffer + 16));
+    __m128i v2 = _mm_loadu_si128((const __m128i *)(buffer + 32));
+    __m128i v3 = _mm_loadu_si128((const __m128i *)(buffer + 48));
+    buffer += 64;
+    len -= 64;
+
+    while (len >= 64) {
+        v0 = crc_fold(v0, k512, _mm_loadu_si128((const __m128i *)buffer));
+        v1 = crc_fold(v1, k512, _mm_loadu_si128((const __m128i *)(buffer + 16)));
+        v2 = crc_fold(v2, k512, _mm_loadu_si128((const __m128i *)(buffer + 32)));
+        v3 = crc_fold(v3, k512, _mm_loadu_si128((const __m128i *)(buffer + 48)));
+        buffer += 64;
+        len -= 64;
+    }
+
+    v0 = crc_fold(v0, k128, v1);
+    v0 = crc_fold(v0, k128, v2);
+    v0 = crc_fold(v0, k128, v3);
+    while (len >= 16) {
+        v0 = crc_fold(v0, k128, _mm_loadu_si128((const __m128i *)buffer));
+        buffer += 16;
+        len -= 16;
+    }
+
+    // the folded block is congruent to all data consumed so far
+    uint8_t block[16];
+    _mm_storeu_si128((__m128i *)block, v0);
+    return crc_update(0, table, block, 16);
+}
+
+/**
+ * Check whether the host supports carry-less multiply
+ * @return 1 if supported
+ */
+static int32_t crc_has_clmul(void) {
+    static int32_t has_clmul = -1;
+    if (has_clmul < 0) {
+        __builtin_cpu_init();
+        has_clmul = __builtin_cpu_supports("pclmul") ? 1 : 0;
+    }
+    return has_clmul;
+}
+#endif
+
+uint32_t crc24_calc(const uint32_t init_vect, const uint8_t *buffer, uint32_t len) {
+    uint32_t crc = init_vect & 0x00FFFFFF;
+#if THINKER_CRC_CLMUL
+    if (len >= 64 && crc_has_clmul()) {
+        uint32_t bulk = len & ~15u;
+        crc = crc_update_clmul(crc, crc24_table, crc24_fold, buffer, bulk);
+        buffer += bulk;
+        len -= bulk;
+    }
+#endif
+    return crc_update(crc, crc24_table, buffer, len);
+}
+
+uint32_t crc32_calc(const uint8_t *data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+#if THINKER_CRC_CLMUL
+    if (length >= 64 && crc_has_clmul()) {
+        size_t bulk = length & ~(size_t)15;
+        crc = crc_update_clmul(crc, crc32_table, crc32_fold, data, bulk);
+        data += bulk;
+        length -= bulk;
+    }
+#endif
+    return crc_update(crc, crc32_table, data, length) ^ 0xFFFFFFFF;
+}
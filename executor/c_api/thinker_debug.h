@@ -229,65 +229,5 @@ void write_file(char *output_name, tTensor *tensor) {
 
 #endif  // end THINKER_DUMP
 
-// Performance profiling macros
-#if THINKER_PROFILE
-#ifdef WIN32
-#include <inttypes.h>
-#include <time.h>
-#elif defined linux
-#include <sys/time.h>
-#include <unistd.h>
-#else
-#include "core_feature_cache.h"
-#endif
-
-#define PROFILE_BEGIN double start_t = tick_count();
-
-#define PROFILE_END                                                          \
-  {                                                                          \
-    double finish_t = tick_count();                                          \
-    float total_t = (float)(finish_t - start_t);                             \
-    printf("%4d", (int32_t)(local_tensor[0]->shape_.dims_[0]));              \
-    for (uint32_t i = 1; i < local_tensor[0]->shape_.ndim_; ++i) {           \
-      printf(", %4d", (int32_t)(local_tensor[0]->shape_.dims_[i]));          \
-    }                                                                        \
-    printf(") | (");                                                         \
-    printf("%4d", (int32_t)(local_tensor[op->num_input_]->shape_.dims_[0])); \
-    for (uint32_t i = 1; i < local_tensor[op->num_input_]->shape_.ndim_;     \
-         ++i) {                                                              \
-      printf(", %4d",                                                        \
-             (int32_t)(local_tensor[op->num_input_]->shape_.dims_[i]));      \
-    }                                                                        \
-    if (strcmp(op_api->name(), "Conv2dInt") == 0) {                          \
-      typedef struct _ConvAttrs {                                            \
-      uint8_t dilation[3];                                                   \
-      uint16_t kernel[3];                                                    \
-      uint8_t pad[6];                                                        \
-      uint8_t stride[3];                                                     \
-      int16_t group;                                                         \
-      int16_t layout;                                                        \
-      uint8_t quant_type;                                                    \
-      uint8_t act_type;                                                      \
-      } _ConvAttrs;                                                          \
-      const _ConvAttrs *attrs =                                              \
-          (const _ConvAttrs *)((char *)op + op->attr_offset_);               \
-      printf(") | (");                                                       \
-      printf("%d", (int32_t)(local_tensor[1]->shape_.dims_[0]));             \
-      for (uint32_t i = 1; i < local_tensor[1]->shape_.ndim_; ++i) {         \
-        printf(", %d", (int32_t)(local_tensor[1]->shape_.dims_[i]));         \
-      }                                                                      \
-      printf(") | (%2d, %2d) | (%d, %d, %d, %d) | (%d, %d",                  \
-             (int32_t)attrs->kernel[0], (int32_t)attrs->kernel[1],           \
-             (int32_t)attrs->pad[0], (int32_t)attrs->pad[1],                 \
-             (int32_t)attrs->pad[2], (int32_t)attrs->pad[3],                 \
-             (int32_t)attrs->stride[0], (int32_t)attrs->stride[1]);          \
-    }                                                                        \
-    printf(")\n");                                                           \
-  }
-
-#else  // THINKER_PROFILE
-#define PROFILE_BEGIN
-#define PROFILE_END
-#endif
 
 #endif
\ No newline at end of file
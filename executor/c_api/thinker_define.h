@@ -65,10 +65,40 @@ typedef struct _thinker_ScalarGraph_
     int32_t  *nodes_;        // Nodes data
 } tScalarGraph;
 
+// Scalar register, an exact fraction in integer mode or a double otherwise
+typedef union _thinker_ScalarReg_
+{
+    struct {
+        int32_t  num_;           // Numerator
+        int32_t  den_;           // Denominator, always positive
+    } q_;
+    double       f_;
+} tScalarReg;
+
+// One lowered scalar instruction: dst_ = op_(a_, b_)
+typedef struct _thinker_ScalarCode_
+{
+    int32_t  op_;            // tScalarOpCode
+    int32_t  dst_;           // Destination register
+    int32_t  a_;             // First operand register
+    int32_t  b_;             // Second operand register, or exponent of POWI
+} tScalarCode;
+
+// Scalar graph lowered to a flat instruction array
+typedef struct _thinker_ScalarProgram_
+{
+    int32_t      is_int_;        // Evaluate with integer fractions instead of doubles
+    int32_t      num_code_;      // Number of instructions, excluding the end marker
+    int32_t      num_regs_;      // Number of registers
+    tScalarCode  *code_;         // Instructions
+    tScalarReg   *regs_;         // Initial registers: constants and folded nodes
+} tScalarProgram;
+
 // Shape inference structure
 typedef struct _thinker_ShapeInfer_
 {
     tScalarGraph  *graph_;         // Pointer to scalar graph
+    tScalarProgram program_;       // Lowered scalar graph
     tTenDimPair   *tid_pairs_;     // Tensor ID pairs
     tDyAxisInfo   *dynamic_axis_;  // Dynamic axis info
     uint32_t      num_id_pair_;    // Number of ID pairs
@@ -76,18 +106,60 @@ typedef struct _thinker_ShapeInfer_
     tMemory       inst_memory_;    // Instance memory
 } tShapeInfer;
 
+// Shape inference results of recent dynamic axis values, owned by an executor
+typedef struct _thinker_ShapeCache_
+{
+    int32_t       num_key_;        // Number of scalar graph inputs
+    int32_t       num_dim_;        // Number of ID pairs
+    int32_t       num_entry_;      // Number of valid entries
+    int32_t       next_;           // Entry replaced on the next miss
+    int32_t       last_;           // Entry currently applied to tensors, -1 if none
+    uint32_t      stamp_;          // Bumped whenever tensor dims are rewritten
+    tScalarReg    *keys_;          // Input values, num_key_ per entry
+    uint32_t      *dims_;          // Resulting dims, num_dim_ per entry
+} tShapeCache;
+
+// Capacity of the DMA list of an executor, larger resource tables are rejected
+#define THINKER_DMA_MAX 320       // weight prefetch entries
+#define THINKER_ACT_DMA_MAX 64    // activation spill and fill transfers
+
 // DMA structure
 typedef struct _thinker_DMA_ {
     uint32_t size_;          // Size of DMA transfer
+    uint32_t offset_;        // Offset of the weights in the burst they arrive with
     tTensor *src_tensors_;   // Source tensors
     tTensor *dst_tensors_;   // Destination tensors
 } thinkerDMA;
 
+// Activation spill or fill between PSRAM and share memory planned by tpacker
+typedef struct _thinker_ActDMA_ {
+    uint32_t size_;          // Size of DMA transfer
+    uint16_t issue_op_;      // Started once this operator returned
+    uint16_t wait_op_;       // Completed before the operator after this one runs
+    tTensor *src_tensors_;   // Source tensors
+    tTensor *dst_tensors_;   // Destination tensors
+} thinkerActDMA;
+
 // DMA list structure
 typedef struct _thinker_DMA_list_ {
     uint32_t cout_;         // Current count
     uint32_t total_;        // Total count
-    thinkerDMA dma_[320];   // Array of DMA operations
+    uint32_t use_;          // Entries handed to operators
+    uint32_t ready_;        // Entries known to be transferred
+    uint32_t depth_;        // Number of ring buffers the entries rotate through
+    uint32_t offset_;       // Offset of the weights handed out by the last getWeightData
+    uint32_t act_total_;    // Number of activation transfers
+    uint32_t act_cout_;     // Activation transfers issued
+    uint32_t act_ready_;    // Activation transfers known to be complete
+    uint64_t wait_;         // Ticks spent waiting for transfers, THINKER_PROFILE only
+    thinkerDMA dma_[THINKER_DMA_MAX];           // Array of DMA operations
+    thinkerActDMA act_[THINKER_ACT_DMA_MAX];    // Activation transfers, ordered by issue_op_
+#if THINKER_PROFILE
+    tDMARecord stat_[THINKER_DMA_MAX];          // Counters of each DMA operation
+#endif
+#if THINKER_STATS
+    tStats *stats_;         // Counters of the owning executor, charged on any thread
+#endif
 } tDMA_List;
 
 // Hyperparameter structure
@@ -0,0 +1,260 @@
+#include "op_scheduler.h"
+
+#include <stddef.h>
+
+#ifndef ALIGN16
+#define ALIGN16(n) ((n + 15) & ~15)
+#endif
+
+int32_t sched_graph_size(int32_t num_node, int32_t num_edge) {
+    int32_t size = 0;
+    size += ALIGN16(num_node * (int32_t)sizeof(tSchedNode));
+    size += ALIGN16(num_edge * (int32_t)sizeof(int32_t));
+    return size;
+}
+
+int32_t sched_state_size(int32_t num_node) {
+    int32_t size = 0;
+    size += ALIGN16(num_node * (int32_t)sizeof(int32_t));
+    size += ALIGN16(THINKER_SCHED_THREADS * num_node * (int32_t)sizeof(int32_t));
+    return size;
+}
+
+void sched_graph_init(tSchedGraph *graph, int8_t *ptr, int32_t num_node) {
+    graph->num_node_ = num_node;
+    graph->num_edge_ = 0;
+    graph->nodes_ = (tSchedNode *)ptr;
+    ptr += ALIGN16(num_node * (int32_t)sizeof(tSchedNode));
+    graph->succ_ = (int32_t *)ptr;
+    graph->pending_ = NULL;
+    graph->deque_ = NULL;
+
+    for (int32_t i = 0; i < num_node; i++) {
+        graph->nodes_[i].succ_offset_ = 0;
+        graph->nodes_[i].num_succ_ = 0;
+        graph->nodes_[i].num_pred_ = 0;
+    }
+}
+
+void sched_graph_link(tSchedGraph *graph) {
+    int32_t offset = 0;
+    for (int32_t i = 0; i < graph->num_node_; i++) {
+        graph->nodes_[i].succ_offset_ = offset;
+        offset += graph->nodes_[i].num_succ_;
+    }
+    graph->num_edge_ = offset;
+}
+
+void sched_state_init(tSchedGraph *graph, int8_t *ptr) {
+    graph->pending_ = (int32_t *)ptr;
+    ptr += ALIGN16(graph->num_node_ * (int32_t)sizeof(int32_t));
+    graph->deque_ = (int32_t *)ptr;
+}
+
+#if defined(linux)
+#include <pthread.h>
+
+#include "worker_pool.h"
+
+// Ready queue of one thread: the owner works at the bottom, thieves take the top
+typedef struct _t_SchedDeque_ {
+    pthread_mutex_t lock_;
+    int32_t top_;
+    int32_t bottom_;
+    int32_t *buf_;
+} tSchedDeque;
+
+typedef struct _t_SchedCtx_ {
+    tSchedGraph *graph_;
+    tSchedRunFunc run_;
+    void *arg_;
+    tSchedDeque deques_[THINKER_SCHED_THREADS];
+    pthread_mutex_t park_lock_;
+    pthread_cond_t park_cond_;  // ready operators were queued, the run ended or a helper left
+    int32_t num_ready_;         // operators queued and not taken yet
+    int32_t num_done_;
+    int32_t num_exited_;        // helpers that left sched_worker, guarded by park_lock_
+    int32_t status_;
+} tSchedCtx;
+
+typedef struct _t_SchedWorker_ {
+    tSchedCtx *ctx_;
+    int32_t id_;
+} tSchedWorker;
+
+static void deque_push(tSchedDeque *q, int32_t node) {
+    pthread_mutex_lock(&q->lock_);
+    q->buf_[q->bottom_++] = node;
+    pthread_mutex_unlock(&q->lock_);
+}
+
+static int32_t deque_pop(tSchedDeque *q) {
+    int32_t node = -1;
+    pthread_mutex_lock(&q->lock_);
+    if (q->bottom_ > q->top_) {
+        node = q->buf_[--q->bottom_];
+    }
+    pthread_mutex_unlock(&q->lock_);
+    return node;
+}
+
+static int32_t deque_steal(tSchedDeque *q) {
+    int32_t node = -1;
+    pthread_mutex_lock(&q->lock_);
+    if (q->bottom_ > q->top_) {
+        node = q->buf_[q->top_++];
+    }
+    pthread_mutex_unlock(&q->lock_);
+    return node;
+}
+
+static int32_t sched_finished(tSchedCtx *ctx) {
+    return __atomic_load_n(&ctx->num_done_, __ATOMIC_ACQUIRE) >= ctx->graph_->num_node_ ||
+           __atomic_load_n(&ctx->status_, __ATOMIC_ACQUIRE) != T_SUCCESS;
+}
+
+// Wake parked workers, all of them when the run ended
+static void sched_wake(tSchedCtx *ctx, int32_t all) {
+    pthread_mutex_lock(&ctx->park_lock_);
+    if (all) {
+        pthread_cond_broadcast(&ctx->park_cond_);
+    } else {
+        pthread_cond_signal(&ctx->park_cond_);
+    }
+    pthread_mutex_unlock(&ctx->park_lock_);
+}
+
+static void sched_worker(tSchedWorker *worker) {
+    tSchedCtx *ctx = worker->ctx_;
+    tSchedGraph *graph = ctx->graph_;
+    tSchedDeque *own = &ctx->deques_[worker->id_];
+
+    while (!sched_finished(ctx)) {
+        int32_t node = deque_pop(own);
+        for (int32_t k = 1; node < 0 && k < THINKER_SCHED_THREADS; k++) {
+            node = deque_steal(&ctx->deques_[(worker->id_ + k) % THINKER_SCHED_THREADS]);
+        }
+        if (node < 0) {
+            // park until an operator becomes ready, num_ready_ is raised before the signal
+            pthread_mutex_lock(&ctx->park_lock_);
+            while (__atomic_load_n(&ctx->num_ready_, __ATOMIC_ACQUIRE) == 0 && !sched_finished(ctx)) {
+                pthread_cond_wait(&ctx->park_cond_, &ctx->park_lock_);
+            }
+            pthread_mutex_unlock(&ctx->park_lock_);
+            continue;
+        }
+        __atomic_sub_fetch(&ctx->num_ready_, 1, __ATOMIC_ACQ_REL);
+
+        tStatus ret = ctx->run_(ctx->arg_, node);
+        if (ret != T_SUCCESS) {
+            int32_t expected = T_SUCCESS;
+            __atomic_compare_exchange_n(&ctx->status_, &expected, ret, 0,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+            sched_wake(ctx, 1);
+            break;
+        }
+
+        tSchedNode *n = graph->nodes_ + node;
+        int32_t num_ready = 0;
+        for (int32_t i = 0; i < n->num_succ_; i++) {
+            int32_t succ = graph->succ_[n->succ_offset_ + i];
+            if (__atomic_sub_fetch(&graph->pending_[succ], 1, __ATOMIC_ACQ_REL) == 0) {
+                __atomic_add_fetch(&ctx->num_ready_, 1, __ATOMIC_ACQ_REL);
+                deque_push(own, succ);
+                num_ready++;
+            }
+        }
+        // the worker keeps one operator for itself, others are handed to parked workers
+        for (int32_t i = 1; i < num_ready; i++) {
+            sched_wake(ctx, 0);
+        }
+        if (__atomic_add_fetch(&ctx->num_done_, 1, __ATOMIC_ACQ_REL) == graph->num_node_) {
+            sched_wake(ctx, 1);
+        }
+    }
+}
+
+// Pool job of a helper thread, leaves at once when the run already ended
+static void sched_helper(void *arg) {
+    tSchedWorker *worker = (tSchedWorker *)arg;
+    tSchedCtx *ctx = worker->ctx_;
+    sched_worker(worker);
+    pthread_mutex_lock(&ctx->park_lock_);
+    ctx->num_exited_++;
+    pthread_cond_broadcast(&ctx->park_cond_);
+    pthread_mutex_unlock(&ctx->park_lock_);
+}
+
+tStatus sched_run(tSchedGraph *graph, tSchedRunFunc run, void *arg) {
+    tSchedCtx ctx;
+    tSchedWorker workers[THINKER_SCHED_THREADS];
+    int32_t num_submit = 0;
+    int32_t num_helper = 0;
+    int32_t i;
+
+    ctx.graph_ = graph;
+    ctx.run_ = run;
+    ctx.arg_ = arg;
+    ctx.num_ready_ = 0;
+    ctx.num_done_ = 0;
+    ctx.num_exited_ = 0;
+    ctx.status_ = T_SUCCESS;
+    pthread_mutex_init(&ctx.park_lock_, NULL);
+    pthread_cond_init(&ctx.park_cond_, NULL);
+    for (i = 0; i < THINKER_SCHED_THREADS; i++) {
+        pthread_mutex_init(&ctx.deques_[i].lock_, NULL);
+        ctx.deques_[i].top_ = 0;
+        ctx.deques_[i].bottom_ = 0;
+        ctx.deques_[i].buf_ = graph->deque_ + i * graph->num_node_;
+        workers[i].ctx_ = &ctx;
+        workers[i].id_ = i;
+    }
+
+    // seed ready operators round robin so every thread starts with work
+    for (i = 0; i < graph->num_node_; i++) {
+        graph->pending_[i] = graph->nodes_[i].num_pred_;
+        if (graph->pending_[i] == 0) {
+            deque_push(&ctx.deques_[ctx.num_ready_ % THINKER_SCHED_THREADS], i);
+            ctx.num_ready_++;
+        }
+    }
+
+    // helpers run on the persistent worker pool; the caller alone can finish
+    // the graph, so helpers still queued behind busy workers are not needed
+    if (graph->num_node_ > 1 && worker_pool_init() == T_SUCCESS) {
+        for (i = 1; i < THINKER_SCHED_THREADS; i++) {
+            if (worker_pool_submit(sched_helper, &workers[i]) != T_SUCCESS) {
+                break;
+            }
+            num_submit++;
+        }
+    }
+    sched_worker(&workers[0]);
+    num_helper = num_submit;
+    for (i = 1; i <= num_submit; i++) {
+        num_helper -= worker_pool_cancel(sched_helper, &workers[i]);
+    }
+    pthread_mutex_lock(&ctx.park_lock_);
+    while (ctx.num_exited_ < num_helper) {
+        pthread_cond_wait(&ctx.park_cond_, &ctx.park_lock_);
+    }
+    pthread_mutex_unlock(&ctx.park_lock_);
+
+    for (i = 0; i < THINKER_SCHED_THREADS; i++) {
+        pthread_mutex_destroy(&ctx.deques_[i].lock_);
+    }
+    pthread_cond_destroy(&ctx.park_cond_);
+    pthread_mutex_destroy(&ctx.park_lock_);
+    return (tStatus)ctx.status_;
+}
+
+#else
+
+tStatus sched_run(tSchedGraph *graph, tSchedRunFunc run, void *arg) {
+    (void)graph;
+    (void)run;
+    (void)arg;
+    return T_ERR_NO_IMPLEMENTED;
+}
+
+#endif  // defined(linux)
@@ -0,0 +1,80 @@
+#ifndef _THINKER_OP_SCHEDULER_H_
+#define _THINKER_OP_SCHEDULER_H_
+
+#include <stdint.h>
+
+#include "thinker_status.h"
+
+// Number of threads (including the caller) executing ready operators
+#ifndef THINKER_SCHED_THREADS
+#define THINKER_SCHED_THREADS 4
+#endif
+
+// Dependency information of one operator
+typedef struct _t_SchedNode_ {
+    int32_t succ_offset_;   // Offset of successors in tSchedGraph::succ_
+    int32_t num_succ_;      // Number of successors
+    int32_t num_pred_;      // Number of predecessors
+} tSchedNode;
+
+// Operator dependency DAG, nodes_ and succ_ are built once per model and
+// shared by its executors, pending_ and deque_ belong to one executor
+typedef struct _t_SchedGraph_ {
+    int32_t num_node_;      // Number of operators
+    int32_t num_edge_;      // Number of dependencies
+    tSchedNode *nodes_;     // num_node_ nodes
+    int32_t *succ_;         // num_edge_ successor indices
+    int32_t *pending_;      // num_node_ runtime predecessor counters
+    int32_t *deque_;        // THINKER_SCHED_THREADS * num_node_ ready queue slots
+} tSchedGraph;
+
+typedef tStatus (*tSchedRunFunc)(void *ctx, int32_t node);  // Execute one operator
+
+/**
+ * Calculate buffer size of the dependencies of a scheduling graph
+ * @param num_node Number of operators
+ * @param num_edge Number of dependencies
+ * @return Size in bytes
+ */
+int32_t sched_graph_size(int32_t num_node, int32_t num_edge);
+
+/**
+ * Calculate buffer size of the runtime counters and ready queues of one executor
+ * @param num_node Number of operators
+ * @return Size in bytes
+ */
+int32_t sched_state_size(int32_t num_node);
+
+/**
+ * Lay out dependency buffers, node dependency counts are cleared and
+ * successors follow the nodes
+ * @param graph Graph to initialize
+ * @param ptr Buffer of sched_graph_size bytes
+ * @param num_node Number of operators
+ */
+void sched_graph_init(tSchedGraph *graph, int8_t *ptr, int32_t num_node);
+
+/**
+ * Assign successor offsets once the successors of every node are counted
+ * @param graph Graph with counted nodes
+ */
+void sched_graph_link(tSchedGraph *graph);
+
+/**
+ * Attach runtime counters and ready queues of one executor
+ * @param graph Graph sharing the dependencies of the model
+ * @param ptr Buffer of sched_state_size bytes
+ */
+void sched_state_init(tSchedGraph *graph, int8_t *ptr);
+
+/**
+ * Run all operators in dependency order, the caller steals work with helpers
+ * queued on the persistent worker pool
+ * @param graph Scheduling graph
+ * @param run Operator entry
+ * @param ctx Context passed to run
+ * @return First non-success status returned by run, otherwise T_SUCCESS
+ */
+tStatus sched_run(tSchedGraph *graph, tSchedRunFunc run, void *ctx);
+
+#endif  // _THINKER_OP_SCHEDULER_H_
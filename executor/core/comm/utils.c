@@ -52,33 +52,51 @@ tShape calcStride(const tShape *shape) {
 // Quantize float values to int8
 void quant(float *src, int8_t *dst, int32_t size, int8_t scale) {
     float scalef = (float)(1 << scale);
+    THINKER_OMP_PARALLEL_FOR(size)
     for (int32_t i = 0; i < size; ++i) {
         dst[i] = (int8_t)SATURATE_8BITS(floorf(scalef * src[i] + 0.5));
     }
 }
 
+// Check whether two byte ranges overlap
+static bool bufferOverlap(const void *a, size_t a_size, const void *b, size_t b_size) {
+    const int8_t *pa = (const int8_t *)a;
+    const int8_t *pb = (const int8_t *)b;
+    return pa < pb + b_size && pb < pa + a_size;
+}
+
+// Dequantization widens elements, so an in-place call must run backward and serially
+#define DEQUANT_LOOP(src, dst, size, scale1)                                  \
+    do {                                                                      \
+        if (bufferOverlap(src, (size) * sizeof(*(src)), dst,                  \
+                          (size) * sizeof(*(dst)))) {                         \
+            for (int32_t i = (size) - 1; i >= 0; --i) {                       \
+                (dst)[i] = (src)[i] * (scale1);                               \
+            }                                                                 \
+        } else {                                                              \
+            THINKER_OMP_PARALLEL_FOR(size)                                    \
+            for (int32_t i = 0; i < (size); ++i) {                            \
+                (dst)[i] = (src)[i] * (scale1);                               \
+            }                                                                 \
+        }                                                                     \
+    } while (0)
+
 // Dequantize int8 values to float
 void dequant8bit(int8_t *src, float *dst, int32_t size, int8_t scale) {
     float scale1 = 1.f / (1 << scale);
-    for (int32_t i = size - 1; i >= 0; --i) {
-        dst[i] = src[i] * scale1;
-    }
+    DEQUANT_LOOP(src, dst, size, scale1);
 }
 
 // Dequantize uint8 values to float
 void dequantU8bit(uint8_t *src, float *dst, int32_t size, int8_t scale) {
     float scale1 = 1.f / (1 << scale);
-    for (int32_t i = size - 1; i >= 0; --i) {
-        dst[i] = src[i] * scale1;
-    }
+    DEQUANT_LOOP(src, dst, size, scale1);
 }
 
 // Dequantize int32 values to float
 void dequant32bit(int32_t *src, float *dst, int32_t size, int8_t scale) {
     float scale1 = 1.f / (1 << scale);
-    for (int32_t i = size - 1; i >= 0; --i) {
-        dst[i] = src[i] * scale1;
-    }
+    DEQUANT_LOOP(src, dst, size, scale1);
 }
 
 // Convert 4-bit to 8-bit values with sign extension
@@ -112,33 +130,14 @@ void convert_4bitto32bit(int32_t *dst, int8_t *src, int32_t size) {
 
 void lunaDmaInit(void) { dma_init(); }
 
-void getWeightData(tDMA_List *dma_list, int32_t channel) {
-    dma_wait_complete(0);
-    if (dma_list->cout_ < dma_list->total_) {
-        int32_t index = dma_list->cout_;
-        tTensor *src = dma_list->dma_[index].src_tensors_;
-        tTensor *dst = dma_list->dma_[index].dst_tensors_;
-        int32_t size = dma_list->dma_[index].size_;
-        dma_cpy_async(0, (void *)dst->dptr_, (void *)src->dptr_, size);
-        dma_list->cout_++;
-    }
-}
+#define WEIGHT_DMA_CH   0               // Channel of the weight prefetch ring
 #elif THINKER_USE_ARCS
 #include "ops/arcs/luna/opi_psram_cpy.h"
 
-void getWeightData(tDMA_List *dma_list, int32_t channel) {
-    dma_wait_complete(0);
-    if (dma_list->cout_ < dma_list->total_) {
-        int32_t index = dma_list->cout_;
-        tTensor *src = dma_list->dma_[index].src_tensors_;
-        tTensor *dst = dma_list->dma_[index].dst_tensors_;
-        int32_t size = dma_list->dma_[index].size_;
-        dma_cpy_async(0, (void *)dst->dptr_, (void *)src->dptr_, size);
-        dma_list->cout_++;
-    }
-}
+#define WEIGHT_DMA_CH   0               // Channel of the weight prefetch ring
 
 void cpu_memcpy(void *dst, const void *src, size_t size) {
+    THINKER_STATS_COPY(memcpy, size);
 #if !(defined(WIN32) || defined(linux))
     if ((src != dst) && (0 != size)) memcpy(dst, src, size);
     if (((uint32_t)dst & 0x28000000) == 0x28000000) HAL_FlushDCache_by_Addr(dst, size);
@@ -185,23 +184,15 @@ void dma_cpy_async(int chn, void *dst, void *src, int32_t size) {
 }
 
 void opi_psram_cpy_out(void *dst, void *src, int32_t size) {
+    THINKER_STATS_COPY(memcpy, size);
     dma_cpy_async(ALG_DMA_CH, dst, src, size);
     dma_wait_complete(ALG_DMA_CH);
 }
 
-void getWeightData(tDMA_List *dma_list, int32_t channel) {
-    dma_wait_complete(ALG_DMA_CH);
-    if (dma_list->cout_ < dma_list->total_) {
-        int32_t index = dma_list->cout_;
-        tTensor *src = dma_list->dma_[index].src_tensors_;
-        tTensor *dst = dma_list->dma_[index].dst_tensors_;
-        int32_t size = dma_list->dma_[index].size_;
-        dma_cpy_async(ALG_DMA_CH, (int8_t *)dst->dptr_, (int8_t *)src->dptr_, size);
-        dma_list->cout_++;
-    }
-}
+#define WEIGHT_DMA_CH   ALG_DMA_CH      // Channel of the weight prefetch ring
 
 void cpu_memcpy(void *dst, const void *src, size_t size) {
+    THINKER_STATS_COPY(memcpy, size);
 #if !(defined(WIN32) || defined(linux))
     if ((src != dst) && (0 != size)) memcpy(dst, src, size);
     if (((uint32_t)dst & 0x28000000) == 0x28000000) HAL_FlushDCache_by_Addr(dst, size);
@@ -271,21 +262,157 @@ int32_t luna_execute_cmd_hook_for_build_list(const uint32_t *api, void* param, u
 #endif
 
 #ifdef WIN32
-double tick_count(void) {
+uint64_t tick_count(void) {
     struct timespec tv;
     timespec_get(&tv, 1);
-    return (double)(((int64_t)tv.tv_sec) * 1000 +
-                   ((int64_t)tv.tv_nsec) / 1000000.0);
+    return (uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_nsec / 1000;
 }
 #elif defined(linux)
-#include <sys/time.h>
-double tick_count(void) {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (double)(tv.tv_sec * 1000 * 1000 + tv.tv_usec) / 1000.0;
+#include <time.h>
+uint64_t tick_count(void) {
+    struct timespec tv;
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+    return (uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_nsec / 1000;
 }
 #else
 uint64_t tick_count(void) {
     return (uint64_t)__get_rv_cycle();
 }
-#endif
\ No newline at end of file
+#endif
+
+#if THINKER_PROFILE
+#if defined(linux)
+__thread uint64_t g_thinker_dma_wait = 0;
+#else
+uint64_t g_thinker_dma_wait = 0;
+#endif
+
+void profileDMAIssue(tDMA_List *dma_list, uint32_t index) {
+    tDMARecord *stat = dma_list->stat_ + index;
+    stat->bytes_ += dma_list->dma_[index].size_;
+    stat->issue_ = tick_count();
+    stat->done_ = 0;
+    stat->count_++;
+}
+
+void profileDMAWait(tDMA_List *dma_list, uint64_t wait_start) {
+    uint64_t now = tick_count();
+    dma_list->wait_ += now - wait_start;
+    g_thinker_dma_wait += now - wait_start;
+    if (dma_list->cout_ <= dma_list->ready_) return;
+    // the channel only holds the transfer issued last, parts of a burst have none
+    uint32_t index = dma_list->cout_ - 1;
+    while (index > 0 && dma_list->dma_[index].size_ == 0) index--;
+    tDMARecord *stat = dma_list->stat_ + index;
+    stat->wait_ += now - wait_start;
+    if (stat->done_ == 0 && stat->count_ > 0) {
+        stat->done_ = now;
+        stat->busy_ += now - stat->issue_;
+    }
+}
+#endif
+
+#ifdef WEIGHT_DMA_CH
+// The channel holds one transfer at a time, entries below ready_ are complete.
+// Activation spills and fills share it, a wait completes both kinds.
+void waitWeightData(tDMA_List *dma_list) {
+    if (dma_list->cout_ <= dma_list->ready_ && dma_list->act_cout_ <= dma_list->act_ready_) return;
+#if THINKER_PROFILE
+    uint64_t wait_start = tick_count();
+    dma_wait_complete(WEIGHT_DMA_CH);
+    profileDMAWait(dma_list, wait_start);
+#else
+    dma_wait_complete(WEIGHT_DMA_CH);
+#endif
+    dma_list->ready_ = dma_list->cout_;
+    dma_list->act_ready_ = dma_list->act_cout_;
+}
+
+static void issueWeightData(tDMA_List *dma_list) {
+    uint32_t index = dma_list->cout_;
+    tTensor *src = dma_list->dma_[index].src_tensors_;
+    tTensor *dst = dma_list->dma_[index].dst_tensors_;
+    int32_t size = dma_list->dma_[index].size_;
+    if (size > 0) {
+        dma_cpy_async(WEIGHT_DMA_CH, (void *)dst->dptr_, (void *)src->dptr_, size);
+        THINKER_STATS_DMA(dma_list, size);
+#if THINKER_PROFILE
+        profileDMAIssue(dma_list, index);
+#endif
+    }
+    dma_list->cout_++;
+    // part of a burst, complete together with it
+    if (size == 0 && dma_list->ready_ == index) {
+        dma_list->ready_ = dma_list->cout_;
+    }
+}
+
+void prefetchWeightData(tDMA_List *dma_list, uint32_t in_use) {
+    // entry i refills the ring slot of entry i - depth_, free once its operator returned
+    uint32_t limit = dma_list->use_ + dma_list->depth_ - in_use;
+    while (dma_list->cout_ < dma_list->total_ && dma_list->cout_ < limit) {
+        // an activation transfer in flight keeps the channel until its wait point
+        if (dma_list->act_cout_ > dma_list->act_ready_) break;
+        if (dma_list->cout_ > dma_list->ready_) {
+            // chaining waits on the transfer in flight, only worth it when it is short
+            uint32_t busy = dma_list->cout_ - 1;
+            while (busy > dma_list->ready_ && dma_list->dma_[busy].size_ == 0) busy--;
+            if (dma_list->dma_[busy].size_ > THINKER_DMA_CHAIN_SIZE) break;
+            waitWeightData(dma_list);
+        }
+        issueWeightData(dma_list);
+    }
+}
+
+void getWeightData(tDMA_List *dma_list, int32_t channel) {
+    uint32_t index = dma_list->use_;
+    if (index >= dma_list->cout_ && index < dma_list->total_) {
+        // not prefetched, only with a single buffer
+        waitWeightData(dma_list);
+        issueWeightData(dma_list);
+    }
+    if (index >= dma_list->ready_) {
+        waitWeightData(dma_list);
+    }
+    dma_list->offset_ = (index < dma_list->total_) ? dma_list->dma_[index].offset_ : 0;
+    dma_list->use_++;
+    prefetchWeightData(dma_list, 1);
+}
+
+void stepActivationData(tDMA_List *dma_list, int32_t op_index) {
+    // spills must leave share memory before it is reused, fills land before their reader
+    uint32_t k;
+    for (k = dma_list->act_ready_; k < dma_list->act_cout_; k++) {
+        if (dma_list->act_[k].wait_op_ <= op_index) {
+            waitWeightData(dma_list);
+            break;
+        }
+    }
+    while (dma_list->act_cout_ < dma_list->act_total_ &&
+           dma_list->act_[dma_list->act_cout_].issue_op_ <= op_index) {
+        thinkerActDMA *act = dma_list->act_ + dma_list->act_cout_;
+        waitWeightData(dma_list);
+        dma_cpy_async(WEIGHT_DMA_CH, (void *)act->dst_tensors_->dptr_,
+                      (void *)act->src_tensors_->dptr_, act->size_);
+        THINKER_STATS_DMA(dma_list, act->size_);
+        dma_list->act_cout_++;
+    }
+}
+#endif
+
+#if THINKER_STATS
+THINKER_STATS_TLS tStats *g_thinker_stats = NULL;
+#endif
+
+#ifdef THINKER_USE_ARCS
+// PSRAM copies of the platform library, operators call them through these to be counted
+void thinker_psram_cpy_out(void *dst, void *src, int32_t size) {
+    THINKER_STATS_COPY(memcpy, size);
+    opi_psram_cpy_out(dst, src, size);
+}
+
+void thinker_psram_cpy_in(void *dst, void *src, int32_t size) {
+    THINKER_STATS_COPY(memcpy, size);
+    opi_psram_cpy_in(dst, src, size);
+}
+#endif
@@ -40,6 +40,21 @@
 
 #define _FE_ROUND FE_TONEAREST                     // Floating point rounding mode
 
+// Parallel loops of host operators, loops below THINKER_OMP_MIN_SIZE elements stay serial
+#ifndef THINKER_OMP_MIN_SIZE
+#define THINKER_OMP_MIN_SIZE 16384
+#endif
+
+#define THINKER_PRAGMA(x) _Pragma(#x)
+#if THINKER_USE_OPENMP && THINKER_STATS && defined(linux)
+#define THINKER_OMP_PARALLEL_FOR(n) \
+    THINKER_PRAGMA(omp parallel for if((n) >= THINKER_OMP_MIN_SIZE) copyin(g_thinker_stats))
+#elif THINKER_USE_OPENMP
+#define THINKER_OMP_PARALLEL_FOR(n) THINKER_PRAGMA(omp parallel for if((n) >= THINKER_OMP_MIN_SIZE))
+#else
+#define THINKER_OMP_PARALLEL_FOR(n)
+#endif
+
 // Function declarations for shape operations
 bool equalShape(tShape *src, tShape *dst);         // Compare two shapes for equality
 size_t getShapeSize(tShape *shape);                // Calculate total elements in a shape
@@ -68,6 +83,8 @@ void getWeightData(tDMA_List *dma_list, int32_t channel);  // Get weight data vi
 #include "ops/arcs/luna/opi_psram_cpy.h"
 void getWeightData(tDMA_List *dma_list, int32_t channel);  // Get weight data via DMA
 void cpu_memcpy(void *dst, const void *src, size_t size);  // CPU memory copy function
+void thinker_psram_cpy_out(void *dst, void *src, int32_t size);  // opi_psram_cpy_out counted in the runtime stats
+void thinker_psram_cpy_in(void *dst, void *src, int32_t size);   // opi_psram_cpy_in counted in the runtime stats
 #endif
 
 // VenusA-specific functions
@@ -87,14 +104,65 @@ int32_t luna_execute_cmd_hook_for_build_list(const uint32_t *api, void* param, u
 #endif
 #endif
 
+#if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
+// Largest transfer in flight that prefetch waits on to start the next one
+#ifndef THINKER_DMA_CHAIN_SIZE
+#define THINKER_DMA_CHAIN_SIZE 2048
+#endif
+void waitWeightData(tDMA_List *dma_list);                       // Wait for the weight transfer in flight
+void prefetchWeightData(tDMA_List *dma_list, uint32_t in_use);  // Fill free ring buffers, in_use of them still read
+void stepActivationData(tDMA_List *dma_list, int32_t op_index); // Complete and start activation transfers after an op
+#endif
+
+// Runtime counters, operators count into the executor running on the calling thread.
+// The pointer is set for the duration of a forward and its operators, OpenMP
+// loops copy it into their threads. RTOS builds have no thread storage: each
+// forward puts back the pointer it found, so a forward preempting another on
+// a different task hands the counters back when it returns. DMA transfers
+// count into the executor owning the DMA list on every platform.
+#if THINKER_STATS
+#if defined(linux)
+#define THINKER_STATS_TLS __thread
+#define THINKER_STATS_ADD(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#elif defined(WIN32)
+#define THINKER_STATS_TLS __declspec(thread)
+#define THINKER_STATS_ADD(p, v) (*(p) += (v))
+#else
+#define THINKER_STATS_TLS
+#define THINKER_STATS_ADD(p, v) (*(p) += (v))
+#endif
+extern THINKER_STATS_TLS tStats *g_thinker_stats;
+#define THINKER_STATS_COUNT(stats, kind, bytes)                          \
+    do {                                                                 \
+        THINKER_STATS_ADD(&(stats)->kind##_count_, 1);                   \
+        THINKER_STATS_ADD(&(stats)->kind##_bytes_, (uint64_t)(bytes));   \
+    } while (0)
+#define THINKER_STATS_COPY(kind, bytes)                                  \
+    do {                                                                 \
+        if (g_thinker_stats) THINKER_STATS_COUNT(g_thinker_stats, kind, bytes); \
+    } while (0)
+#define THINKER_STATS_DMA(list, bytes)                                   \
+    do {                                                                 \
+        if ((list)->stats_) THINKER_STATS_COUNT((list)->stats_, dma, bytes); \
+    } while (0)
+#else
+#define THINKER_STATS_COUNT(stats, kind, bytes)
+#define THINKER_STATS_COPY(kind, bytes)
+#define THINKER_STATS_DMA(list, bytes)
+#endif
+
 #endif  // _THINKER_EXEC_CORE_CPU_ARM_UTILS_H_
 
-// Timer functions for profiling
+// Timer for profiling: microseconds on Windows/Linux, CPU cycles on embedded systems
 #if THINKER_PROFILE
-#if defined(WIN32) || defined(linux)
-double tick_count(void);                           // High-resolution timer for Windows/Linux
+uint64_t tick_count(void);
+void profileDMAIssue(tDMA_List *dma_list, uint32_t index);      // Count a started DMA entry
+void profileDMAWait(tDMA_List *dma_list, uint64_t wait_start);  // Count a wait on the entry in flight
+// DMA wait ticks of the calling thread, an operator is charged the growth while it runs
+#if defined(linux)
+extern __thread uint64_t g_thinker_dma_wait;
 #else
-uint64_t tick_count(void);                         // High-resolution timer for embedded systems
+extern uint64_t g_thinker_dma_wait;
 #endif
 #endif
 
@@ -0,0 +1,156 @@
+#include "worker_pool.h"
+
+#if defined(linux)
+#include <pthread.h>
+
+typedef struct _t_WorkerJob_ {
+    tWorkerFunc func_;
+    void *arg_;
+} tWorkerJob;
+
+typedef struct _t_WorkerPool_ {
+    pthread_mutex_t lock_;
+    pthread_cond_t job_cond_;
+    pthread_cond_t state_cond_;     // signaled when a stop finished joining the threads
+    pthread_t threads_[THINKER_WORKER_NUM];
+    tWorkerJob jobs_[THINKER_WORKER_QUEUE_SIZE];
+    int32_t head_;
+    int32_t count_;
+    int32_t num_thread_;
+    int32_t running_;
+    int32_t stopping_;              // threads are being joined, threads_ is still in use
+} tWorkerPool;
+
+static tWorkerPool g_pool = {
+    .lock_ = PTHREAD_MUTEX_INITIALIZER,
+    .job_cond_ = PTHREAD_COND_INITIALIZER,
+    .state_cond_ = PTHREAD_COND_INITIALIZER,
+};
+
+// Worker thread loop: pop jobs until the pool is stopped and drained
+static void *worker_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&g_pool.lock_);
+        while (g_pool.count_ == 0 && g_pool.running_) {
+            pthread_cond_wait(&g_pool.job_cond_, &g_pool.lock_);
+        }
+        if (g_pool.count_ == 0) {
+            pthread_mutex_unlock(&g_pool.lock_);
+            break;
+        }
+        tWorkerJob job = g_pool.jobs_[g_pool.head_];
+        g_pool.head_ = (g_pool.head_ + 1) % THINKER_WORKER_QUEUE_SIZE;
+        g_pool.count_--;
+        pthread_mutex_unlock(&g_pool.lock_);
+
+        job.func_(job.arg_);
+    }
+    return NULL;
+}
+
+tStatus worker_pool_init(void) {
+    tStatus ret = T_SUCCESS;
+    pthread_mutex_lock(&g_pool.lock_);
+    while (g_pool.stopping_) {
+        pthread_cond_wait(&g_pool.state_cond_, &g_pool.lock_);
+    }
+    if (!g_pool.running_) {
+        g_pool.running_ = 1;
+        g_pool.head_ = 0;
+        g_pool.count_ = 0;
+        g_pool.num_thread_ = 0;
+        for (int32_t i = 0; i < THINKER_WORKER_NUM; i++) {
+            if (pthread_create(&g_pool.threads_[i], NULL, worker_main, NULL) != 0) {
+                break;
+            }
+            g_pool.num_thread_++;
+        }
+        if (g_pool.num_thread_ == 0) {
+            g_pool.running_ = 0;
+            ret = T_ERR_FAIL;
+        }
+    }
+    pthread_mutex_unlock(&g_pool.lock_);
+    return ret;
+}
+
+void worker_pool_fini(void) {
+    pthread_mutex_lock(&g_pool.lock_);
+    while (g_pool.stopping_) {
+        pthread_cond_wait(&g_pool.state_cond_, &g_pool.lock_);
+    }
+    if (!g_pool.running_) {
+        pthread_mutex_unlock(&g_pool.lock_);
+        return;
+    }
+    g_pool.running_ = 0;
+    g_pool.stopping_ = 1;
+    pthread_cond_broadcast(&g_pool.job_cond_);
+    pthread_mutex_unlock(&g_pool.lock_);
+
+    // init and fini wait for stopping_ to clear, so threads_ is not touched meanwhile
+    for (int32_t i = 0; i < g_pool.num_thread_; i++) {
+        pthread_join(g_pool.threads_[i], NULL);
+    }
+
+    pthread_mutex_lock(&g_pool.lock_);
+    g_pool.num_thread_ = 0;
+    g_pool.stopping_ = 0;
+    pthread_cond_broadcast(&g_pool.state_cond_);
+    pthread_mutex_unlock(&g_pool.lock_);
+}
+
+tStatus worker_pool_submit(tWorkerFunc func, void *arg) {
+    pthread_mutex_lock(&g_pool.lock_);
+    if (!g_pool.running_ || g_pool.count_ == THINKER_WORKER_QUEUE_SIZE) {
+        pthread_mutex_unlock(&g_pool.lock_);
+        return T_ERR_FAIL;
+    }
+    int32_t tail = (g_pool.head_ + g_pool.count_) % THINKER_WORKER_QUEUE_SIZE;
+    g_pool.jobs_[tail].func_ = func;
+    g_pool.jobs_[tail].arg_ = arg;
+    g_pool.count_++;
+    pthread_cond_signal(&g_pool.job_cond_);
+    pthread_mutex_unlock(&g_pool.lock_);
+    return T_SUCCESS;
+}
+
+int32_t worker_pool_cancel(tWorkerFunc func, void *arg) {
+    int32_t removed = 0;
+    pthread_mutex_lock(&g_pool.lock_);
+    for (int32_t i = 0; i < g_pool.count_; i++) {
+        tWorkerJob *job = g_pool.jobs_ + (g_pool.head_ + i) % THINKER_WORKER_QUEUE_SIZE;
+        if (job->func_ == func && job->arg_ == arg) {
+            removed++;
+        } else if (removed > 0) {
+            g_pool.jobs_[(g_pool.head_ + i - removed) % THINKER_WORKER_QUEUE_SIZE] = *job;
+        }
+    }
+    g_pool.count_ -= removed;
+    pthread_mutex_unlock(&g_pool.lock_);
+    return removed;
+}
+
+#else
+
+tStatus worker_pool_init(void) {
+    return T_ERR_NO_IMPLEMENTED;
+}
+
+void worker_pool_fini(void) {
+}
+
+tStatus worker_pool_submit(tWorkerFunc func, void *arg) {
+    (void)func;
+    (void)arg;
+    return T_ERR_NO_IMPLEMENTED;
+}
+
+int32_t worker_pool_cancel(tWorkerFunc func, void *arg) {
+    (void)func;
+    (void)arg;
+    return 0;
+}
+
+#endif  // defined(linux)
@@ -0,0 +1,49 @@
+#ifndef _THINKER_WORKER_POOL_H_
+#define _THINKER_WORKER_POOL_H_
+
+#include <stdint.h>
+
+#include "thinker_status.h"
+
+// Number of worker threads serving asynchronous requests and scheduler
+// helpers on host builds
+#ifndef THINKER_WORKER_NUM
+#define THINKER_WORKER_NUM 4
+#endif
+
+// Maximum number of pending jobs in the worker queue
+#ifndef THINKER_WORKER_QUEUE_SIZE
+#define THINKER_WORKER_QUEUE_SIZE 64
+#endif
+
+typedef void (*tWorkerFunc)(void *arg);  // Job entry executed by a worker thread
+
+/**
+ * Start worker threads, safe to call more than once
+ * @return Status code, T_ERR_NO_IMPLEMENTED on targets without threads
+ */
+tStatus worker_pool_init(void);
+
+/**
+ * Stop worker threads after the queued jobs are finished
+ * Concurrent worker_pool_init calls wait until the threads are joined.
+ */
+void worker_pool_fini(void);
+
+/**
+ * Queue a job for the worker threads
+ * @param func Job entry
+ * @param arg Argument passed to func
+ * @return Status code
+ */
+tStatus worker_pool_submit(tWorkerFunc func, void *arg);
+
+/**
+ * Remove queued jobs that no worker has taken yet
+ * @param func Job entry
+ * @param arg Argument the jobs were submitted with
+ * @return Number of jobs removed
+ */
+int32_t worker_pool_cancel(tWorkerFunc func, void *arg);
+
+#endif  // _THINKER_WORKER_POOL_H_
@@ -2,29 +2,67 @@
 #include <stdlib.h>
 #include <string.h>
 
-// Static array to store registered operators
-static tOperatorAPI op_list[128] = {{0}};
+// Hash buckets of registered operators, chained through tOperatorAPI::next_
+static tOperatorAPI *op_buckets[THINKER_OP_BUCKETS] = {0};
 // Counter for number of registered operators
 static int32_t op_count = 0;
 
+/**
+ * Compute the registry hash of an operator name (FNV-1a).
+ * @param op_name: Name of the operator.
+ * @return: 32-bit hash value.
+ */
+uint32_t OperatorNameHash(const char *op_name) {
+    uint32_t hash = 2166136261u;
+    while (*op_name) {
+        hash ^= (uint8_t)(*op_name++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Find a registered operator in the bucket of a hash.
+ * @param op_name: Name of the operator.
+ * @param hash: Hash of op_name.
+ * @return: Pointer to the operator API or NULL if not found.
+ */
+static tOperatorAPI *findOperatorAPI(const char *op_name, uint32_t hash) {
+    tOperatorAPI *api = op_buckets[hash & (THINKER_OP_BUCKETS - 1)];
+    while (api != NULL) {
+        if (api->hash_ == hash && strcmp(op_name, api->name()) == 0) {
+            return api;
+        }
+        api = api->next_;
+    }
+    return NULL;
+}
+
 /**
  * Register a new operator API.
+ * The entry is linked into the registry and must stay valid afterwards.
  * @param api: The operator API structure to register.
- * @return: Operator ID on success, -1 if already exists.
+ * @return: Operator ID on success, -1 if another operator has the same name.
  */
-int32_t RegistryOperatorAPI(tOperatorAPI api) {
-    // Check if operator with same name already exists
-    for (int32_t i = 0; i < op_count; ++i) {
-        if (strcmp(api.name(), op_list[i].name()) == 0) {
-            return -1;
-        }
+int32_t RegistryOperatorAPI(tOperatorAPI *api) {
+    // Registered again by init_ops_list after the constructor
+    if (api->id_ >= 0) {
+        return api->id_;
     }
 
-    // Add the new operator to the list
-    int32_t op_id = op_count;
-    op_list[op_id] = api;
+    const char *op_name = api->name();
+    uint32_t hash = OperatorNameHash(op_name);
+    if (findOperatorAPI(op_name, hash) != NULL) {
+        return -1;
+    }
+
+    // Add the new operator to the head of its bucket
+    api->hash_ = hash;
+    api->id_ = op_count;
+    api->next_ = op_buckets[hash & (THINKER_OP_BUCKETS - 1)];
+    op_buckets[hash & (THINKER_OP_BUCKETS - 1)] = api;
     ++op_count;
-    return op_id;
+    return api->id_;
 }
 
 /**
@@ -33,16 +71,11 @@ int32_t RegistryOperatorAPI(tOperatorAPI api) {
  * @return: Pointer to the operator API or NULL if not found.
  */
 tOperatorAPI *GetOperatorAPI(const char *op_name) {
-    for (int32_t i = 0; i < op_count; ++i) {
-        if (strcmp(op_name, op_list[i].name()) == 0) {
-            return &(op_list[i]);
-        }
-    }
-    return NULL;
+    return findOperatorAPI(op_name, OperatorNameHash(op_name));
 }
 
 /**
  * Get total count of registered operators.
  * @return: Number of registered operators.
  */
-int32_t GetOperatorCount() { return op_count; }
\ No newline at end of file
+int32_t GetOperatorCount() { return op_count; }
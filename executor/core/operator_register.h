@@ -25,6 +25,11 @@ extern "C" {
 #define CONCAT(f, __OP__) CONCAT_(f, __OP__)
 #define X(f) CONCAT(f, __OP__)
 
+// Number of hash buckets of the operator registry, must be a power of two
+#ifndef THINKER_OP_BUCKETS
+#define THINKER_OP_BUCKETS 64
+#endif
+
 // Structure defining the interface for an operator
 typedef struct tOperatorAPI {
     const char *(*name)();              // Function pointer to get operator name
@@ -34,10 +39,15 @@ typedef struct tOperatorAPI {
     int32_t (*fini)(tOperator *op, tTensor **tensors, int32_t num_tensor);                        // Finalization function
 
     int32_t (*forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_List *list);    // Forward pass function
+
+    uint32_t hash_;                     // Hash of the operator name, set on registration
+    int32_t id_;                        // Registration order, -1 until registered
+    struct tOperatorAPI *next_;         // Next operator in the same hash bucket
 } tOperatorAPI;
 
 // Function declarations
-int32_t RegistryOperatorAPI(tOperatorAPI api);
+uint32_t OperatorNameHash(const char *op_name);
+int32_t RegistryOperatorAPI(tOperatorAPI *api);
 tOperatorAPI *GetOperatorAPI(const char *op_name);
 int32_t GetOperatorCount();
 
@@ -27,17 +27,15 @@ int32_t X(Fini)(tOperator *op, tTensor **tensors, int32_t num_tensor) {
 }
 #endif
 
+// Operator entry linked into the registry, no copy is made on registration
+static tOperatorAPI X(API) = {X(Name), NULL, X(Init), X(Fini), X(Forward), 0, -1, NULL};
+
 // Constructor-like registration function called at startup
 #ifdef __GNUC__
 __attribute__((constructor))
 #endif
 int32_t X(Registry)() {
-    tOperatorAPI api;
-    api.name = X(Name);
-    api.init = X(Init);
-    api.fini = X(Fini);
-    api.forward = X(Forward);
-    RegistryOperatorAPI(api);
+    RegistryOperatorAPI(&X(API));
     return 0;
 }
 
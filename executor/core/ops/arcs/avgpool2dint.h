@@ -8,6 +8,9 @@
 #else
 #include "luna/luna_math.h"
 #include "luna/luna_cnn_tools.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 #include "core/comm/utils.h"
@@ -9,6 +9,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
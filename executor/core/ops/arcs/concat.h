@@ -11,6 +11,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 #include "thinker_status.h"
@@ -97,7 +100,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
             ret = API_LIB(memcpy_i8o8)(dst, src, hw_curr);
           } 
           else {
-            opi_psram_cpy_out(dst, src, hw_curr);
+            thinker_psram_cpy_out(dst, src, hw_curr);
             ret = T_SUCCESS;
           }
         } 
@@ -151,7 +154,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
                 ret = API_LIB(scale_i8i8o8)(src + past_size, 1, tmp_ptr, cur_size, (input_scale - output_scale));
               }
 
-              opi_psram_cpy_out(dst + past_size, tmp_ptr, cur_size);
+              thinker_psram_cpy_out(dst + past_size, tmp_ptr, cur_size);
               past_size += cur_size;
             }
           }
@@ -175,7 +178,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
                 ret = API_LIB(scale_i8i8o8)(tmp_ptr, 1, tmp_ptr, cur_size, (input_scale - output_scale));
               }
 
-              opi_psram_cpy_out(dst + past_size, tmp_ptr, cur_size);
+              thinker_psram_cpy_out(dst + past_size, tmp_ptr, cur_size);
               past_size += cur_size;
             }
           }
@@ -210,7 +213,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
                 ret = API_LIB(memcpy_i8o8)(output_ptr, indptr_curr, trailing * tensors[i]->shape_.dims_[axis]);
               }
               else {
-                opi_psram_cpy_out(output_ptr, indptr_curr, trailing * tensors[i]->shape_.dims_[axis]);
+                thinker_psram_cpy_out(output_ptr, indptr_curr, trailing * tensors[i]->shape_.dims_[axis]);
                 ret = T_SUCCESS;
               }
             }
@@ -243,7 +246,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
               }
 
               ret = API_LIB(scale_i8i8o8)(src_ptr, scalar, tmp, hw_curr, shift);
-              opi_psram_cpy_out(dst + l * hw, tmp, hw_curr);
+              thinker_psram_cpy_out(dst + l * hw, tmp, hw_curr);
             }
           }
           dst  += hw_curr;
@@ -274,7 +277,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
         		ret = API_LIB(memcpy_i8o8)((int8_t *)dst + i * hw_curr * 2, (int8_t *)src, hw_curr * 2);
         	}
         	else {
-        		opi_psram_cpy_out((int8_t *)dst + i * hw_curr * 2, (int8_t *)src, hw_curr * 2);
+        		thinker_psram_cpy_out((int8_t *)dst + i * hw_curr * 2, (int8_t *)src, hw_curr * 2);
         		ret = T_SUCCESS;
         	}
         }
@@ -308,7 +311,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
             	ret = API_LIB(memcpy_i8o8)((int8_t *)output_ptr, (int8_t *)indptr_curr, hw_curr * 2);
             }
             else {
-            	opi_psram_cpy_out((int8_t *)output_ptr, (int8_t *)indptr_curr, hw_curr * 2);
+            	thinker_psram_cpy_out((int8_t *)output_ptr, (int8_t *)indptr_curr, hw_curr * 2);
             	ret = T_SUCCESS;
             }
           }
@@ -353,7 +356,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
 			  continue;
 
 			if (input_scale == output_scale) {
-				opi_psram_cpy_out(dst, src, hw_curr * 4);
+				thinker_psram_cpy_out(dst, src, hw_curr * 4);
 				dst += hw_curr;
 				ret = T_SUCCESS;
 			}
@@ -402,7 +405,7 @@ int32_t concat_luna(tTensor **tensors, int32_t axis, int32_t input_num, tTensor
 			  for (int32_t l = 0; l < leading; l++) {
 				int32_t *indptr_curr = (int32_t *)src + l * hw_curr;
 				int32_t *output_ptr  = (int32_t *)dst + l * hw + i * hw_curr;
-				opi_psram_cpy_out((int8_t *)output_ptr, (int8_t *)indptr_curr, hw_curr * 4);
+				thinker_psram_cpy_out((int8_t *)output_ptr, (int8_t *)indptr_curr, hw_curr * 4);
 				ret = T_SUCCESS;
 			  }
 			}
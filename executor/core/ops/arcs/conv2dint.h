@@ -14,6 +14,9 @@
 #else
 #include "luna/luna_math.h"
 #include "luna/luna_cnn_tools.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 #include "thinker_status.h"
@@ -160,7 +163,7 @@ int32_t conv2dint_luna(tTensor *X, tTensor *W, tTensor *Bias, tTensor *Y, tTenso
             }
 
             if (ou_is_psram) {
-                opi_psram_cpy_out((int8_t *)Y->dptr_, dst, output_c * ou_h * ou_w);
+                thinker_psram_cpy_out((int8_t *)Y->dptr_, dst, output_c * ou_h * ou_w);
             }
         } else if (attrs->group == input_c && attrs->group == output_c) { // Depthwise convolution
             ret = luna_split_conv_para_pack(&conv_attrs, &conv_static_para, LUNA_DEPTHWISE);
@@ -179,7 +182,7 @@ int32_t conv2dint_luna(tTensor *X, tTensor *W, tTensor *Bias, tTensor *Y, tTenso
             }
 
             if (ou_is_psram) {
-                opi_psram_cpy_out((int8_t *)Y->dptr_, dst, output_c * ou_h * ou_w);
+                thinker_psram_cpy_out((int8_t *)Y->dptr_, dst, output_c * ou_h * ou_w);
             }
         } else { // Group convolution, should be split in tpacker
             return T_ERR_INVALID_PARA;
@@ -31,7 +31,7 @@ int32_t flatten_luna(tTensor *X, tTensor *Y, FlattenAttrs *attr) {
         if (Y->mem_.type_ == 2) {
             return API_LIB(memcpy_i8o8)(output, input, size);
         } else {
-            opi_psram_cpy_out(output, input, size);
+            thinker_psram_cpy_out(output, input, size);
             return T_SUCCESS;
         }
     }
@@ -71,7 +71,7 @@ int32_t gather_luna(tTensor *X, tTensor *indices, tTensor *Y, GatherAttrs *attr)
                                                   input + (l * middle * tail + idx * tail) * X->byte_,
                                                   X->byte_ * tail);
                     else {
-                        opi_psram_cpy_out(output + (l * ndim * tail + j * tail) * X->byte_,
+                        thinker_psram_cpy_out(output + (l * ndim * tail + j * tail) * X->byte_,
                                          input + (l * middle * tail + idx * tail) * X->byte_,
                                          X->byte_ * tail);
                         ret = T_SUCCESS;
@@ -91,7 +91,7 @@ int32_t gather_luna(tTensor *X, tTensor *indices, tTensor *Y, GatherAttrs *attr)
                                               input + (l * middle * tail + idx * tail) * X->byte_,
                                               X->byte_ * tail);
                 else {
-                    opi_psram_cpy_out(output + (l * ndim * tail + j * tail) * X->byte_,
+                    thinker_psram_cpy_out(output + (l * ndim * tail + j * tail) * X->byte_,
                                      input + (l * middle * tail + idx * tail) * X->byte_,
                                      X->byte_ * tail);
                     ret = T_SUCCESS;
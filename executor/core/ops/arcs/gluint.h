@@ -13,6 +13,9 @@
 #else
 #include "luna/luna_math.h"
 #include "luna/luna_matrix_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -0,0 +1,492 @@
+#define LUNA_HOST_IMPL
+#include <string.h>
+#include "luna_host.h"
+#include "thinker_status.h"
+
+#if defined(__AVX2__) || defined(__AVX512VNNI__)
+#include <immintrin.h>
+#endif
+
+#define LUNA_HOST_MAGIC 0x4C484F53      // "LHOS"
+#define LUNA_HOST_PATCH_MAX 8192        // bytes of one im2col row, luna bounds a kernel pair to 8KB
+#define LUNA_HOST_ROW_MAX 256           // output pixels accumulated at once by depthwise
+
+// Geometry kept at the start of luna_cnn_static_para_t by the host packer
+typedef struct _luna_host_conv_ {
+    conv_struct_t conv_;
+    int32_t type_;
+    uint32_t magic_;
+} tLunaHostConv;
+
+typedef char tLunaHostConvFits[(sizeof(tLunaHostConv) <= sizeof(luna_cnn_static_para_t)) ? 1 : -1];
+
+// Requantization of one accumulator
+typedef struct _luna_host_quant_ {
+    int32_t shift_;
+    int32_t floor_;
+    int32_t neg_shift_;
+    int32_t neg_floor_;
+    int32_t prelu_;
+    int32_t relu_;
+    int32_t bits_;
+} tLunaHostQuant;
+
+static inline int64_t hostShift(int64_t acc, int32_t shift, int32_t floor) {
+    shift = (shift > 63) ? 63 : shift;
+    if (floor || shift == 0) {
+        return acc >> shift;
+    }
+    return (acc + ((int64_t)1 << (shift - 1))) >> shift;
+}
+
+static inline void hostStore(const tLunaHostQuant *q, int64_t acc, void *dst, int32_t index) {
+    int64_t v = (q->prelu_ && acc < 0) ? hostShift(acc, q->neg_shift_, q->neg_floor_)
+                                       : hostShift(acc, q->shift_, q->floor_);
+    if (q->bits_ == 8) {
+        v = (v > 127) ? 127 : ((v < -128) ? -128 : v);
+        ((int8_t *)dst)[index] = (int8_t)((q->relu_ && v < 0) ? 0 : v);
+    } else {
+        v = (v > INT32_MAX) ? INT32_MAX : ((v < INT32_MIN) ? INT32_MIN : v);
+        ((int32_t *)dst)[index] = (int32_t)((q->relu_ && v < 0) ? 0 : v);
+    }
+}
+
+// Element of a packed int4 array, the low nibble holds the even element
+static inline int32_t hostNibble(const int8_t *p, int64_t index) {
+    int8_t b = p[index >> 1];
+    return (index & 1) ? (b >> 4) : ((int8_t)(b << 4) >> 4);
+}
+
+/**
+ * @brief Dot products of one im2col row with a pair of output kernels
+ * @param w Kernel pair in the tpacker layout [group][2][8], int4 packed if w4
+ * @param x im2col row [group][8]
+ * @param groups Number of 8-channel groups
+ * @param w4 Weights are int4
+ * @param x_sum Sum of the im2col row
+ * @param acc Dot products of the even and odd kernel
+ */
+static void hostPairDot(const int8_t *w, const int8_t *x, int32_t groups, int32_t w4, int32_t x_sum,
+                        int32_t *acc) {
+    int32_t g = 0;
+    acc[0] = 0;
+    acc[1] = 0;
+#if defined(__AVX512VNNI__)
+    // unsigned weights w + 128 (int4: w + 8) against signed data, the offset
+    // times the data sum is removed at the end
+    const __m512i pair = _mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0);
+    __m512i sum = _mm512_setzero_si512();
+    if (w4) {
+        const __m512i order = _mm512_set_epi64(7, 6, 3, 2, 5, 4, 1, 0);
+        const __m256i low = _mm256_set1_epi8(0x0F);
+        const __m512i bias = _mm512_set1_epi8(0x08);
+        for (; g < groups; g += 4) {
+            int32_t n = (groups - g < 4) ? (groups - g) : 4;
+            __m256i v = _mm256_maskz_loadu_epi8((__mmask32)((n == 4) ? 0xFFFFFFFFu : ((1u << (8 * n)) - 1)), w + g * 8);
+            __m256i lo = _mm256_and_si256(v, low);
+            __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low);
+            __m512i u = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_unpacklo_epi8(lo, hi)),
+                                           _mm256_unpackhi_epi8(lo, hi), 1);
+            u = _mm512_xor_si512(_mm512_permutexvar_epi64(order, u), bias);
+            __m256i xv = _mm256_maskz_loadu_epi8((__mmask32)((n == 4) ? 0xFFFFFFFFu : ((1u << (8 * n)) - 1)), x + g * 8);
+            sum = _mm512_dpbusd_epi32(sum, u, _mm512_permutexvar_epi64(pair, _mm512_castsi256_si512(xv)));
+        }
+        acc[0] = _mm512_mask_reduce_add_epi32(0x3333, sum) - 8 * x_sum;
+        acc[1] = _mm512_mask_reduce_add_epi32(0xCCCC, sum) - 8 * x_sum;
+    } else {
+        const __m512i bias = _mm512_set1_epi8((char)0x80);
+        for (; g < groups; g += 4) {
+            int32_t n = (groups - g < 4) ? (groups - g) : 4;
+            __mmask64 wm = (n == 4) ? ~(__mmask64)0 : (((__mmask64)1 << (16 * n)) - 1);
+            __m512i u = _mm512_xor_si512(_mm512_maskz_loadu_epi8(wm, w + g * 16), bias);
+            __m256i xv = _mm256_maskz_loadu_epi8((__mmask32)((n == 4) ? 0xFFFFFFFFu : ((1u << (8 * n)) - 1)), x + g * 8);
+            sum = _mm512_dpbusd_epi32(sum, u, _mm512_permutexvar_epi64(pair, _mm512_castsi256_si512(xv)));
+        }
+        acc[0] = _mm512_mask_reduce_add_epi32(0x3333, sum) - 128 * x_sum;
+        acc[1] = _mm512_mask_reduce_add_epi32(0xCCCC, sum) - 128 * x_sum;
+    }
+    return;
+#elif defined(__AVX2__)
+    // widen to int16 and madd, lanes 0-3 hold the even kernel and 4-7 the odd one
+    __m256i sum = _mm256_setzero_si256();
+    (void)x_sum;
+    for (; g < groups; g++) {
+        __m256i wv;
+        if (w4) {
+            __m128i b = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(w + g * 8)));
+            __m128i lo = _mm_srai_epi16(_mm_slli_epi16(b, 12), 12);
+            __m128i hi = _mm_srai_epi16(b, 4);
+            wv = _mm256_set_m128i(_mm_unpackhi_epi16(lo, hi), _mm_unpacklo_epi16(lo, hi));
+        } else {
+            wv = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(w + g * 16)));
+        }
+        __m128i xv = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)(x + g * 8)));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(wv, _mm256_broadcastsi128_si256(xv)));
+    }
+    __m128i even = _mm256_castsi256_si128(sum);
+    __m128i odd = _mm256_extracti128_si256(sum, 1);
+    __m128i t = _mm_hadd_epi32(even, odd);
+    t = _mm_hadd_epi32(t, t);
+    acc[0] = _mm_cvtsi128_si32(t);
+    acc[1] = _mm_extract_epi32(t, 1);
+    return;
+#else
+    (void)x_sum;
+    for (; g < groups; g++) {
+        for (int32_t o = 0; o < 2; o++) {
+            for (int32_t c = 0; c < 8; c++) {
+                int32_t index = g * 16 + o * 8 + c;
+                int32_t wv = w4 ? hostNibble(w, index) : w[index];
+                acc[o] += wv * x[g * 8 + c];
+            }
+        }
+    }
+#endif
+}
+
+/**
+ * @brief acc[i] += wv * x[i * stride] for one row of output pixels
+ */
+static void hostRowMac(int32_t *acc, const int8_t *x, int32_t stride, int32_t wv, int32_t num) {
+    int32_t i = 0;
+    if (stride == 1) {
+#if defined(__AVX512VNNI__)
+        __m512i vw = _mm512_set1_epi32(wv);
+        for (; i + 16 <= num; i += 16) {
+            __m512i xv = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(x + i)));
+            __m512i a = _mm512_loadu_si512(acc + i);
+            _mm512_storeu_si512(acc + i, _mm512_add_epi32(a, _mm512_mullo_epi32(xv, vw)));
+        }
+#elif defined(__AVX2__)
+        __m256i vw = _mm256_set1_epi32(wv);
+        for (; i + 8 <= num; i += 8) {
+            __m256i xv = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(x + i)));
+            __m256i a = _mm256_loadu_si256((const __m256i *)(acc + i));
+            _mm256_storeu_si256((__m256i *)(acc + i), _mm256_add_epi32(a, _mm256_mullo_epi32(xv, vw)));
+        }
+#endif
+    }
+    for (; i < num; i++) {
+        acc[i] += wv * x[i * stride];
+    }
+}
+
+static void hostQuantInit(const conv_struct_t *conv, int32_t out_bits, tLunaHostQuant *q) {
+    q->shift_ = conv->positive_shift_value;
+    q->floor_ = (conv->positive_shift_type == ShiftType_Floor);
+    q->neg_shift_ = conv->positive_shift_value + conv->negative_shift_value;
+    q->neg_floor_ = (conv->negative_shift_type == ShiftType_Floor);
+    q->prelu_ = (conv->activation_type == PRELU);
+    q->relu_ = (conv->activation_type == RELU);
+    q->bits_ = out_bits;
+}
+
+static const conv_struct_t *hostConvGet(const luna_cnn_static_para_t *para) {
+    const tLunaHostConv *host = (const tLunaHostConv *)para;
+    return (host->magic_ == LUNA_HOST_MAGIC) ? &host->conv_ : NULL;
+}
+
+/**
+ * @brief Convolution with group 1, NCHW data and tpacker weights
+ *        [out/2][kh][kw][in/8][2][8]
+ */
+static int32_t hostConv(const int8_t *p_in, const int8_t *p_weight, const int32_t *p_bias, void *p_out,
+                        const luna_cnn_static_para_t *para, int32_t w4, int32_t out_bits) {
+    const conv_struct_t *conv = hostConvGet(para);
+    if (conv == NULL) {
+        return T_ERR_INVALID_PARA;
+    }
+    int32_t in_c = conv->input_c, in_h = conv->input_h, in_w = conv->input_w;
+    int32_t ou_c = conv->output_c, ou_h = conv->output_h, ou_w = conv->output_w;
+    int32_t k_h = conv->weight_h, k_w = conv->weight_w;
+    int32_t s_h = conv->stride_h, s_w = conv->stride_w;
+    int32_t d_h = conv->dilation_h ? conv->dilation_h : 1;
+    int32_t d_w = conv->dilation_w ? conv->dilation_w : 1;
+    int32_t c_align = (in_c + 7) & ~7;
+    int32_t patch = k_h * k_w * c_align;
+    int32_t pair_bytes = w4 ? patch : patch * 2;
+    int32_t groups = patch / 8;
+    int8_t x[LUNA_HOST_PATCH_MAX];
+    tLunaHostQuant q;
+
+    if (patch > LUNA_HOST_PATCH_MAX) {
+        return T_ERR_INVALID_PARA;
+    }
+    hostQuantInit(conv, out_bits, &q);
+    p_bias = conv->is_bias ? p_bias : NULL;
+    memset(x, 0, patch);
+
+    for (int32_t oh = 0; oh < ou_h; oh++) {
+        for (int32_t ow = 0; ow < ou_w; ow++) {
+            int32_t x_sum = 0;
+            for (int32_t i = 0; i < k_h; i++) {
+                int32_t ih = oh * s_h - conv->padding_h_up + i * d_h;
+                for (int32_t j = 0; j < k_w; j++) {
+                    int32_t iw = ow * s_w - conv->padding_w_left + j * d_w;
+                    int8_t *row = x + (i * k_w + j) * c_align;
+                    if (ih < 0 || ih >= in_h || iw < 0 || iw >= in_w) {
+                        memset(row, 0, in_c);
+                        continue;
+                    }
+                    const int8_t *src = p_in + ih * in_w + iw;
+                    for (int32_t c = 0; c < in_c; c++) {
+                        row[c] = src[c * in_h * in_w];
+                        x_sum += row[c];
+                    }
+                }
+            }
+            int32_t pixel = oh * ou_w + ow;
+            for (int32_t o = 0; o < ou_c; o += 2) {
+                int32_t acc[2];
+                hostPairDot(p_weight + (o / 2) * pair_bytes, x, groups, w4, x_sum, acc);
+                hostStore(&q, (int64_t)acc[0] + (p_bias ? p_bias[o] : 0), p_out, o * ou_h * ou_w + pixel);
+                if (o + 1 < ou_c) {
+                    hostStore(&q, (int64_t)acc[1] + (p_bias ? p_bias[o + 1] : 0), p_out,
+                              (o + 1) * ou_h * ou_w + pixel);
+                }
+            }
+        }
+    }
+    return T_SUCCESS;
+}
+
+/**
+ * @brief Depthwise convolution with NCHW data and tpacker weights [c/8][kh][kw][8]
+ */
+static int32_t hostDepthwise(const int8_t *p_in, const int8_t *p_weight, const int32_t *p_bias, void *p_out,
+                             const luna_cnn_static_para_t *para, int32_t w4, int32_t out_bits) {
+    const conv_struct_t *conv = hostConvGet(para);
+    if (conv == NULL) {
+        return T_ERR_INVALID_PARA;
+    }
+    int32_t in_h = conv->input_h, in_w = conv->input_w;
+    int32_t ou_c = conv->output_c, ou_h = conv->output_h, ou_w = conv->output_w;
+    int32_t k_h = conv->weight_h, k_w = conv->weight_w;
+    int32_t s_h = conv->stride_h, s_w = conv->stride_w;
+    int32_t d_h = conv->dilation_h ? conv->dilation_h : 1;
+    int32_t d_w = conv->dilation_w ? conv->dilation_w : 1;
+    int32_t pad_t = conv->padding_h_up, pad_l = conv->padding_w_left;
+    int32_t acc[LUNA_HOST_ROW_MAX];
+    tLunaHostQuant q;
+
+    hostQuantInit(conv, out_bits, &q);
+    p_bias = conv->is_bias ? p_bias : NULL;
+
+    for (int32_t o = 0; o < ou_c; o++) {
+        const int8_t *src = p_in + o * in_h * in_w;
+        int32_t w_base = (o / 8) * k_h * k_w * 8 + o % 8;
+        for (int32_t oh = 0; oh < ou_h; oh++) {
+            for (int32_t ow0 = 0; ow0 < ou_w; ow0 += LUNA_HOST_ROW_MAX) {
+                int32_t num = (ou_w - ow0 < LUNA_HOST_ROW_MAX) ? (ou_w - ow0) : LUNA_HOST_ROW_MAX;
+                for (int32_t n = 0; n < num; n++) {
+                    acc[n] = 0;
+                }
+                for (int32_t i = 0; i < k_h; i++) {
+                    int32_t ih = oh * s_h - pad_t + i * d_h;
+                    if (ih < 0 || ih >= in_h) {
+                        continue;
+                    }
+                    for (int32_t j = 0; j < k_w; j++) {
+                        int32_t index = w_base + (i * k_w + j) * 8;
+                        int32_t wv = w4 ? hostNibble(p_weight, index) : p_weight[index];
+                        // output pixels whose input column lies inside the row
+                        int32_t off = j * d_w - pad_l;
+                        int32_t lo = (off >= 0) ? 0 : (-off + s_w - 1) / s_w;
+                        int32_t hi = (in_w - 1 - off >= 0) ? (in_w - 1 - off) / s_w + 1 : 0;
+                        lo = (lo > ow0) ? lo - ow0 : 0;
+                        hi = (hi - ow0 < num) ? hi - ow0 : num;
+                        if (lo < hi) {
+                            hostRowMac(acc + lo, src + ih * in_w + (ow0 + lo) * s_w + off, s_w, wv, hi - lo);
+                        }
+                    }
+                }
+                for (int32_t n = 0; n < num; n++) {
+                    hostStore(&q, (int64_t)acc[n] + (p_bias ? p_bias[o] : 0), p_out,
+                              (o * ou_h + oh) * ou_w + ow0 + n);
+                }
+            }
+        }
+    }
+    return T_SUCCESS;
+}
+
+/**
+ * @brief dst[row][col2] = src1[row][col] * src2[col][col2] (+ bias[row]), row major
+ */
+static int32_t hostMatMul(const int8_t *src1, int32_t a4, const int8_t *src2, const int32_t *bias, void *dst,
+                          int32_t out_bits, int32_t row, int32_t col, int32_t col2, int32_t shift) {
+    tLunaHostQuant q = {shift, 0, shift, 0, 0, 0, out_bits};
+    int32_t m = 0;
+#if defined(__AVX512VNNI__) || defined(__AVX2__)
+    // blocks of 4 rows against 16 (8 on AVX2) columns, 4 (2) depth steps per multiply
+#if defined(__AVX512VNNI__)
+    const int32_t step = 4, tile = 16;
+#else
+    const int32_t step = 2, tile = 8;
+#endif
+    for (; m + 4 <= row; m += 4) {
+        int32_t a_sum[4] = {0, 0, 0, 0};
+        for (int32_t r = 0; r < 4; r++) {
+            for (int32_t k = 0; k < col; k++) {
+                a_sum[r] += a4 ? hostNibble(src1, (int64_t)(m + r) * col + k) : src1[(m + r) * col + k];
+            }
+        }
+        for (int32_t n = 0; n < col2; n += tile) {
+            int32_t num = (col2 - n < tile) ? (col2 - n) : tile;
+            int32_t out[4][16];
+#if defined(__AVX512VNNI__)
+            __mmask16 mask = (__mmask16)((num == 16) ? 0xFFFF : ((1u << num) - 1));
+            __m512i acc[4] = {_mm512_setzero_si512(), _mm512_setzero_si512(), _mm512_setzero_si512(),
+                              _mm512_setzero_si512()};
+            const __m128i flip = _mm_set1_epi8((char)0x80);
+#else
+            __m256i acc[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(),
+                              _mm256_setzero_si256()};
+#endif
+            for (int32_t k = 0; k < col; k += step) {
+#if defined(__AVX512VNNI__)
+                // [n][k..k+3] as unsigned b + 128, rows past col are zero
+                __m128i b[4];
+                for (int32_t s = 0; s < 4; s++) {
+                    b[s] = (k + s < col) ? _mm_maskz_loadu_epi8(mask, src2 + (k + s) * col2 + n) : _mm_setzero_si128();
+                }
+                __m128i t0 = _mm_unpacklo_epi8(b[0], b[1]), t1 = _mm_unpackhi_epi8(b[0], b[1]);
+                __m128i t2 = _mm_unpacklo_epi8(b[2], b[3]), t3 = _mm_unpackhi_epi8(b[2], b[3]);
+                __m512i u = _mm512_castsi128_si512(_mm_xor_si128(_mm_unpacklo_epi16(t0, t2), flip));
+                u = _mm512_inserti32x4(u, _mm_xor_si128(_mm_unpackhi_epi16(t0, t2), flip), 1);
+                u = _mm512_inserti32x4(u, _mm_xor_si128(_mm_unpacklo_epi16(t1, t3), flip), 2);
+                u = _mm512_inserti32x4(u, _mm_xor_si128(_mm_unpackhi_epi16(t1, t3), flip), 3);
+                for (int32_t r = 0; r < 4; r++) {
+                    int32_t pack = 0;
+                    for (int32_t s = 0; s < 4 && k + s < col; s++) {
+                        int32_t av = a4 ? hostNibble(src1, (int64_t)(m + r) * col + k + s) : src1[(m + r) * col + k + s];
+                        pack |= (av & 0xFF) << (8 * s);
+                    }
+                    acc[r] = _mm512_dpbusd_epi32(acc[r], u, _mm512_set1_epi32(pack));
+                }
+#else
+                // [n][k, k+1] as int16 pairs, rows and columns past the end are zero
+                __m128i r0, r1 = _mm_setzero_si128();
+                if (num == 8) {
+                    r0 = _mm_loadl_epi64((const __m128i *)(src2 + k * col2 + n));
+                    if (k + 1 < col) {
+                        r1 = _mm_loadl_epi64((const __m128i *)(src2 + (k + 1) * col2 + n));
+                    }
+                } else {
+                    int8_t b0[8] = {0}, b1[8] = {0};
+                    memcpy(b0, src2 + k * col2 + n, num);
+                    if (k + 1 < col) {
+                        memcpy(b1, src2 + (k + 1) * col2 + n, num);
+                    }
+                    r0 = _mm_loadl_epi64((const __m128i *)b0);
+                    r1 = _mm_loadl_epi64((const __m128i *)b1);
+                }
+                r0 = _mm_cvtepi8_epi16(r0);
+                r1 = _mm_cvtepi8_epi16(r1);
+                __m256i v = _mm256_set_m128i(_mm_unpackhi_epi16(r0, r1), _mm_unpacklo_epi16(r0, r1));
+                for (int32_t r = 0; r < 4; r++) {
+                    int64_t base = (int64_t)(m + r) * col + k;
+                    int32_t a0 = a4 ? hostNibble(src1, base) : src1[base];
+                    int32_t a1 = (k + 1 < col) ? (a4 ? hostNibble(src1, base + 1) : src1[base + 1]) : 0;
+                    __m256i av = _mm256_set1_epi32((int32_t)(((uint32_t)a0 & 0xFFFF) | ((uint32_t)a1 << 16)));
+                    acc[r] = _mm256_add_epi32(acc[r], _mm256_madd_epi16(v, av));
+                }
+#endif
+            }
+            for (int32_t r = 0; r < 4; r++) {
+#if defined(__AVX512VNNI__)
+                _mm512_storeu_si512(out[r], _mm512_sub_epi32(acc[r], _mm512_set1_epi32(128 * a_sum[r])));
+#else
+                _mm256_storeu_si256((__m256i *)out[r], acc[r]);
+                (void)a_sum;
+#endif
+                for (int32_t i = 0; i < num; i++) {
+                    hostStore(&q, (int64_t)out[r][i] + (bias ? bias[m + r] : 0), dst, (m + r) * col2 + n + i);
+                }
+            }
+        }
+    }
+#endif
+    for (; m < row; m++) {
+        for (int32_t n = 0; n < col2; n++) {
+            int64_t acc = bias ? bias[m] : 0;
+            for (int32_t k = 0; k < col; k++) {
+                int32_t av = a4 ? hostNibble(src1, (int64_t)m * col + k) : src1[m * col + k];
+                acc += av * src2[k * col2 + n];
+            }
+            hostStore(&q, acc, dst, m * col2 + n);
+        }
+    }
+    return T_SUCCESS;
+}
+
+int32_t luna_host_split_conv_para_pack(conv_struct_t *conv_st, luna_cnn_static_para_t *p_cnn_static_para, int32_t cnn_layer_type) {
+    int32_t ret = luna_split_conv_para_pack(conv_st, p_cnn_static_para, cnn_layer_type);
+    if (ret != 0) {
+        return ret;
+    }
+    // pooling and deconvolution keep running in the simulator
+    if (cnn_layer_type == LUNA_CONV || cnn_layer_type == LUNA_DEPTHWISE ||
+        cnn_layer_type == LUNA_CONV1D || cnn_layer_type == LUNA_DEPTHWISE1D) {
+        tLunaHostConv *host = (tLunaHostConv *)p_cnn_static_para;
+        host->conv_ = *conv_st;
+        host->type_ = cnn_layer_type;
+        host->magic_ = LUNA_HOST_MAGIC;
+    }
+    return ret;
+}
+
+#define LUNA_HOST_CONV(name, kernel, w4, out_type, bits)                                                    \
+    int32_t luna_host_##name(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, out_type *p_out,        \
+                             luna_cnn_static_para_t *conv_para_) {                                          \
+        return kernel(p_in, p_weight, p_bias, p_out, conv_para_, w4, bits);                                 \
+    }
+
+LUNA_HOST_CONV(conv2d_i8i4o8, hostConv, 1, int8_t, 8)
+LUNA_HOST_CONV(conv2d_i8i4o32, hostConv, 1, int32_t, 32)
+LUNA_HOST_CONV(conv2d_i8i8o8, hostConv, 0, int8_t, 8)
+LUNA_HOST_CONV(conv2d_i8i8o32, hostConv, 0, int32_t, 32)
+LUNA_HOST_CONV(depthwise2d_i8i4o8, hostDepthwise, 1, int8_t, 8)
+LUNA_HOST_CONV(depthwise2d_i8i4o32, hostDepthwise, 1, int32_t, 32)
+LUNA_HOST_CONV(depthwise2d_i8i8o8, hostDepthwise, 0, int8_t, 8)
+LUNA_HOST_CONV(depthwise2d_i8i8o32, hostDepthwise, 0, int32_t, 32)
+LUNA_HOST_CONV(conv1d_i8i4o8, hostConv, 1, int8_t, 8)
+LUNA_HOST_CONV(conv1d_i8i4o32, hostConv, 1, int32_t, 32)
+LUNA_HOST_CONV(conv1d_i8i8o8, hostConv, 0, int8_t, 8)
+LUNA_HOST_CONV(conv1d_i8i8o32, hostConv, 0, int32_t, 32)
+LUNA_HOST_CONV(depthwise1d_i8i4o8, hostDepthwise, 1, int8_t, 8)
+LUNA_HOST_CONV(depthwise1d_i8i4o32, hostDepthwise, 1, int32_t, 32)
+LUNA_HOST_CONV(depthwise1d_i8i8o8, hostDepthwise, 0, int8_t, 8)
+LUNA_HOST_CONV(depthwise1d_i8i8o32, hostDepthwise, 0, int32_t, 32)
+
+int32_t luna_host_mat_mul_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 0, src2, NULL, dst, 8, row, col, col2, shift);
+}
+
+int32_t luna_host_mat_mul_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 0, src2, NULL, dst, 32, row, col, col2, shift);
+}
+
+int32_t luna_host_split_mat_mul_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 0, src2, NULL, dst, 8, row, col, col2, shift);
+}
+
+int32_t luna_host_split_mat_mul_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 0, src2, NULL, dst, 32, row, col, col2, shift);
+}
+
+int32_t luna_host_split_mat_mul_bias_i8i8i32o8(const int8_t *src1, const int8_t *src2, const int32_t *bias, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 0, src2, bias, dst, 8, row, col, col2, shift);
+}
+
+int32_t luna_host_split_mat_mul_bias_i8i8i32o32(const int8_t *src1, const int8_t *src2, const int32_t *bias, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 0, src2, bias, dst, 32, row, col, col2, shift);
+}
+
+int32_t luna_host_split_mat_mul_bias_i4i8i32o8(const int8_t *src1, const int8_t *src2, const int32_t *bias, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 1, src2, bias, dst, 8, row, col, col2, shift);
+}
+
+int32_t luna_host_split_mat_mul_bias_i4i8i32o32(const int8_t *src1, const int8_t *src2, const int32_t *bias, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift) {
+    return hostMatMul(src1, 1, src2, bias, dst, 32, row, col, col2, shift);
+}
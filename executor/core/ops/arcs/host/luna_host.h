@@ -0,0 +1,155 @@
+#ifndef __LUNA_HOST_H__
+#define __LUNA_HOST_H__
+
+#include <stdint.h>
+#include "../luna/luna_math.h"
+#include "../luna/luna_cnn_tools.h"
+
+/*
+ * Host kernels for the luna convolution and matrix subset used by conv1dint,
+ * conv2dint, linearint and bmmint, bit-exact with the simulator library
+ * (floor(x + 0.5) or floor shift, PRELU negatives shifted by the sum of both
+ * shifts, saturation to the output width, ReLU after saturation), and for
+ * the element-wise, activation and softmax vectors of the recurrent and
+ * attention operators (luna_host_vec.c).
+ * Built when THINKER_LUNA_HOST is not OFF; the operators include this header
+ * after the luna headers and the macros below redirect their calls, every
+ * other luna api still runs in the simulator.
+ */
+
+/**
+ * @brief Pack convolution parameters, the simulator packer checks them and
+ *        the geometry is kept in the static parameters for the host kernels
+ * @param conv_st Convolution structure
+ * @param p_cnn_static_para Static parameters to fill
+ * @param cnn_layer_type LUNA_CNN_OP
+ * @return int32_t Execution status
+ */
+int32_t luna_host_split_conv_para_pack(conv_struct_t *conv_st, luna_cnn_static_para_t *p_cnn_static_para, int32_t cnn_layer_type);
+
+int32_t luna_host_conv2d_i8i4o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_conv2d_i8i4o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_conv2d_i8i8o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_conv2d_i8i8o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+
+int32_t luna_host_depthwise2d_i8i4o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_depthwise2d_i8i4o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_depthwise2d_i8i8o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_depthwise2d_i8i8o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+
+int32_t luna_host_conv1d_i8i4o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_conv1d_i8i4o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_conv1d_i8i8o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_conv1d_i8i8o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+
+int32_t luna_host_depthwise1d_i8i4o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_depthwise1d_i8i4o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_depthwise1d_i8i8o8(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int8_t *p_out, luna_cnn_static_para_t *conv_para_);
+int32_t luna_host_depthwise1d_i8i8o32(const int8_t *p_in, int8_t *p_weight, int32_t *p_bias, int32_t *p_out, luna_cnn_static_para_t *conv_para_);
+
+int32_t luna_host_mat_mul_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_mat_mul_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_split_mat_mul_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_split_mat_mul_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_split_mat_mul_bias_i8i8i32o8(const int8_t *src1, const int8_t *src2, const int32_t *bias, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_split_mat_mul_bias_i8i8i32o32(const int8_t *src1, const int8_t *src2, const int32_t *bias, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_split_mat_mul_bias_i4i8i32o8(const int8_t *src1, const int8_t *src2, const int32_t *bias, int8_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+int32_t luna_host_split_mat_mul_bias_i4i8i32o32(const int8_t *src1, const int8_t *src2, const int32_t *bias, int32_t *dst, uint32_t row, uint32_t col, uint32_t col2, uint32_t shift);
+
+int32_t luna_host_add_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_add_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_add_i32i32o8(const int32_t *src1, const int32_t *src2, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_add_i32i32o32(const int32_t *src1, const int32_t *src2, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_sub_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_sub_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_sub_i32i32o8(const int32_t *src1, const int32_t *src2, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_sub_i32i32o32(const int32_t *src1, const int32_t *src2, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_mul_i8i8o8(const int8_t *src1, const int8_t *src2, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_mul_i8i8o32(const int8_t *src1, const int8_t *src2, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_mul_i32i32o8(const int32_t *src1, const int32_t *src2, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_mul_i32i32o32(const int32_t *src1, const int32_t *src2, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_scale_i8i8o8(const int8_t *src1, const int8_t scalar, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_scale_i8i8o32(const int8_t *src1, const int8_t scalar, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_scale_i32i32o8(const int32_t *src1, const int32_t scalar, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_scale_i32i32o32(const int32_t *src1, const int32_t scalar, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_offset_i8i8o8(const int8_t *src1, const int8_t scalar, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_offset_i8i8o32(const int8_t *src1, const int8_t scalar, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_offset_i32i32o8(const int32_t *src1, const int32_t scalar, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_offset_i32i32o32(const int32_t *src1, const int32_t scalar, int32_t *dst, uint32_t size, uint32_t shift);
+
+int32_t luna_host_relu_i8o8(const int8_t *src, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_relu_i8o32(const int8_t *src, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_relu_i32o8(const int32_t *src, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_relu_i32o32(const int32_t *src, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_prelu_i8o8(const int8_t *src, uint32_t slope, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_prelu_i8o32(const int8_t *src, uint32_t slope, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_prelu_i32o8(const int32_t *src, uint32_t slope, int8_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_prelu_i32o32(const int32_t *src, uint32_t slope, int32_t *dst, uint32_t size, uint32_t shift);
+int32_t luna_host_sigmoid_i32o32(const int32_t *src, int32_t *dst, uint32_t size);
+int32_t luna_host_sigmoid_i32o8(const int32_t *src, int8_t *dst, uint32_t size);
+int32_t luna_host_tanh_i32o32(const int32_t *src, int32_t *dst, uint32_t size);
+int32_t luna_host_tanh_i32o8(const int32_t *src, int8_t *dst, uint32_t size);
+int32_t luna_host_softmax_i32o32(const int32_t *src, int32_t *dst, uint32_t size);
+
+#ifndef LUNA_HOST_IMPL
+#define luna_split_conv_para_pack luna_host_split_conv_para_pack
+#define luna_conv2d_i8i4o8 luna_host_conv2d_i8i4o8
+#define luna_conv2d_i8i4o32 luna_host_conv2d_i8i4o32
+#define luna_conv2d_i8i8o8 luna_host_conv2d_i8i8o8
+#define luna_conv2d_i8i8o32 luna_host_conv2d_i8i8o32
+#define luna_depthwise2d_i8i4o8 luna_host_depthwise2d_i8i4o8
+#define luna_depthwise2d_i8i4o32 luna_host_depthwise2d_i8i4o32
+#define luna_depthwise2d_i8i8o8 luna_host_depthwise2d_i8i8o8
+#define luna_depthwise2d_i8i8o32 luna_host_depthwise2d_i8i8o32
+#define luna_conv1d_i8i4o8 luna_host_conv1d_i8i4o8
+#define luna_conv1d_i8i4o32 luna_host_conv1d_i8i4o32
+#define luna_conv1d_i8i8o8 luna_host_conv1d_i8i8o8
+#define luna_conv1d_i8i8o32 luna_host_conv1d_i8i8o32
+#define luna_depthwise1d_i8i4o8 luna_host_depthwise1d_i8i4o8
+#define luna_depthwise1d_i8i4o32 luna_host_depthwise1d_i8i4o32
+#define luna_depthwise1d_i8i8o8 luna_host_depthwise1d_i8i8o8
+#define luna_depthwise1d_i8i8o32 luna_host_depthwise1d_i8i8o32
+#define luna_mat_mul_i8i8o8 luna_host_mat_mul_i8i8o8
+#define luna_mat_mul_i8i8o32 luna_host_mat_mul_i8i8o32
+#define luna_split_mat_mul_i8i8o8 luna_host_split_mat_mul_i8i8o8
+#define luna_split_mat_mul_i8i8o32 luna_host_split_mat_mul_i8i8o32
+#define luna_split_mat_mul_bias_i8i8i32o8 luna_host_split_mat_mul_bias_i8i8i32o8
+#define luna_split_mat_mul_bias_i8i8i32o32 luna_host_split_mat_mul_bias_i8i8i32o32
+#define luna_split_mat_mul_bias_i4i8i32o8 luna_host_split_mat_mul_bias_i4i8i32o8
+#define luna_split_mat_mul_bias_i4i8i32o32 luna_host_split_mat_mul_bias_i4i8i32o32
+#define luna_add_i8i8o8 luna_host_add_i8i8o8
+#define luna_add_i8i8o32 luna_host_add_i8i8o32
+#define luna_add_i32i32o8 luna_host_add_i32i32o8
+#define luna_add_i32i32o32 luna_host_add_i32i32o32
+#define luna_sub_i8i8o8 luna_host_sub_i8i8o8
+#define luna_sub_i8i8o32 luna_host_sub_i8i8o32
+#define luna_sub_i32i32o8 luna_host_sub_i32i32o8
+#define luna_sub_i32i32o32 luna_host_sub_i32i32o32
+#define luna_mul_i8i8o8 luna_host_mul_i8i8o8
+#define luna_mul_i8i8o32 luna_host_mul_i8i8o32
+#define luna_mul_i32i32o8 luna_host_mul_i32i32o8
+#define luna_mul_i32i32o32 luna_host_mul_i32i32o32
+#define luna_scale_i8i8o8 luna_host_scale_i8i8o8
+#define luna_scale_i8i8o32 luna_host_scale_i8i8o32
+#define luna_scale_i32i32o8 luna_host_scale_i32i32o8
+#define luna_scale_i32i32o32 luna_host_scale_i32i32o32
+#define luna_offset_i8i8o8 luna_host_offset_i8i8o8
+#define luna_offset_i8i8o32 luna_host_offset_i8i8o32
+#define luna_offset_i32i32o8 luna_host_offset_i32i32o8
+#define luna_offset_i32i32o32 luna_host_offset_i32i32o32
+#define luna_relu_i8o8 luna_host_relu_i8o8
+#define luna_relu_i8o32 luna_host_relu_i8o32
+#define luna_relu_i32o8 luna_host_relu_i32o8
+#define luna_relu_i32o32 luna_host_relu_i32o32
+#define luna_prelu_i8o8 luna_host_prelu_i8o8
+#define luna_prelu_i8o32 luna_host_prelu_i8o32
+#define luna_prelu_i32o8 luna_host_prelu_i32o8
+#define luna_prelu_i32o32 luna_host_prelu_i32o32
+#define luna_sigmoid_i32o32 luna_host_sigmoid_i32o32
+#define luna_sigmoid_i32o8 luna_host_sigmoid_i32o8
+#define luna_tanh_i32o32 luna_host_tanh_i32o32
+#define luna_tanh_i32o8 luna_host_tanh_i32o8
+#define luna_softmax_i32o32 luna_host_softmax_i32o32
+#endif
+
+#endif  // __LUNA_HOST_H__
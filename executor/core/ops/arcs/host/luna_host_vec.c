@@ -0,0 +1,519 @@
+#define LUNA_HOST_IMPL
+#include <string.h>
+#include "luna_host.h"
+#include "thinker_status.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+enum {
+    HOST_ADD = 0,
+    HOST_SUB,
+    HOST_MUL,
+};
+
+// Output shift as the simulator decodes it: bit 6 selects a floor shift of
+// the low 6 bits, other counts above 63 clear the value
+typedef struct _luna_host_shift_ {
+    int32_t shift_;
+    int32_t floor_;
+    int32_t zero_;
+} tLunaHostShift;
+
+// Sigmoid and tanh are 16 linear pieces over |x| in Q27, a piece is
+// y = (slope * x >> 27) + bias in Q31 with its own bias for negative x
+#define LUNA_HOST_BANDS 15
+
+static const int32_t g_sigmoid_band[LUNA_HOST_BANDS] = {
+    0x03CB50AB, 0x06A3C10B, 0x092B0E20, 0x0B9EC1E5, 0x0E1E460C, 0x10C395B2, 0x13A2C099, 0x16E5BB6B,
+    0x1AAF95B7, 0x1EB85DED, 0x231BAEF3, 0x28871149, 0x2D4A195A, 0x33701FD8, 0x398ADF55};
+static const int32_t g_sigmoid_slope[LUNA_HOST_BANDS + 1] = {
+    0x1F8F27FA, 0x1CC7E5CA, 0x1948F6DC, 0x158D0D5B, 0x11CC7BC8, 0x0E3033B8, 0x0AD7C439, 0x07DE3186,
+    0x05503C52, 0x0356CFB2, 0x02071A30, 0x0120D35D, 0x009055B6, 0x0050BE7D, 0x0021A2B5, 0x0002B5F6};
+static const int32_t g_sigmoid_bias[2 * (LUNA_HOST_BANDS + 1)] = {
+    0x40000000, 0x41515505, 0x443816D7, 0x487F9627, 0x4DF2D47C, 0x5451FC44, 0x5B54A57A, 0x62A1E75D,
+    0x69F1A50D, 0x70879B31, 0x7590BC8D, 0x79834F43, 0x7C5F4B08, 0x7DC74AA6, 0x7EF63004, 0x7FD49FA8,
+    0x40000000, 0x3EAEAAFB, 0x3BC7E929, 0x378069D9, 0x320D2B84, 0x2BAE03BC, 0x24AB5A86, 0x1D5E18A3,
+    0x160E5AF3, 0x0F7864CF, 0x0A6F4373, 0x067CB0BD, 0x03A0B4F8, 0x0238B55A, 0x0109CFFC, 0x002B6058};
+
+static const int32_t g_tanh_band[LUNA_HOST_BANDS] = {
+    0x0200743F, 0x0377CB26, 0x04CA374D, 0x06163CAC, 0x076B772B, 0x08D84ACE, 0x0A6DDC9F, 0x0C4A1C75,
+    0x0E962BE1, 0x10C8BDD8, 0x12996F30, 0x155A53CA, 0x1806C0DC, 0x1C196257, 0x1F9CD766};
+static const int32_t g_tanh_slope[LUNA_HOST_BANDS + 1] = {
+    0x7E0A969E, 0x71E22256, 0x631EE6ED, 0x533D3AA4, 0x4378A135, 0x34836940, 0x26E01DB4, 0x1AE2EF56,
+    0x10CBE6F7, 0x098534CA, 0x05E1EE37, 0x03938B0F, 0x01A5A470, 0x00D18964, 0x002B3693, 0x0002A25A};
+static const int32_t g_tanh_bias[2 * (LUNA_HOST_BANDS + 1)] = {
+    0x00000000, 0x030ACDBC, 0x097112F7, 0x12F35922, 0x1EF2A070, 0x2CD22003, 0x3BE6240C, 0x4B87423C,
+    0x5B0747BB, 0x684B9500, 0x6FED6A5D, 0x754A04AD, 0x7A704AA4, 0x7CED4ED6, 0x7F358073, 0x7FD5DA5F,
+    -0x00000000, -0x030ACDBC, -0x097112F7, -0x12F35922, -0x1EF2A070, -0x2CD22003, -0x3BE6240C, -0x4B87423C,
+    -0x5B0747BB, -0x684B9500, -0x6FED6A5D, -0x754A04AD, -0x7A704AA4, -0x7CED4ED6, -0x7F358073, -0x7FD5DA5F};
+
+// 2^f for f in [-1, 0) in Q23, Horner coefficients from the highest power
+static const int32_t g_exp2_poly[5] = {0x0000E014, 0x0006CED1, 0x001EA42B, 0x0058B52F, 0x007FFFDF};
+#define LUNA_HOST_LOG2E 0x2E2A8ECA      // log2(e) in Q29
+
+static inline tLunaHostShift hostShiftMode(uint32_t shift) {
+    tLunaHostShift m = {0, 0, 0};
+    int32_t s = (int32_t)shift;
+    if (s & 0x40) {
+        m.shift_ = s & 0x3F;
+        m.floor_ = 1;
+    } else if (s > 63) {
+        m.zero_ = 1;
+    } else if (s > 0) {
+        m.shift_ = s;
+    }
+    return m;
+}
+
+static inline int64_t hostRound(int64_t v, tLunaHostShift m) {
+    if (m.zero_) {
+        return 0;
+    }
+    if (m.shift_ == 0) {
+        return v;
+    }
+    if (m.floor_) {
+        return v >> m.shift_;
+    }
+    int64_t t = v >> (m.shift_ - 1);
+    return (t >> 1) + (t & 1);
+}
+
+static inline int8_t hostSat8(int64_t v) {
+    return (int8_t)((v > 127) ? 127 : ((v < -128) ? -128 : v));
+}
+
+static inline int32_t hostSat32(int64_t v) {
+    return (int32_t)((v > INT32_MAX) ? INT32_MAX : ((v < INT32_MIN) ? INT32_MIN : v));
+}
+
+static inline void hostPut(void *dst, int32_t bits, uint32_t index, int64_t v) {
+    if (bits == 8) {
+        ((int8_t *)dst)[index] = hostSat8(v);
+    } else {
+        ((int32_t *)dst)[index] = hostSat32(v);
+    }
+}
+
+static inline int64_t hostApply(int32_t op, int64_t a, int64_t b) {
+    return (op == HOST_ADD) ? a + b : ((op == HOST_SUB) ? a - b : a * b);
+}
+
+static inline int64_t hostPiece(int32_t x, const int32_t *band, const int32_t *slope, const int32_t *bias) {
+    uint32_t ax = (x < 0) ? 0u - (uint32_t)x : (uint32_t)x;
+    int32_t idx = 0;
+    while (idx < LUNA_HOST_BANDS && ax > (uint32_t)band[idx]) {
+        idx++;
+    }
+    return (((int64_t)slope[idx] * x) >> 27) + bias[idx + ((x < 0) ? LUNA_HOST_BANDS + 1 : 0)];
+}
+
+// Simulator 2^x of an int32 in Q25, the result is in Q23
+static inline int32_t hostExp(int32_t d) {
+    int64_t p = (int64_t)d * LUNA_HOST_LOG2E;
+    int32_t t = (int32_t)((p >> 31) + ((p >> 30) & 1));     // |t| < 2^30, never saturates
+    int32_t c = (t >> 23) + 1;
+    int64_t f = (int32_t)((uint32_t)t | 0xFF800000u);
+    int32_t r = g_exp2_poly[0];
+    for (int32_t k = 1; k < 5; k++) {
+        int64_t v = (int64_t)r * f;
+        r = (int32_t)((uint32_t)((v >> 23) + ((v >> 22) & 1)) + (uint32_t)g_exp2_poly[k]);
+    }
+    if ((uint32_t)(c + 62) > 124) {
+        return 0;
+    }
+    return (c > 0) ? (int32_t)(uint32_t)((uint64_t)(int64_t)r << c) : (int32_t)((int64_t)r >> -c);
+}
+
+#if defined(__AVX2__)
+static inline __m256i hostSra64(__m256i v, int32_t n) {
+    __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v);
+    return _mm256_or_si256(_mm256_srl_epi64(v, _mm_cvtsi32_si128(n)),
+                           _mm256_sll_epi64(sign, _mm_cvtsi32_si128(64 - n)));
+}
+
+static inline __m256i hostRound8x32(__m256i v, tLunaHostShift m) {
+    if (m.zero_) {
+        return _mm256_setzero_si256();
+    }
+    if (m.shift_ == 0) {
+        return v;
+    }
+    if (m.floor_) {
+        return _mm256_sra_epi32(v, _mm_cvtsi32_si128(m.shift_));
+    }
+    __m256i t = _mm256_sra_epi32(v, _mm_cvtsi32_si128(m.shift_ - 1));
+    return _mm256_add_epi32(_mm256_srai_epi32(t, 1), _mm256_and_si256(t, _mm256_set1_epi32(1)));
+}
+
+static inline __m256i hostRound4x64(__m256i v, tLunaHostShift m) {
+    if (m.zero_) {
+        return _mm256_setzero_si256();
+    }
+    if (m.shift_ == 0) {
+        return v;
+    }
+    if (m.floor_) {
+        return hostSra64(v, m.shift_);
+    }
+    __m256i t = hostSra64(v, m.shift_ - 1);
+    return _mm256_add_epi64(hostSra64(t, 1), _mm256_and_si256(t, _mm256_set1_epi64x(1)));
+}
+
+static inline __m256i hostClamp64(__m256i v, int64_t lo, int64_t hi) {
+    __m256i l = _mm256_set1_epi64x(lo), h = _mm256_set1_epi64x(hi);
+    v = _mm256_blendv_epi8(v, h, _mm256_cmpgt_epi64(v, h));
+    return _mm256_blendv_epi8(v, l, _mm256_cmpgt_epi64(l, v));
+}
+
+// Low halves of four int64 lanes
+static inline __m128i hostLow32(__m256i v) {
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+}
+
+static inline void hostStore8x32(void *dst, int32_t bits, uint32_t index, __m256i v) {
+    if (bits == 8) {
+        __m128i p = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        _mm_storel_epi64((__m128i *)((int8_t *)dst + index), _mm_packs_epi16(p, p));
+    } else {
+        _mm256_storeu_si256((__m256i *)((int32_t *)dst + index), v);
+    }
+}
+
+// Four int64 lanes saturated to the output width
+static inline void hostStore4x64(void *dst, int32_t bits, uint32_t index, __m256i v) {
+    if (bits == 8) {
+        __m128i p = _mm_packs_epi32(hostLow32(hostClamp64(v, -128, 127)), _mm_setzero_si128());
+        int32_t w = _mm_cvtsi128_si32(_mm_packs_epi16(p, p));
+        memcpy((int8_t *)dst + index, &w, 4);
+    } else {
+        _mm_storeu_si128((__m128i *)((int32_t *)dst + index), hostLow32(hostClamp64(v, INT32_MIN, INT32_MAX)));
+    }
+}
+
+static inline __m256i hostExp4(__m128i d) {
+    const __m256i one = _mm256_set1_epi64x(1);
+    __m256i p = _mm256_mul_epi32(_mm256_cvtepi32_epi64(d), _mm256_set1_epi64x(LUNA_HOST_LOG2E));
+    __m256i t = _mm256_add_epi64(hostSra64(p, 31), _mm256_and_si256(_mm256_srli_epi64(p, 30), one));
+    __m256i c = _mm256_add_epi64(hostSra64(t, 23), one);
+    __m256i f = _mm256_or_si256(t, _mm256_set1_epi64x((int64_t)0xFFFFFFFFFF800000LL));
+    __m256i r = _mm256_set1_epi64x(g_exp2_poly[0]);
+    for (int32_t k = 1; k < 5; k++) {
+        // only the low 32 bits of r are kept, mul_epi32 reads no more
+        __m256i v = _mm256_mul_epi32(r, f);
+        v = _mm256_add_epi64(hostSra64(v, 23), _mm256_and_si256(_mm256_srli_epi64(v, 22), one));
+        r = _mm256_add_epi64(v, _mm256_set1_epi64x(g_exp2_poly[k]));
+    }
+    r = hostSra64(_mm256_slli_epi64(r, 32), 32);
+    __m256i nc = _mm256_sub_epi64(_mm256_setzero_si256(), c);
+    __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), r);
+    __m256i right = _mm256_or_si256(_mm256_srlv_epi64(r, nc), _mm256_sllv_epi64(sign, _mm256_sub_epi64(_mm256_set1_epi64x(64), nc)));
+    __m256i v = _mm256_blendv_epi8(right, _mm256_sllv_epi64(r, c), _mm256_cmpgt_epi64(c, _mm256_setzero_si256()));
+    __m256i valid = _mm256_and_si256(_mm256_cmpgt_epi64(c, _mm256_set1_epi64x(-63)),
+                                     _mm256_cmpgt_epi64(_mm256_set1_epi64x(63), c));
+    return _mm256_and_si256(v, valid);
+}
+#endif
+
+/**
+ * @brief Element-wise op on int8 vectors, the result fits in 32 bits
+ * @param a First operand
+ * @param b Second operand, NULL to use scalar
+ * @param scalar Second operand when b is NULL
+ * @param op HOST_ADD, HOST_SUB or HOST_MUL
+ * @param dst Output, int8 or int32 by bits
+ * @param bits Output width
+ * @param size Number of elements
+ * @param shift Output shift
+ * @return int32_t Execution status
+ */
+static int32_t hostVec8(const int8_t *a, const int8_t *b, int32_t scalar, int32_t op, void *dst, int32_t bits,
+                        uint32_t size, uint32_t shift) {
+    tLunaHostShift m = hostShiftMode(shift);
+    uint32_t i = 0;
+#if defined(__AVX2__)
+    const __m256i vs = _mm256_set1_epi32(scalar);
+    for (; i + 8 <= size; i += 8) {
+        __m256i va = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(a + i)));
+        __m256i vb = b ? _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(b + i))) : vs;
+        __m256i v = (op == HOST_ADD) ? _mm256_add_epi32(va, vb)
+                  : ((op == HOST_SUB) ? _mm256_sub_epi32(va, vb) : _mm256_mullo_epi32(va, vb));
+        hostStore8x32(dst, bits, i, hostRound8x32(v, m));
+    }
+#endif
+    for (; i < size; i++) {
+        hostPut(dst, bits, i, hostRound(hostApply(op, a[i], b ? b[i] : scalar), m));
+    }
+    return T_SUCCESS;
+}
+
+/**
+ * @brief Element-wise op on int32 vectors, computed in 64 bits like the simulator
+ * @param a First operand
+ * @param b Second operand, NULL to use scalar
+ * @param scalar Second operand when b is NULL
+ * @param op HOST_ADD, HOST_SUB or HOST_MUL
+ * @param dst Output, int8 or int32 by bits
+ * @param bits Output width
+ * @param size Number of elements
+ * @param shift Output shift
+ * @return int32_t Execution status
+ */
+static int32_t hostVec32(const int32_t *a, const int32_t *b, int32_t scalar, int32_t op, void *dst, int32_t bits,
+                         uint32_t size, uint32_t shift) {
+    tLunaHostShift m = hostShiftMode(shift);
+    uint32_t i = 0;
+#if defined(__AVX2__)
+    const __m256i vs = _mm256_set1_epi64x(scalar);
+    for (; i + 4 <= size; i += 4) {
+        __m256i va = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(a + i)));
+        __m256i vb = b ? _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(b + i))) : vs;
+        __m256i v = (op == HOST_ADD) ? _mm256_add_epi64(va, vb)
+                  : ((op == HOST_SUB) ? _mm256_sub_epi64(va, vb) : _mm256_mul_epi32(va, vb));
+        hostStore4x64(dst, bits, i, hostRound4x64(v, m));
+    }
+#endif
+    for (; i < size; i++) {
+        hostPut(dst, bits, i, hostRound(hostApply(op, a[i], b ? b[i] : scalar), m));
+    }
+    return T_SUCCESS;
+}
+
+/**
+ * @brief ReLU or PReLU, negative inputs of PReLU use the shift plus slope
+ * @param src Input, int8 or int32 by in_bits
+ * @param in_bits Input width
+ * @param dst Output, int8 or int32 by bits
+ * @param bits Output width
+ * @param size Number of elements
+ * @param shift Output shift
+ * @param slope Extra shift of negative inputs
+ * @param prelu PReLU instead of ReLU
+ * @return int32_t Execution status
+ */
+static int32_t hostActivation(const void *src, int32_t in_bits, void *dst, int32_t bits, uint32_t size,
+                              uint32_t shift, uint32_t slope, int32_t prelu) {
+    tLunaHostShift m = hostShiftMode(shift);
+    tLunaHostShift neg = hostShiftMode(shift + slope);
+    uint32_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= size; i += 8) {
+        __m256i x = (in_bits == 8) ? _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)((const int8_t *)src + i)))
+                                   : _mm256_loadu_si256((const __m256i *)((const int32_t *)src + i));
+        __m256i v = hostRound8x32(x, m);
+        if (prelu) {
+            v = _mm256_blendv_epi8(v, hostRound8x32(x, neg), _mm256_cmpgt_epi32(_mm256_setzero_si256(), x));
+        } else {
+            v = _mm256_max_epi32(v, _mm256_setzero_si256());
+        }
+        hostStore8x32(dst, bits, i, v);
+    }
+#endif
+    for (; i < size; i++) {
+        int32_t x = (in_bits == 8) ? ((const int8_t *)src)[i] : ((const int32_t *)src)[i];
+        int64_t v = (prelu && x < 0) ? hostRound(x, neg) : hostRound(x, m);
+        hostPut(dst, bits, i, (!prelu && v < 0) ? 0 : v);
+    }
+    return T_SUCCESS;
+}
+
+/**
+ * @brief Piecewise linear sigmoid or tanh of Q27 inputs, Q31 or Q7 output
+ * @param src Input
+ * @param dst Output, int8 or int32 by bits
+ * @param bits Output width
+ * @param size Number of elements
+ * @param band Upper bounds of |x| for the first 15 pieces
+ * @param slope Slope of each piece
+ * @param bias Bias of each piece, then the biases for negative inputs
+ * @return int32_t Execution status
+ */
+static int32_t hostPiecewise(const int32_t *src, void *dst, int32_t bits, uint32_t size, const int32_t *band,
+                             const int32_t *slope, const int32_t *bias) {
+    tLunaHostShift q7 = hostShiftMode(24);
+    uint32_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= size; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+        // |INT32_MIN| is past the last band either way
+        __m256i ax = _mm256_min_epu32(_mm256_abs_epi32(x), _mm256_set1_epi32(INT32_MAX));
+        __m256i idx = _mm256_setzero_si256();
+        for (int32_t k = 0; k < LUNA_HOST_BANDS; k++) {
+            idx = _mm256_sub_epi32(idx, _mm256_cmpgt_epi32(ax, _mm256_set1_epi32(band[k])));
+        }
+        __m256i sl = _mm256_i32gather_epi32(slope, idx, 4);
+        __m256i bs = _mm256_i32gather_epi32(bias, _mm256_add_epi32(idx, _mm256_slli_epi32(_mm256_srli_epi32(x, 31), 4)), 4);
+        for (int32_t h = 0; h < 2; h++) {
+            __m128i xh = h ? _mm256_extracti128_si256(x, 1) : _mm256_castsi256_si128(x);
+            __m128i sh = h ? _mm256_extracti128_si256(sl, 1) : _mm256_castsi256_si128(sl);
+            __m128i bh = h ? _mm256_extracti128_si256(bs, 1) : _mm256_castsi256_si128(bs);
+            __m256i y = _mm256_mul_epi32(_mm256_cvtepi32_epi64(xh), _mm256_cvtepi32_epi64(sh));
+            y = _mm256_add_epi64(hostSra64(y, 27), _mm256_cvtepi32_epi64(bh));
+            hostStore4x64(dst, bits, i + 4 * h, (bits == 8) ? hostRound4x64(y, q7) : y);
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        int64_t y = hostPiece(src[i], band, slope, bias);
+        hostPut(dst, bits, i, (bits == 8) ? hostRound(y, q7) : y);
+    }
+    return T_SUCCESS;
+}
+
+#define LUNA_HOST_BINARY(name, in_type, out_type, kernel, op, bits)                                        \
+    int32_t luna_host_##name(const in_type *src1, const in_type *src2, out_type *dst, uint32_t size,       \
+                             uint32_t shift) {                                                              \
+        return kernel(src1, src2, 0, op, dst, bits, size, shift);                                          \
+    }
+
+#define LUNA_HOST_SCALAR(name, in_type, out_type, kernel, op, bits)                                        \
+    int32_t luna_host_##name(const in_type *src1, const in_type scalar, out_type *dst, uint32_t size,      \
+                             uint32_t shift) {                                                              \
+        return kernel(src1, NULL, scalar, op, dst, bits, size, shift);                                     \
+    }
+
+LUNA_HOST_BINARY(add_i8i8o8, int8_t, int8_t, hostVec8, HOST_ADD, 8)
+LUNA_HOST_BINARY(add_i8i8o32, int8_t, int32_t, hostVec8, HOST_ADD, 32)
+LUNA_HOST_BINARY(add_i32i32o8, int32_t, int8_t, hostVec32, HOST_ADD, 8)
+LUNA_HOST_BINARY(add_i32i32o32, int32_t, int32_t, hostVec32, HOST_ADD, 32)
+LUNA_HOST_BINARY(sub_i8i8o8, int8_t, int8_t, hostVec8, HOST_SUB, 8)
+LUNA_HOST_BINARY(sub_i8i8o32, int8_t, int32_t, hostVec8, HOST_SUB, 32)
+LUNA_HOST_BINARY(sub_i32i32o8, int32_t, int8_t, hostVec32, HOST_SUB, 8)
+LUNA_HOST_BINARY(sub_i32i32o32, int32_t, int32_t, hostVec32, HOST_SUB, 32)
+LUNA_HOST_BINARY(mul_i8i8o8, int8_t, int8_t, hostVec8, HOST_MUL, 8)
+LUNA_HOST_BINARY(mul_i8i8o32, int8_t, int32_t, hostVec8, HOST_MUL, 32)
+LUNA_HOST_BINARY(mul_i32i32o8, int32_t, int8_t, hostVec32, HOST_MUL, 8)
+LUNA_HOST_BINARY(mul_i32i32o32, int32_t, int32_t, hostVec32, HOST_MUL, 32)
+LUNA_HOST_SCALAR(scale_i8i8o8, int8_t, int8_t, hostVec8, HOST_MUL, 8)
+LUNA_HOST_SCALAR(scale_i8i8o32, int8_t, int32_t, hostVec8, HOST_MUL, 32)
+LUNA_HOST_SCALAR(scale_i32i32o8, int32_t, int8_t, hostVec32, HOST_MUL, 8)
+LUNA_HOST_SCALAR(scale_i32i32o32, int32_t, int32_t, hostVec32, HOST_MUL, 32)
+LUNA_HOST_SCALAR(offset_i8i8o8, int8_t, int8_t, hostVec8, HOST_ADD, 8)
+LUNA_HOST_SCALAR(offset_i8i8o32, int8_t, int32_t, hostVec8, HOST_ADD, 32)
+LUNA_HOST_SCALAR(offset_i32i32o8, int32_t, int8_t, hostVec32, HOST_ADD, 8)
+LUNA_HOST_SCALAR(offset_i32i32o32, int32_t, int32_t, hostVec32, HOST_ADD, 32)
+
+int32_t luna_host_relu_i8o8(const int8_t *src, int8_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 8, dst, 8, size, shift, 0, 0);
+}
+
+int32_t luna_host_relu_i8o32(const int8_t *src, int32_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 8, dst, 32, size, shift, 0, 0);
+}
+
+int32_t luna_host_relu_i32o8(const int32_t *src, int8_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 32, dst, 8, size, shift, 0, 0);
+}
+
+int32_t luna_host_relu_i32o32(const int32_t *src, int32_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 32, dst, 32, size, shift, 0, 0);
+}
+
+int32_t luna_host_prelu_i8o8(const int8_t *src, uint32_t slope, int8_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 8, dst, 8, size, shift, slope, 1);
+}
+
+int32_t luna_host_prelu_i8o32(const int8_t *src, uint32_t slope, int32_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 8, dst, 32, size, shift, slope, 1);
+}
+
+int32_t luna_host_prelu_i32o8(const int32_t *src, uint32_t slope, int8_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 32, dst, 8, size, shift, slope, 1);
+}
+
+int32_t luna_host_prelu_i32o32(const int32_t *src, uint32_t slope, int32_t *dst, uint32_t size, uint32_t shift) {
+    return hostActivation(src, 32, dst, 32, size, shift, slope, 1);
+}
+
+int32_t luna_host_sigmoid_i32o32(const int32_t *src, int32_t *dst, uint32_t size) {
+    return hostPiecewise(src, dst, 32, size, g_sigmoid_band, g_sigmoid_slope, g_sigmoid_bias);
+}
+
+int32_t luna_host_sigmoid_i32o8(const int32_t *src, int8_t *dst, uint32_t size) {
+    return hostPiecewise(src, dst, 8, size, g_sigmoid_band, g_sigmoid_slope, g_sigmoid_bias);
+}
+
+int32_t luna_host_tanh_i32o32(const int32_t *src, int32_t *dst, uint32_t size) {
+    return hostPiecewise(src, dst, 32, size, g_tanh_band, g_tanh_slope, g_tanh_bias);
+}
+
+int32_t luna_host_tanh_i32o8(const int32_t *src, int8_t *dst, uint32_t size) {
+    return hostPiecewise(src, dst, 8, size, g_tanh_band, g_tanh_slope, g_tanh_bias);
+}
+
+int32_t luna_host_softmax_i32o32(const int32_t *src, int32_t *dst, uint32_t size) {
+    int32_t max = INT32_MIN;
+    int64_t sum = 0;
+    uint32_t i = 0;
+#if defined(__AVX2__)
+    __m256i vmax = _mm256_set1_epi32(INT32_MIN);
+    for (; i + 8 <= size; i += 8) {
+        vmax = _mm256_max_epi32(vmax, _mm256_loadu_si256((const __m256i *)(src + i)));
+    }
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, vmax);
+    for (int32_t k = 0; k < 8; k++) {
+        max = (lanes[k] > max) ? lanes[k] : max;
+    }
+#endif
+    for (; i < size; i++) {
+        max = (src[i] > max) ? src[i] : max;
+    }
+
+    // exp(x - max), x - max saturated to int32
+    i = 0;
+#if defined(__AVX2__)
+    __m256i vsum = _mm256_setzero_si256();
+    vmax = _mm256_set1_epi32(max);
+    for (; i + 8 <= size; i += 8) {
+        __m256i d = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(src + i)), vmax);
+        d = _mm256_blendv_epi8(d, _mm256_set1_epi32(INT32_MIN), _mm256_cmpgt_epi32(d, _mm256_setzero_si256()));
+        __m256i lo = hostExp4(_mm256_castsi256_si128(d));
+        __m256i hi = hostExp4(_mm256_extracti128_si256(d, 1));
+        _mm_storeu_si128((__m128i *)(dst + i), hostLow32(lo));
+        _mm_storeu_si128((__m128i *)(dst + i + 4), hostLow32(hi));
+        vsum = _mm256_add_epi64(vsum, _mm256_cvtepi32_epi64(hostLow32(lo)));
+        vsum = _mm256_add_epi64(vsum, _mm256_cvtepi32_epi64(hostLow32(hi)));
+    }
+    int64_t part[4];
+    _mm256_storeu_si256((__m256i *)part, vsum);
+    sum = part[0] + part[1] + part[2] + part[3];
+#endif
+    for (; i < size; i++) {
+        dst[i] = hostExp(hostSat32((int64_t)src[i] - max));
+        sum += dst[i];
+    }
+
+    // Q23 reciprocal of the sum by restoring division, kept doubled
+    uint32_t den = (uint32_t)hostSat32(sum);
+    uint32_t rem = 0x800000;
+    uint32_t recip = 0;
+    for (int32_t k = 0; k < 30; k++) {
+        if (den <= rem) {
+            rem -= den;
+            recip = 2 * recip + 2;
+        } else {
+            recip = 2 * recip;
+        }
+        rem <<= 1;
+    }
+
+    tLunaHostShift m = hostShiftMode(38);
+    i = 0;
+#if defined(__AVX2__)
+    const __m256i vr = _mm256_set1_epi64x(recip);
+    for (; i + 4 <= size; i += 4) {
+        __m256i e = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(dst + i)));
+        // signed e times unsigned recip
+        __m256i p = _mm256_sub_epi64(_mm256_mul_epu32(e, vr),
+                                     _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), e), _mm256_slli_epi64(vr, 32)));
+        _mm_storeu_si128((__m128i *)(dst + i), hostLow32(hostRound4x64(p, m)));
+    }
+#endif
+    for (; i < size; i++) {
+        dst[i] = (int32_t)hostRound((int64_t)dst[i] * recip, m);
+    }
+    return T_SUCCESS;
+}
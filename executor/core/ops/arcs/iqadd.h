@@ -10,6 +10,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -67,7 +70,7 @@ int32_t iqadd_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y) {
 
                         int8_t *src2_temp = (int8_t *)src2 + past_size;
                         ret |= API_LIB(add_i8i8o8)((int8_t *)src1_temp, (int8_t *)src2_temp, (int8_t *)dst_temp, cur_size, 0);
-                        opi_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int8_t));
+                        thinker_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int8_t));
                         past_size += cur_size;
                     }
                 }
@@ -89,7 +92,7 @@ int32_t iqadd_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y) {
                         int8_t *src2_temp = dst_temp;
                         ret = API_LIB(scale_i8i8o8)((int8_t *)src2 + past_size, 1, (int8_t *)src2_temp, cur_size, shift1);
                         ret |= API_LIB(add_i8i8o8)((int8_t *)src1_temp, (int8_t *)src2_temp, (int8_t *)dst_temp, cur_size, 0);
-                        opi_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int8_t));
+                        thinker_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int8_t));
                         past_size += cur_size;
                     }
                 }
@@ -108,7 +111,7 @@ int32_t iqadd_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y) {
                     ret |= API_LIB(scale_i8i8o8)((int8_t *)src2 + past_size, 1, (int8_t *)src2_temp, cur_size, shift2);
                     ret |= API_LIB(add_i8i8o8)((int8_t *)src1_temp, (int8_t *)src2_temp, (int8_t *)dst_temp, cur_size, 0);
                     if (y_in_psram)
-                        opi_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int8_t));
+                        thinker_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int8_t));
                     past_size += cur_size;
                 }
             }
@@ -141,7 +144,7 @@ int32_t iqadd_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y) {
 
                         int32_t *src2_temp = (int32_t *)src2 + past_size;
                         ret |= API_LIB(add_i32i32o32)((int32_t *)src1_temp, (int32_t *)src2_temp, (int32_t *)dst_temp, cur_size, 0);
-                        opi_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int32_t));
+                        thinker_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int32_t));
                         past_size += cur_size;
                     }
                 }
@@ -163,7 +166,7 @@ int32_t iqadd_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y) {
                         int32_t *src2_temp = dst_temp;
                         ret = API_LIB(scale_i32i32o32)((int32_t *)src2 + past_size, 1, (int32_t *)src2_temp, cur_size, shift1);
                         ret |= API_LIB(add_i32i32o32)((int32_t *)src1_temp, (int32_t *)src2_temp, (int32_t *)dst_temp, cur_size, 0);
-                        opi_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int32_t));
+                        thinker_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int32_t));
                         past_size += cur_size;
                     }
                 }
@@ -182,7 +185,7 @@ int32_t iqadd_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y) {
                     ret |= API_LIB(scale_i32i32o32)((int32_t *)src2 + past_size, 1, (int32_t *)src2_temp, cur_size, shift2);
                     ret |= API_LIB(add_i32i32o32)((int32_t *)src1_temp, (int32_t *)src2_temp, (int32_t *)dst_temp, cur_size, 0);
                     if (y_in_psram)
-                        opi_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int32_t));
+                        thinker_psram_cpy_out((void *)dst + past_size, dst_temp, cur_size * sizeof(int32_t));
                     past_size += cur_size;
                 }
             }
@@ -103,7 +103,7 @@ int32_t iqpad_luna(tTensor *X, tTensor *P, tTensor *data, tTensor *workspace, tT
                 memset(dst, fill_data, out_size);
                 for (int32_t i = 0; i < h_in; ++i) {
                     for (int32_t j = 0; j < w_in; ++j) {
-                        opi_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
+                        thinker_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
                                          temp + (i * w_in + j) * c_in, c_in);
                     }
                 }
@@ -142,13 +142,13 @@ int32_t iqpad_luna(tTensor *X, tTensor *P, tTensor *data, tTensor *workspace, tT
             } else {
                 for (int32_t i = 0; i < h_in; ++i) {
                     for (int32_t j = 0; j < w_in; ++j) {
-                        opi_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
+                        thinker_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
                                          temp + (i * w_in + j) * c_in, c_in);
                     }
                 }
                 if (pads_h_up != 0) {
                     for (int32_t i = 0; i < pads_h_up; ++i) {
-                        opi_psram_cpy_out(dst + (i * w_out + pads_w_left) * c_in, temp, w_in * c_in);
+                        thinker_psram_cpy_out(dst + (i * w_out + pads_w_left) * c_in, temp, w_in * c_in);
                     }
                 }
                 if (pads_w_left != 0) {
@@ -162,7 +162,7 @@ int32_t iqpad_luna(tTensor *X, tTensor *P, tTensor *data, tTensor *workspace, tT
                 }
                 if (pads_h_down != 0) {
                     for (int32_t i = h_in + pads_h_up; i < h_out; ++i) {
-                        opi_psram_cpy_out(dst + i * w_out * c_in, 
+                        thinker_psram_cpy_out(dst + i * w_out * c_in, 
                                          dst + (h_in + pads_h_up - 1) * w_out * c_in, 
                                          (w_in + pads_w_left) * c_in);
                     }
@@ -212,13 +212,13 @@ int32_t iqpad_luna(tTensor *X, tTensor *P, tTensor *data, tTensor *workspace, tT
             } else {
                 for (int32_t i = 0; i < h_in; ++i) {
                     for (int32_t j = 0; j < w_in; ++j) {
-                        opi_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
+                        thinker_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
                                          temp + (i * w_in + j) * c_in, c_in);
                     }
                 }
                 if (pads_h_up != 0) {
                     for (int32_t i = 0; i < pads_h_up; ++i) {
-                        opi_psram_cpy_out(dst + (i * w_out + pads_w_left) * c_in, 
+                        thinker_psram_cpy_out(dst + (i * w_out + pads_w_left) * c_in, 
                                          temp + (pads_h_up - i) * w_in * c_in, w_in * c_in);
                     }
                 }
@@ -233,7 +233,7 @@ int32_t iqpad_luna(tTensor *X, tTensor *P, tTensor *data, tTensor *workspace, tT
                 }
                 if (pads_h_down != 0) {
                     for (int32_t i = h_in + pads_h_up; i < h_out; ++i) {
-                        opi_psram_cpy_out(dst + i * w_out * c_in, 
+                        thinker_psram_cpy_out(dst + i * w_out * c_in, 
                                          dst + (2 * (h_in + pads_h_up) - i - 2) * w_out * c_in, 
                                          (w_in + pads_w_left) * c_in);
                     }
@@ -254,7 +254,7 @@ int32_t iqpad_luna(tTensor *X, tTensor *P, tTensor *data, tTensor *workspace, tT
             memset(dst, fill_data, out_size);
             for (int32_t i = 0; i < h_in; ++i) {
                 for (int32_t j = 0; j < w_in; ++j) {
-                    opi_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
+                    thinker_psram_cpy_out(dst + ((i + pads_h_up) * w_out + j + pads_w_left) * c_in, 
                                      temp + (i * w_in + j) * c_in, c_in);
                 }
             }
@@ -11,6 +11,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -74,7 +77,7 @@ int32_t iqsub_luna(tTensor *X1, tTensor *X2, tTensor *Temp, tTensor *Y)
                 ret = API_LIB(sub_i8i8o8)((const int8_t *)dst, (int8_t *)src2, (int8_t *)dst, size, 0);
 
                 if (y_psram) {
-                    opi_psram_cpy_out((void *)Y->dptr_, dst, size * sizeof(int8_t));
+                    thinker_psram_cpy_out((void *)Y->dptr_, dst, size * sizeof(int8_t));
                 }
             } break;
             default:
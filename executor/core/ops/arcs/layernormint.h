@@ -10,6 +10,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -272,7 +275,7 @@ int32_t layernormalint_venus(const tTensor *X, const tTensor *W, const tTensor *
         
         // Copy result back if necessary
         if (Y->mem_.mem_type_ != 2) {
-            opi_psram_cpy_out(p_dst + i * T, p_dst_once, T * sizeof(int8_t));
+            thinker_psram_cpy_out(p_dst + i * T, p_dst_once, T * sizeof(int8_t));
         }
     }
 
@@ -14,6 +14,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -322,7 +325,7 @@ int32_t logsoftmaxint_luna(tTensor *data, tTensor *out, tTensor *Workspace, LogS
                 
                 // Copy result back if needed
                 if (output_is_psram) {
-                    opi_psram_cpy_out(ldst_tmp, tmp1, max_once_size);
+                    thinker_psram_cpy_out(ldst_tmp, tmp1, max_once_size);
                 }
                 
                 lsrc_tmp += max_once_size;
@@ -346,7 +349,7 @@ int32_t logsoftmaxint_luna(tTensor *data, tTensor *out, tTensor *Workspace, LogS
             ret |= API_LIB(scale_i32i32o8)(tmp2, 1, ldst, i_src_size, (LOG_Q_OUT - y_scale));
             
             if (output_is_psram) {
-                opi_psram_cpy_out(ldst_tmp, tmp1, i_src_size);
+                thinker_psram_cpy_out(ldst_tmp, tmp1, i_src_size);
             }
         }
     } 
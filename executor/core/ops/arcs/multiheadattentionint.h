@@ -14,6 +14,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -422,9 +425,9 @@ int32_t multiheadattention_luna(tTensor *X, tTensor *W_q, tTensor *Bias_q, tTens
 
     // Copy relative position embeddings to temp buffer
     int8_t* p_weight_emb_k = p_temp; p_temp += (2 * max_rel + 1) * head_dim;
-    opi_psram_cpy_out(p_weight_emb_k, p_weight_pos_qk, (2 * max_rel + 1) * head_dim);
+    thinker_psram_cpy_out(p_weight_emb_k, p_weight_pos_qk, (2 * max_rel + 1) * head_dim);
     int8_t* p_weight_emb_v = p_temp; p_temp += (2 * max_rel + 1) * head_dim;
-    opi_psram_cpy_out(p_weight_emb_v, p_weight_pos_qkv, (2 * max_rel + 1) * head_dim);
+    thinker_psram_cpy_out(p_weight_emb_v, p_weight_pos_qkv, (2 * max_rel + 1) * head_dim);
 
     // Extract additional scales
     int32_t q_x_bmm2 = emb_pos_qk->scale_;
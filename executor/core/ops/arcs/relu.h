@@ -10,6 +10,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -52,7 +55,7 @@ tStatus relu_luna(tTensor *X, tTensor *Y, tTensor *Workspace)
 
         ret = API_LIB(relu_i8o8)(src, dst, size, shift);
         if (2 != Y->mem_.type_) {
-            opi_psram_cpy_out((int8_t *)Y->dptr_, dst, size);
+            thinker_psram_cpy_out((int8_t *)Y->dptr_, dst, size);
         }
     }
     // Handle Int8 -> Int32 case
@@ -76,7 +79,7 @@ tStatus relu_luna(tTensor *X, tTensor *Y, tTensor *Workspace)
         ret = API_LIB(relu_i8o32)(src, dst, size, shift);
 
         if (2 != Y->mem_.type_) {
-            opi_psram_cpy_out((int8_t *)Y->dptr_, dst, size * 4);
+            thinker_psram_cpy_out((int8_t *)Y->dptr_, dst, size * 4);
         }
     }
     // Handle Int32 -> Int8 case
@@ -95,7 +98,7 @@ tStatus relu_luna(tTensor *X, tTensor *Y, tTensor *Workspace)
         ret = API_LIB(relu_i32o8)(src, dst, size, shift);
 
         if (2 != Y->mem_.type_) {
-            opi_psram_cpy_out((int8_t *)Y->dptr_, dst, size);
+            thinker_psram_cpy_out((int8_t *)Y->dptr_, dst, size);
         }
     }
     // Handle Int32 -> Int32 case
@@ -114,7 +117,7 @@ tStatus relu_luna(tTensor *X, tTensor *Y, tTensor *Workspace)
         ret = API_LIB(relu_i32o32)(src, dst, size, shift);
 
         if (2 != Y->mem_.type_) {
-            opi_psram_cpy_out((int8_t *)Y->dptr_, dst, size * 4);
+            thinker_psram_cpy_out((int8_t *)Y->dptr_, dst, size * 4);
         }
     }
     else {
@@ -13,6 +13,9 @@
 #define API_LIB(api) nnblas_##api
 #else
 #include "luna/luna_math.h"
+#if THINKER_LUNA_HOST
+#include "host/luna_host.h"
+#endif
 #define API_LIB(api) luna_##api
 #endif
 
@@ -43,12 +46,14 @@ int32_t requant_luna(tTensor* X, tTensor* Y)
     {
         if (32 == dst_bits) {
             int32_t* output = (int32_t*)Y->dptr_;
+            THINKER_OMP_PARALLEL_FOR(size)
             for (int32_t i = 0; i < size; ++i) {
                 output[i] = input[i] << (q_y - q_x);
             }
         } 
         else if (16 == dst_bits) {
             int16_t* output = (int16_t*)Y->dptr_;
+            THINKER_OMP_PARALLEL_FOR(size)
             for (int32_t i = 0; i < size; ++i) {
                 output[i] = input[i] << (q_y - q_x);
             }
@@ -33,7 +33,7 @@ int32_t reshape_luna(tTensor *X, tTensor *Y) {
         if (size != 0) {
             if (Y->mem_.type_ != 2) {
                 // Output is in PSRAM - use PSRAM copy out
-                opi_psram_cpy_out(output, input, size);
+                thinker_psram_cpy_out(output, input, size);
                 return T_SUCCESS;
             }
             else if (X->mem_.type_ != 2) {
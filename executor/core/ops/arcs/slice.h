@@ -55,7 +55,7 @@ tStatus slice_luna(tTensor* X, int32_t begin, int32_t end, int32_t axis, int32_t
             return ret;
         }
         else {
-            opi_psram_cpy_out((int8_t*)Y->dptr_, (int8_t*)X->dptr_ + start * X->byte_, output_size * Y->byte_);
+            thinker_psram_cpy_out((int8_t*)Y->dptr_, (int8_t*)X->dptr_ + start * X->byte_, output_size * Y->byte_);
             return T_SUCCESS;
         }
     }
@@ -31,11 +31,12 @@ int32_t split_venus(tTensor *X, tTensor **tensors, SliceAttrs *attrs)
 {
     int32_t ret = T_ERR_NO_IMPLEMENTED;
     
+    int32_t axis = attrs->axis;  // attrs are shared by executors and may be mapped read-only
     // Handle negative axis values
-    if (attrs->axis < 0) {
-        attrs->axis += X->shape_.ndim_;
+    if (axis < 0) {
+        axis += X->shape_.ndim_;
     }
-    if (attrs->axis >= X->shape_.ndim_) {
+    if (axis >= X->shape_.ndim_) {
         return T_ERR_INVALID_PARA;
     }
 
@@ -44,7 +45,7 @@ int32_t split_venus(tTensor *X, tTensor **tensors, SliceAttrs *attrs)
     int32_t index = 0;
     
     // Compute leading dimensions
-    for (; index < attrs->axis; ++index) {
+    for (; index < axis; ++index) {
         leading *= X->shape_.dims_[index];
     }
     
@@ -76,7 +77,7 @@ int32_t split_venus(tTensor *X, tTensor **tensors, SliceAttrs *attrs)
             for (int32_t i = 0; i < leading; ++i) {
                 int8_t *idst = (int8_t *)(out->dptr_) + i * attrs->split[n] * stride * out->byte_;
                 int8_t *isrc = (int8_t *)(X->dptr_) + i * middle * stride * X->byte_ + offset * stride * X->byte_;
-                opi_psram_cpy_out(idst, isrc, sizeof(int8_t) * attrs->split[n] * stride * out->byte_);
+                thinker_psram_cpy_out(idst, isrc, sizeof(int8_t) * attrs->split[n] * stride * out->byte_);
             }
             ret = T_SUCCESS;
         }
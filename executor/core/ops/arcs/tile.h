@@ -34,7 +34,7 @@ static void tile_float(float *input, float *output, int32_t ndim, const uint32_t
             os += (istmp % inShape[ndim - 2 - i]) * ostride;
             istmp = istmp / inShape[ndim - 2 - i];
         }
-        opi_psram_cpy_out(output + os, input + is * ishape_last, sizeof(float) * ishape_last);
+        thinker_psram_cpy_out(output + os, input + is * ishape_last, sizeof(float) * ishape_last);
     }
 
     // Step 2: Repeat elements along each dimension
@@ -62,7 +62,7 @@ static void tile_float(float *input, float *output, int32_t ndim, const uint32_t
 
             // Repeat the data
             for (int32_t r = 1; r < repeat[od]; r++) {
-                opi_psram_cpy_out(output + ros + r * len, output + ros, sizeof(float) * len);
+                thinker_psram_cpy_out(output + ros + r * len, output + ros, sizeof(float) * len);
             }
         }
         
@@ -101,7 +101,7 @@ static void tile_int8(int8_t *input, int8_t *output, int32_t ndim,
             os += (istmp % inShape[ndim - 2 - i]) * ostride;
             istmp = istmp / inShape[ndim - 2 - i];
         }
-        opi_psram_cpy_out(output + os, input + is * ishape_last, sizeof(int8_t) * ishape_last);
+        thinker_psram_cpy_out(output + os, input + is * ishape_last, sizeof(int8_t) * ishape_last);
     }
 
     // Step 2: Repeat elements along each dimension
@@ -129,7 +129,7 @@ static void tile_int8(int8_t *input, int8_t *output, int32_t ndim,
 
             // Repeat the data
             for (int32_t r = 1; r < repeat[od]; r++) {
-                opi_psram_cpy_out(output + ros + r * len, output + ros, sizeof(int8_t) * len);
+                thinker_psram_cpy_out(output + ros + r * len, output + ros, sizeof(int8_t) * len);
             }
         }
         
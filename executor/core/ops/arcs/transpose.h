@@ -167,7 +167,7 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                         ret = luna_memcpy_i8o8(src_temp, src, total_size);
                     }
                     ret = mat_transpose_all(src_temp, dst_temp, row, col, X->dtype_);
-                    opi_psram_cpy_out(dst, dst_temp, total_size);
+                    thinker_psram_cpy_out(dst, dst_temp, total_size);
                 }
                 else if (total_size > 16384) {
                     int8_t *src_temp = (int8_t *)src;
@@ -180,7 +180,7 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                         }
                     }
                     ret = split_mat_transpose_all(src_temp, dst_temp, row, col, X->dtype_);
-                    opi_psram_cpy_out(dst, dst_temp, total_size);
+                    thinker_psram_cpy_out(dst, dst_temp, total_size);
                 }
                 else
                     ret = T_ERR_NO_WORKSPACE;
@@ -190,13 +190,13 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                 int8_t *dst_temp = (int8_t *)workspace->dptr_;
                 if ((!srcInPSRAM) && (total_size <= workspace_size)) {
                     ret = luna_trans_axis_all(src, dst_temp, shape, axes, dims, X->dtype_);
-                    opi_psram_cpy_out(dst, dst_temp, total_size);
+                    thinker_psram_cpy_out(dst, dst_temp, total_size);
                 }
                 else if (srcInPSRAM && (total_size * 2 <= workspace_size)) {
                     int8_t *src_temp = (int8_t *)workspace->dptr_ + total_size;
                     ret = luna_memcpy_i8o8(src_temp, src, total_size);
                     ret = luna_trans_axis_all(src_temp, dst_temp, shape, axes, dims, X->dtype_);
-                    opi_psram_cpy_out(dst, dst_temp, total_size);
+                    thinker_psram_cpy_out(dst, dst_temp, total_size);
                 }
                 else if (0 == axes[0]) {// convert to 2D
                     int32_t batch = shape[0];
@@ -217,7 +217,7 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                                 ret = luna_memcpy_i8o8(src_temp, src + i * one_batch_size, one_batch_size);
                             }
                             ret = mat_transpose_all(src_temp, dst_temp, shape[1], shape[2], X->dtype_);
-                            opi_psram_cpy_out(dst + i * one_batch_size, dst_temp, one_batch_size);
+                            thinker_psram_cpy_out(dst + i * one_batch_size, dst_temp, one_batch_size);
                         }
                     }
                     else if (one_batch_size > 16384) {
@@ -232,7 +232,7 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                                 }
                             }
                             ret = split_mat_transpose_all(src_temp, dst_temp, shape[1], shape[2], X->dtype_);
-                            opi_psram_cpy_out(dst + i * one_batch_size, dst_temp, one_batch_size);
+                            thinker_psram_cpy_out(dst + i * one_batch_size, dst_temp, one_batch_size);
                         }
                     }
                     else
@@ -260,7 +260,7 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                                 int8_t *dst_temp = (int8_t *)workspace->dptr_;
                                 ret = luna_memcpy_i8o8(src_temp, src + i * one_batch_size, one_batch_size);
                                 ret = luna_trans_axis_all(src_temp, dst_temp, new_shape, new_axis, 3, X->dtype_);
-                                opi_psram_cpy_out(dst + i * one_batch_size, dst_temp, total_size);
+                                thinker_psram_cpy_out(dst + i * one_batch_size, dst_temp, total_size);
                             }
                         }
                         else
@@ -272,7 +272,7 @@ tStatus transpose_luna(tTensor *X, tTensor *Y, tTensor * workspace, uint32_t dim
                                 int8_t *src_temp = (int8_t *)src + one_batch_size;
                                 int8_t *dst_temp = (int8_t *)workspace->dptr_;
                                 ret = luna_trans_axis_all(src_temp, dst_temp, new_shape, new_axis, 3, X->dtype_);
-                                opi_psram_cpy_out(dst + i * one_batch_size, dst_temp, total_size);
+                                thinker_psram_cpy_out(dst + i * one_batch_size, dst_temp, total_size);
                             }
                         }
                         else 
@@ -29,18 +29,9 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     
     // Check if any platform is enabled
     #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-        #if THINKER_PROFILE
-        uint64_t start_t = tick_count();  // Record start time for profiling
-        #endif
-        
         // Call platform-specific ArgMax implementation
         ret = argmax_luna(tensors[0], tensors[op->num_input_], tensors[num_tensor - 1], attrs);
         
-        #if THINKER_PROFILE
-        uint64_t finish_t = tick_count();  // Record end time for profiling
-        uint32_t total_t = (uint32_t)(finish_t - start_t);
-        printf("%8s | %u | (","ArgMax", total_t);  
-        #endif
     #endif
 
     return ret;  // Return result code
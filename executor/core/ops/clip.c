@@ -17,6 +17,7 @@
  * @param min: Minimum value
  */
 #define CLIP(x, y, size, max, min)     \
+  THINKER_OMP_PARALLEL_FOR(size)       \
   for (int32_t i = 0; i < size; i++) { \
     if (x[i] < min) {                  \
       y[i] = min;                      \
@@ -46,16 +46,8 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     }
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
     // Call hardware-specific concat implementation
     ret = concat_luna(tensors, axis, op->num_input_, workspace, tensors[op->num_input_]);
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","Concat", total_t);  
-#endif
 #endif
 
     return ret;
@@ -55,22 +55,18 @@ int32_t X(Forward)(tOperator* op, tTensor** tensors, int32_t num_tensor, tDMA_Li
     int32_t ret = T_ERR_NO_IMPLEMENTED;
     
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-    
     // Process based on DMA list presence and tensor count
     if (list->total_ > 0) {
         // Handle DMA-based weight processing
         if (num_tensor == op->num_input_ + op->num_output_ + 1) {
             dma_temp = ((tTensor**)tensors)[op->num_input_ + op->num_output_];
-            Weight_temp.dptr_ = (addr_type)dma_temp->dptr_;
+            Weight_temp.dptr_ = (addr_type)((int8_t*)dma_temp->dptr_ + list->offset_);
             Weight_temp.mem_.type_ = 2;
         }
         else if (num_tensor == op->num_input_ + op->num_output_ + 2) {
             Temp = ((tTensor**)tensors)[op->num_input_ + op->num_output_];
             dma_temp = ((tTensor**)tensors)[op->num_input_ + op->num_output_ + 1];
-            Weight_temp.dptr_ = (addr_type)dma_temp->dptr_;
+            Weight_temp.dptr_ = (addr_type)((int8_t*)dma_temp->dptr_ + list->offset_);
             Weight_temp.mem_.type_ = 2;
         }
         
@@ -105,11 +101,6 @@ int32_t X(Forward)(tOperator* op, tTensor** tensors, int32_t num_tensor, tDMA_Li
         }
     }
     
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (", "Conv1dInt", total_t); 
-#endif
 #endif
 
     return ret;
@@ -71,6 +71,7 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
         }
         
         // Copy data element by element
+        THINKER_OMP_PARALLEL_FOR(size)
         for (int32_t i = 0; i < size; ++i) {
             int32_t inputIdx = 0;
             int32_t i_ = i;
@@ -86,7 +87,9 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
         for (int32_t i = 1; i < leading; ++i)
 #if THINKER_USE_VENUS
             memcpy(output + i * size * sizeof(Type), output, size * sizeof(Type));
-#elif THINKER_USE_ARCS || THINKER_USE_VENUSA
+#elif THINKER_USE_ARCS
+            thinker_psram_cpy_out(output + i * size * sizeof(Type), output, size * sizeof(Type));
+#elif THINKER_USE_VENUSA
             opi_psram_cpy_out(output + i * size * sizeof(Type), output, size * sizeof(Type));
 #endif
     });
@@ -36,10 +36,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     tTensor *workspace = NULL;
     
 #ifdef THINKER_USE_ARCS
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-    
     // Get workspace tensor if present
     if (num_tensor == op->num_input_ + op->num_output_ + 1) {
         workspace = ((tTensor **)tensors)[op->num_input_ + op->num_output_];
@@ -48,11 +44,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     // Call hardware-specific FFN implementation
     ret = ffnint_luna(input, weight1, bias1, weight2, bias2, workspace, output, attrs);
     
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","FFNInt", total_t);  
-#endif
 #endif
 
     return ret;
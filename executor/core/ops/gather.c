@@ -37,18 +37,9 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     if (num_tensor != 3) return T_ERR_INVALID_PARA;
     
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-    
     // Call hardware-specific gather implementation
     ret = gather_luna(tensors[0], tensors[1], tensors[op->num_input_], attr);
     
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","Gather", total_t);  
-#endif
 #endif
 
     return ret;
@@ -29,19 +29,9 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     GluIntAttrs *attrs = (GluIntAttrs *)((int8_t *)op + op->attr_offset_);
     
 #if THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-    
     // Call hardware-specific GLU implementation
     ret = gluint_luna(tensors[0], tensors[op->num_input_], tensors[op->num_input_ + 1], attrs);
     
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","GluInt", total_t);
-#endif
-
 #endif
 
     return ret;
@@ -57,9 +57,6 @@ int32_t X(Forward)(tOperator* op, tTensor** tensors, int32_t num_tensor, tDMA_Li
     tTensor mask;
     mask.shape_.ndim_ = 0;
 
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
 
 #ifdef THINKER_USE_VENUS
     // Venus hardware implementation
@@ -119,12 +116,6 @@ int32_t X(Forward)(tOperator* op, tTensor** tensors, int32_t num_tensor, tDMA_Li
     }
 #endif
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","GruInt", total_t);  
-#endif
-    
     return ret;
 }
 
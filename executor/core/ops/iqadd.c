@@ -34,10 +34,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     int32_t ret = T_ERR_NO_IMPLEMENTED;
     
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-
     // Get workspace tensor if present
     tTensor *workspace = NULL;
     if (num_tensor == op->num_input_ + op->num_output_ + 1) {
@@ -47,11 +43,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     // Call hardware-specific addition implementation
     ret = iqadd_luna(tensors[0], tensors[1], workspace, tensors[op->num_input_]);
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","iqAdd", total_t);  
-#endif
 
 #endif
 
@@ -37,18 +37,9 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     tTensor *workspace = ((tTensor **)tensors)[num_tensor - 1];
     
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-
     // Call hardware-specific multiplication implementation
     ret = iqmul_luna(tensors[0], tensors[1], tensors[op->num_input_], workspace, attrs);
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","iqMul", total_t);  
-#endif
 #endif
 
     return ret;
@@ -34,10 +34,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     int32_t ret = T_ERR_NO_IMPLEMENTED;
     
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-
     // Get input, pads, constants, and output tensors
     tTensor *X = tensors[0];
     tTensor *pads = tensors[1];
@@ -48,11 +44,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     // Call hardware-specific padding implementation
     ret = iqpad_luna(X, pads, constants, workspace, Y, attr);
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","iqPad", total_t);  
-#endif
 #endif
 
     return ret;
@@ -47,19 +47,15 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     if (list->total_ != 0)
         getWeightData(list, 0);
     
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-    
     if (list->total_ > 0) {
         tTensor *dma_buffer = NULL;
         if (num_tensor == op->num_input_ + op->num_output_ + 1) {
             dma_buffer = ((tTensor **)tensors)[op->num_input_ + op->num_output_];
-            weight_tmp.dptr_ = (addr_type)dma_buffer->dptr_;
+            weight_tmp.dptr_ = (addr_type)((int8_t *)dma_buffer->dptr_ + list->offset_);
         } else if (num_tensor == op->num_input_ + op->num_output_ + 2) {
             workspace = ((tTensor **)tensors)[op->num_input_ + op->num_output_];
             dma_buffer = ((tTensor **)tensors)[op->num_input_ + op->num_output_ + 1];
-            weight_tmp.dptr_ = (addr_type)dma_buffer->dptr_;
+            weight_tmp.dptr_ = (addr_type)((int8_t *)dma_buffer->dptr_ + list->offset_);
         }
         
         if (3 == op->num_input_) {
@@ -82,11 +78,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
         ret = layernormalint_venus(X, W, bias, Y, workspace, attrs);
     }
     
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","LayernormInt", total_t);  
-#endif
 #endif
 
     return ret;
@@ -49,26 +49,22 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
 #endif
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-
     if (list->total_ > 0) {
         tTensor *dma_buffer = NULL;
         if (num_tensor == op->num_input_ + op->num_output_ + 1) {
             dma_buffer = ((tTensor **)tensors)[op->num_input_ + op->num_output_];
-            weight->dptr_ = (addr_type)dma_buffer->dptr_;
+            weight->dptr_ = (addr_type)((int8_t *)dma_buffer->dptr_ + list->offset_);
         } else if (num_tensor == op->num_input_ + op->num_output_ + 2) {
             workspace = ((tTensor **)tensors)[op->num_input_ + op->num_output_];
             dma_buffer = ((tTensor **)tensors)[op->num_input_ + op->num_output_ + 1];
-            weight->dptr_ = (addr_type)dma_buffer->dptr_;
+            weight->dptr_ = (addr_type)((int8_t *)dma_buffer->dptr_ + list->offset_);
         }
         
         if (3 == op->num_input_) {
             bias = ((tTensor **)tensors)[op->num_input_ - 1];
             bias->scale_ = input->scale_ + weight->scale_;
             int32_t size = getShapeSize(&(weight->shape_)) * weight->byte_;
-            bias->dptr_ = (addr_type)((int8_t *)dma_buffer->dptr_ + ALIGN16(size));
+            bias->dptr_ = (addr_type)((int8_t *)weight->dptr_ + ALIGN16(size));
         }
         
         ret = linearint_luna(input, weight, bias, attrs, workspace, output);
@@ -83,11 +79,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
         ret = linearint_luna(input, weight, bias, attrs, workspace, output);
     }
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","LinearInt", total_t);  
-#endif
 #endif
 
     return ret;
@@ -72,10 +72,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
         getWeightData(list, 0);
 #endif
 
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-
 #if THINKER_USE_VENUS
     if (list->total_ > 0) {
         workspace = tensors[op->num_input_ + op->num_output_];
@@ -165,12 +161,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     }
 #endif
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","LSTMInt", total_t);
-#endif
-
     return ret;
 }
 
@@ -42,10 +42,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     tTensor *workspace = NULL;
     
 #if THINKER_USE_ARCS
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();
-#endif
-
     if (num_tensor == op->num_input_ + op->num_output_ + 1) {
         workspace = ((tTensor **)tensors)[op->num_input_ + op->num_output_];
     }
@@ -54,11 +50,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     ret = multiheadattention_luna(input, weight_q, bias_q, weight_k, bias_k, weight_v, bias_v,
                                  weight_p, bias_p, emb_keys, emb_values, output, workspace, attrs);
 
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","MultiheadAttentionInt", total_t);
-#endif
 #endif
 
     return ret;
@@ -33,16 +33,8 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     PreluAttrs *attrs = (PreluAttrs *)((int8_t *)op + op->attr_offset_);
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();  // Start profiling
-#endif
     ret = prelu_luna(tensors[0], tensors[op->num_input_], attrs);  // Execute PRelu operation
     
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","prelu", total_t);  // Print profiling results
-#endif
 #endif
 
     return 0;
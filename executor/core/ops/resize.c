@@ -4,6 +4,7 @@
 #define __OP__ Resize
 #include <math.h>
 #include "core/comm/thinker_log.h"
+#include "core/comm/utils.h"
 #include "core/operator_attrs.h"
 #include "core/operator_register.h"
 
@@ -119,6 +120,21 @@ static int32_t GetNearestPixelFunc(float x, nearestMode nmode) {
     }
 }
 
+/**
+ * @brief Clamp a source pixel index into [0, length - 1]
+ * @param x Source pixel index
+ * @param length Source length
+ * @return int32_t Clamped index
+ */
+static inline int32_t ClampIndex(int32_t x, int32_t length) {
+    if (x < 0) {
+        return 0;
+    } else if (x > length - 1) {
+        return length - 1;
+    }
+    return x;
+}
+
 /**
  * @brief Resize nearest neighbor function for 4D float tensors
  * @param input Input tensor data
@@ -130,167 +146,98 @@ static int32_t GetNearestPixelFunc(float x, nearestMode nmode) {
  * @param ctm Coordinate transformation mode
  * @param nmode Nearest neighbor mode
  * @return int32_t Execution status
+ * @note Output rows are independent and are distributed over OpenMP threads
  */
 static int32_t Resize_nearest_float4d(float *input, float *output, float *scale,
                                       int32_t *dims_original, int32_t *dims_resized,
                                       int32_t *roi, ctmode ctm, nearestMode nmode) {
     int32_t scaleh_i = (int32_t)scale[2];
     int32_t scalew_i = (int32_t)scale[3];
-    
+    int32_t b_c = dims_resized[0] * dims_resized[1];
+    int32_t out_h = dims_resized[2], in_h = dims_original[2];
+    int32_t out_w = dims_resized[3], in_w = dims_original[3];
+    int32_t rows = b_c * out_h;
+
     if (ctm == kasymmetric && nmode == kfloor && scalew_i == scaleh_i &&
         scalew_i == scale[3] && scaleh_i == scale[2] && scalew_i > 1) {
-        int32_t b_c = dims_resized[0] * dims_resized[1];
-        int32_t out_h = dims_resized[2], in_h = dims_original[2];
-        int32_t out_w = dims_resized[3], in_w = dims_original[3];
-        for (int32_t b = 0; b < b_c; ++b) {
-            const float *in_dptr = input + b * in_h * in_w;
-            float *out_dptr = output + b * out_h * out_w;
-            for (int32_t h = 0; h < out_h; ++h) {
-                for (int32_t w = 0; w < out_w; ++w) {
-                    out_dptr[h * out_w + w] = in_dptr[h / scaleh_i * in_w + w / scaleh_i];
-                }
+        THINKER_OMP_PARALLEL_FOR(rows * out_w)
+        for (int32_t r = 0; r < rows; ++r) {
+            const float *in_dptr = input + (r / out_h) * in_h * in_w;
+            float *out_dptr = output + r * out_w;
+            int32_t h = r % out_h;
+            for (int32_t w = 0; w < out_w; ++w) {
+                out_dptr[w] = in_dptr[h / scaleh_i * in_w + w / scaleh_i];
             }
         }
     } else if (ctm == khalf_pixel && nmode == kfloor) {
-        int32_t b_c = dims_resized[0] * dims_resized[1];
-        for (int32_t b = 0; b < b_c; ++b) {
-            for (int32_t h = 0; h < dims_resized[2]; ++h) {
-                float th = ((float)h + 0.5) / scale[2] - 0.5;
-                int32_t h_original = (int32_t)floor(th);
-                if (h_original < 0) {
-                    h_original = 0;
-                } else if (h_original > dims_original[2] - 1) {
-                    h_original = dims_original[2] - 1;
-                }
-                for (int32_t w = 0; w < dims_resized[3]; ++w) {
-                    float tw = ((float)w + 0.5) / scale[3] - 0.5;
-                    int32_t w_original = (int32_t)floor(tw);
-                    int32_t W = dims_original[3];
-                    if (w_original < 0) {
-                        w_original = 0;
-                    } else if (w_original >= W) {
-                        w_original = W - 1;
-                    }
-                    output[0] = input[w_original + h_original * W];
-                    ++output;
-                }
+        THINKER_OMP_PARALLEL_FOR(rows * out_w)
+        for (int32_t r = 0; r < rows; ++r) {
+            const float *in_dptr = input + (r / out_h) * in_h * in_w;
+            float *out_dptr = output + r * out_w;
+            float th = ((float)(r % out_h) + 0.5) / scale[2] - 0.5;
+            int32_t h_original = ClampIndex((int32_t)floor(th), in_h);
+            for (int32_t w = 0; w < out_w; ++w) {
+                float tw = ((float)w + 0.5) / scale[3] - 0.5;
+                int32_t w_original = ClampIndex((int32_t)floor(tw), in_w);
+                out_dptr[w] = in_dptr[w_original + h_original * in_w];
             }
-            input += dims_original[2] * dims_original[3];
         }
     } else if (ctm == kpytorch_half_pixel && nmode == kfloor) {
-        int32_t b_c = dims_resized[0] * dims_resized[1];
-        for (int32_t b = 0; b < b_c; ++b) {
-            for (int32_t h = 0; h < dims_resized[2]; ++h) {
-                float th = dims_resized[2] > 1 ? ((float)h + 0.5) / scale[2] - 0.5 : 0;
-                int32_t h_original = (int32_t)floor(th);
-                if (h_original < 0) {
-                    h_original = 0;
-                } else if (h_original > dims_original[2] - 1) {
-                    h_original = dims_original[2] - 1;
-                }
-                for (int32_t w = 0; w < dims_resized[3]; ++w) {
-                    float tw = dims_resized[3] > 1 ? ((float)w + 0.5) / scale[3] - 0.5 : 0;
-                    int32_t w_original = (int32_t)floor(tw);
-                    int32_t W = dims_original[3];
-                    if (w_original < 0) {
-                        w_original = 0;
-                    } else if (w_original >= W) {
-                        w_original = W - 1;
-                    }
-                    output[0] = input[w_original + h_original * W];
-                    ++output;
-                }
+        THINKER_OMP_PARALLEL_FOR(rows * out_w)
+        for (int32_t r = 0; r < rows; ++r) {
+            const float *in_dptr = input + (r / out_h) * in_h * in_w;
+            float *out_dptr = output + r * out_w;
+            float th = out_h > 1 ? ((float)(r % out_h) + 0.5) / scale[2] - 0.5 : 0;
+            int32_t h_original = ClampIndex((int32_t)floor(th), in_h);
+            for (int32_t w = 0; w < out_w; ++w) {
+                float tw = out_w > 1 ? ((float)w + 0.5) / scale[3] - 0.5 : 0;
+                int32_t w_original = ClampIndex((int32_t)floor(tw), in_w);
+                out_dptr[w] = in_dptr[w_original + h_original * in_w];
             }
-            input += dims_original[2] * dims_original[3];
         }
     } else if (ctm == ktf_crop_and_resize && nmode == kfloor) {
-        int32_t b_c = dims_resized[0] * dims_resized[1];
-        for (int32_t b = 0; b < b_c; ++b) {
-            for (int32_t h = 0; h < dims_resized[2]; ++h) {
-                float th = dims_resized[2] > 1
-                            ? roi[2] * (dims_original[2] - 1) +
-                               (float)h * (roi[6] - roi[2]) *
-                                   (dims_original[2] - 1) / (dims_resized[2] - 1)
-                            : 0.5 * (roi[2] + roi[6]) * (dims_resized[2] - 1);
-                int32_t h_original = (int32_t)floor(th);
-                if (h_original < 0) {
-                    h_original = 0;
-                } else if (h_original > dims_original[2] - 1) {
-                    h_original = dims_original[2] - 1;
-                }
-                for (int32_t w = 0; w < dims_resized[3]; ++w) {
-                    float tw = dims_resized[3] > 1
-                                ? roi[3] * (dims_original[3] - 1) +
-                                   (float)w * (roi[7] - roi[3]) *
-                                       (dims_original[3] - 1) /
-                                       (dims_resized[3] - 1)
-                                : 0.5 * (roi[3] + roi[7]) * (dims_resized[3] - 1);
-                    int32_t w_original = (int32_t)floor(tw);
-                    int32_t W = dims_original[3];
-                    if (w_original < 0) {
-                        w_original = 0;
-                    } else if (w_original >= W) {
-                        w_original = W - 1;
-                    }
-                    output[0] = input[w_original + h_original * W];
-                    ++output;
-                }
+        THINKER_OMP_PARALLEL_FOR(rows * out_w)
+        for (int32_t r = 0; r < rows; ++r) {
+            const float *in_dptr = input + (r / out_h) * in_h * in_w;
+            float *out_dptr = output + r * out_w;
+            float th = out_h > 1
+                        ? roi[2] * (in_h - 1) +
+                           (float)(r % out_h) * (roi[6] - roi[2]) * (in_h - 1) / (out_h - 1)
+                        : 0.5 * (roi[2] + roi[6]) * (out_h - 1);
+            int32_t h_original = ClampIndex((int32_t)floor(th), in_h);
+            for (int32_t w = 0; w < out_w; ++w) {
+                float tw = out_w > 1
+                            ? roi[3] * (in_w - 1) +
+                               (float)w * (roi[7] - roi[3]) * (in_w - 1) / (out_w - 1)
+                            : 0.5 * (roi[3] + roi[7]) * (out_w - 1);
+                int32_t w_original = ClampIndex((int32_t)floor(tw), in_w);
+                out_dptr[w] = in_dptr[w_original + h_original * in_w];
             }
-            input += dims_original[2] * dims_original[3];
         }
     } else if (ctm == kalign_corners && nmode == kfloor) {
-        int32_t b_c = dims_resized[0] * dims_resized[1];
-        for (int32_t b = 0; b < b_c; ++b) {
-            for (int32_t h = 0; h < dims_resized[2]; ++h) {
-                float th = (float)h * (dims_original[2] - 1) / (dims_resized[2] - 1);
-                int32_t h_original = (int32_t)floor(th);
-                if (h_original < 0) {
-                    h_original = 0;
-                } else if (h_original > dims_original[2] - 1) {
-                    h_original = dims_original[2] - 1;
-                }
-                for (int32_t w = 0; w < dims_resized[3]; ++w) {
-                    float tw = (float)w * (dims_original[3] - 1) / (dims_resized[3] - 1);
-                    int32_t w_original = (int32_t)floor(tw);
-                    int32_t W = dims_original[3];
-                    if (w_original < 0) {
-                        w_original = 0;
-                    } else if (w_original >= W) {
-                        w_original = W - 1;
-                    }
-                    output[0] = input[w_original + h_original * W];
-                    ++output;
-                }
+        THINKER_OMP_PARALLEL_FOR(rows * out_w)
+        for (int32_t r = 0; r < rows; ++r) {
+            const float *in_dptr = input + (r / out_h) * in_h * in_w;
+            float *out_dptr = output + r * out_w;
+            float th = (float)(r % out_h) * (in_h - 1) / (out_h - 1);
+            int32_t h_original = ClampIndex((int32_t)floor(th), in_h);
+            for (int32_t w = 0; w < out_w; ++w) {
+                float tw = (float)w * (in_w - 1) / (out_w - 1);
+                int32_t w_original = ClampIndex((int32_t)floor(tw), in_w);
+                out_dptr[w] = in_dptr[w_original + h_original * in_w];
             }
-            input += dims_original[2] * dims_original[3];
         }
     } else {
-        for (int32_t n = 0; n < dims_resized[0]; ++n) {
-            for (int32_t c = 0; c < dims_resized[1]; ++c) {
-                for (int32_t h = 0; h < dims_resized[2]; ++h) {
-                    float th = GetCoordinateFunc(h, ctm, scale[2], dims_original[2],
-                                                dims_resized[2], roi[2], roi[6]);
-                    int32_t h_original = GetNearestPixelFunc(th, nmode);
-                    if (h_original < 0) {
-                        h_original = 0;
-                    } else if (h_original > dims_original[2] - 1) {
-                        h_original = dims_original[2] - 1;
-                    }
-                    for (int32_t w = 0; w < dims_resized[3]; ++w) {
-                        float tw = GetCoordinateFunc(w, ctm, scale[3], dims_original[3],
-                                                    dims_resized[3], roi[3], roi[7]);
-                        int32_t w_original = GetNearestPixelFunc(tw, nmode);
-                        int32_t W = dims_original[3];
-                        if (w_original < 0) {
-                            w_original = 0;
-                        } else if (w_original >= W) {
-                            w_original = W - 1;
-                        }
-                        output[0] = input[w_original + h_original * W];
-                        ++output;
-                    }
-                }
-                input += dims_original[2] * dims_original[3];
+        THINKER_OMP_PARALLEL_FOR(rows * out_w)
+        for (int32_t r = 0; r < rows; ++r) {
+            const float *in_dptr = input + (r / out_h) * in_h * in_w;
+            float *out_dptr = output + r * out_w;
+            float th = GetCoordinateFunc(r % out_h, ctm, scale[2], in_h, out_h, roi[2], roi[6]);
+            int32_t h_original = ClampIndex(GetNearestPixelFunc(th, nmode), in_h);
+            for (int32_t w = 0; w < out_w; ++w) {
+                float tw = GetCoordinateFunc(w, ctm, scale[3], in_w, out_w, roi[3], roi[7]);
+                int32_t w_original = ClampIndex(GetNearestPixelFunc(tw, nmode), in_w);
+                out_dptr[w] = in_dptr[w_original + h_original * in_w];
             }
         }
     }
@@ -301,323 +248,144 @@ static int32_t Resize_nearest_float3d(float *input, float *output, float *scale,
                                int32_t *dims_original, int32_t *dims_resized,
                                int32_t *roi, ctmode ctm, nearestMode nmode) 
 {
-  for (int32_t n = 0; n < dims_resized[0]; ++n) {
-    for (int32_t c = 0; c < dims_resized[1]; ++c) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        float th = GetCoordinateFunc(h, ctm, scale[2], dims_original[2],
-                                     dims_resized[2], roi[2], roi[6]);
-        int32_t h_original = GetNearestPixelFunc(th, nmode);
-        if (h_original < 0)
-          h_original = 0;
-        else if (h_original > dims_original[2] - 1)
-          h_original = dims_original[2] - 1;
-
-        output[0] = input[h_original];
-        ++output;
-      }
-      input += dims_original[2];
+  int32_t b_c = dims_resized[0] * dims_resized[1];
+  int32_t in_h = dims_original[2], out_h = dims_resized[2];
+  THINKER_OMP_PARALLEL_FOR(b_c * out_h)
+  for (int32_t b = 0; b < b_c; ++b) {
+    const float *in_dptr = input + b * in_h;
+    float *out_dptr = output + b * out_h;
+    for (int32_t h = 0; h < out_h; ++h) {
+      float th = GetCoordinateFunc(h, ctm, scale[2], in_h, out_h, roi[2], roi[6]);
+      int32_t h_original = ClampIndex(GetNearestPixelFunc(th, nmode), in_h);
+      out_dptr[h] = in_dptr[h_original];
     }
   }
   return 0;
 }
 
+/**
+ * @brief Bilinear sample of one channel at a source coordinate
+ * @param input Channel data
+ * @param H Channel height
+ * @param W Channel width
+ * @param y Source row coordinate
+ * @param x Source column coordinate
+ * @return float Interpolated value
+ */
+static inline float LinearSample(const float *input, int32_t H, int32_t W, float y, float x)
+{
+  int32_t x0, x1, y0, y1;
+  // 如果值在[0,H-1]或[0,W-1]之外
+  if (x < 0)
+    x0 = x1 = 0;
+  else if (x > W - 1)
+    x0 = x1 = W - 1;
+  else {
+    x0 = (int32_t)x;
+    x1 = x0 + 1;
+  }
+  if (y < 0)
+    y0 = y1 = 0;
+  else if (y > H - 1)
+    y0 = y1 = H - 1;
+  else {
+    y0 = (int32_t)y;
+    y1 = y0 + 1;
+  }
+  /**
+   * H(x0,y1)    G(x1,y1)
+   *      X(x,y)
+   * I(x0,y0)    J(x1,y0)
+   **/
+  float wx = x - x0, wy = y - y0;
+  float wI = (1 - wy) * (1 - wx);
+  float wJ = (1 - wy) * wx;
+  float wH = wy * (1 - wx);
+  float wG = wx * wy;
+  // todo: 加上exclude_outside系数
+  return wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
+         wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
+}
+
 static int32_t Resize_linear_float(float *input, float *output, float *scale,
                             int32_t *dims_original, int32_t *dims_resized,
                             int32_t *roi, ctmode ctm) 
 {
+  int32_t b_c = dims_resized[0] * dims_resized[1];
+  int32_t out_h = dims_resized[2], in_h = dims_original[2];
+  int32_t out_w = dims_resized[3], in_w = dims_original[3];
+  int32_t rows = b_c * out_h;
+
   if (ctm == kasymmetric) {
-    int32_t b_c = dims_resized[0] * dims_resized[1];
-    for (int32_t b = 0; b < b_c; ++b) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        for (int32_t w = 0; w < dims_resized[3]; ++w) {
-          float h_original = (float)h / scale[2];
-          float w_original = (float)w / scale[3];
-          float x = w_original, y = h_original;
-          int32_t x0, x1, y0, y1;
-          // 如果值在[0,H-1]或[0,W-1]之外
-          if (x < 0)
-            x0 = x1 = 0;
-          else if (x > dims_original[3] - 1)
-            x0 = x1 = dims_original[3] - 1;
-          else {
-            x0 = (int32_t)w_original;
-            x1 = x0 + 1;
-          }
-          if (y < 0)
-            y0 = y1 = 0;
-          else if (y > dims_original[2] - 1)
-            y0 = y1 = dims_original[2] - 1;
-          else {
-            y0 = (int32_t)h_original;
-            y1 = y0 + 1;
-          }
-          /**
-           * H(x0,y1)    G(x1,y1)
-           *      X(x,y)
-           * I(x0,y0)    J(x1,y0)
-           **/
-          float wx = x - x0, wy = y - y0;
-          float wI = (1 - wy) * (1 - wx);
-          float wJ = (1 - wy) * wx;
-          float wH = wy * (1 - wx);
-          float wG = wx * wy;
-          int32_t W = dims_original[3];
-          // todo: 加上exclude_outside系数
-          float value = wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
-                        wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
-          output[0] = value;
-          ++output;
-        }
-        input += dims_original[2] * dims_original[3];
+    THINKER_OMP_PARALLEL_FOR(rows * out_w)
+    for (int32_t r = 0; r < rows; ++r) {
+      const float *in_dptr = input + (r / out_h) * in_h * in_w;
+      float *out_dptr = output + r * out_w;
+      float h_original = (float)(r % out_h) / scale[2];
+      for (int32_t w = 0; w < out_w; ++w) {
+        float w_original = (float)w / scale[3];
+        out_dptr[w] = LinearSample(in_dptr, in_h, in_w, h_original, w_original);
       }
     }
   } else if (ctm == khalf_pixel) {
-    int32_t b_c = dims_resized[0] * dims_resized[1];
-    for (int32_t b = 0; b < b_c; ++b) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        for (int32_t w = 0; w < dims_resized[3]; ++w) {
-          float h_original = ((float)h + 0.5) / scale[2] - 0.5;
-          float w_original = ((float)w + 0.5) / scale[3] - 0.5;
-          float x = w_original, y = h_original;
-          int32_t x0, x1, y0, y1;
-          // 如果值在[0,H-1]或[0,W-1]之外
-          if (x < 0)
-            x0 = x1 = 0;
-          else if (x > dims_original[3] - 1)
-            x0 = x1 = dims_original[3] - 1;
-          else {
-            x0 = (int32_t)w_original;
-            x1 = x0 + 1;
-          }
-          if (y < 0)
-            y0 = y1 = 0;
-          else if (y > dims_original[2] - 1)
-            y0 = y1 = dims_original[2] - 1;
-          else {
-            y0 = (int32_t)h_original;
-            y1 = y0 + 1;
-          }
-          /**
-           * H(x0,y1)    G(x1,y1)
-           *      X(x,y)
-           * I(x0,y0)    J(x1,y0)
-           **/
-          float wx = x - x0, wy = y - y0;
-          float wI = (1 - wy) * (1 - wx);
-          float wJ = (1 - wy) * wx;
-          float wH = wy * (1 - wx);
-          float wG = wx * wy;
-          int32_t W = dims_original[3];
-          // todo: 加上exclude_outside系数
-          float value = wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
-                        wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
-          output[0] = value;
-          ++output;
-        }
-        input += dims_original[2] * dims_original[3];
+    THINKER_OMP_PARALLEL_FOR(rows * out_w)
+    for (int32_t r = 0; r < rows; ++r) {
+      const float *in_dptr = input + (r / out_h) * in_h * in_w;
+      float *out_dptr = output + r * out_w;
+      float h_original = ((float)(r % out_h) + 0.5) / scale[2] - 0.5;
+      for (int32_t w = 0; w < out_w; ++w) {
+        float w_original = ((float)w + 0.5) / scale[3] - 0.5;
+        out_dptr[w] = LinearSample(in_dptr, in_h, in_w, h_original, w_original);
       }
     }
   } else if (ctm == kpytorch_half_pixel) {
-    int32_t b_c = dims_resized[0] * dims_resized[1];
-    for (int32_t b = 0; b < b_c; ++b) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        for (int32_t w = 0; w < dims_resized[3]; ++w) {
-          float h_original =
-              dims_resized[2] > 1 ? ((float)h + 0.5) / scale[2] - 0.5 : 0;
-          float w_original =
-              dims_resized[3] > 1 ? ((float)w + 0.5) / scale[3] - 0.5 : 0;
-          float x = w_original, y = h_original;
-          int32_t x0, x1, y0, y1;
-          // 如果值在[0,H-1]或[0,W-1]之外
-          if (x < 0)
-            x0 = x1 = 0;
-          else if (x > dims_original[3] - 1)
-            x0 = x1 = dims_original[3] - 1;
-          else {
-            x0 = (int32_t)w_original;
-            x1 = x0 + 1;
-          }
-          if (y < 0)
-            y0 = y1 = 0;
-          else if (y > dims_original[2] - 1)
-            y0 = y1 = dims_original[2] - 1;
-          else {
-            y0 = (int32_t)h_original;
-            y1 = y0 + 1;
-          }
-          /**
-           * H(x0,y1)    G(x1,y1)
-           *      X(x,y)
-           * I(x0,y0)    J(x1,y0)
-           **/
-          float wx = x - x0, wy = y - y0;
-          float wI = (1 - wy) * (1 - wx);
-          float wJ = (1 - wy) * wx;
-          float wH = wy * (1 - wx);
-          float wG = wx * wy;
-          int32_t W = dims_original[3];
-          // todo: 加上exclude_outside系数
-          float value = wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
-                        wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
-          output[0] = value;
-          ++output;
-        }
-        input += dims_original[2] * dims_original[3];
+    THINKER_OMP_PARALLEL_FOR(rows * out_w)
+    for (int32_t r = 0; r < rows; ++r) {
+      const float *in_dptr = input + (r / out_h) * in_h * in_w;
+      float *out_dptr = output + r * out_w;
+      float h_original = out_h > 1 ? ((float)(r % out_h) + 0.5) / scale[2] - 0.5 : 0;
+      for (int32_t w = 0; w < out_w; ++w) {
+        float w_original = out_w > 1 ? ((float)w + 0.5) / scale[3] - 0.5 : 0;
+        out_dptr[w] = LinearSample(in_dptr, in_h, in_w, h_original, w_original);
       }
     }
   } else if (ctm == kalign_corners) {
-    int32_t b_c = dims_resized[0] * dims_resized[1];
-    for (int32_t b = 0; b < b_c; ++b) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        for (int32_t w = 0; w < dims_resized[3]; ++w) {
-          float h_original =
-              (float)h * (dims_original[2] - 1) / (dims_original[2] - 1);
-          float w_original =
-              (float)w * (dims_original[3] - 1) / (dims_original[3] - 1);
-          float x = w_original, y = h_original;
-          int32_t x0, x1, y0, y1;
-          // 如果值在[0,H-1]或[0,W-1]之外
-          if (x < 0)
-            x0 = x1 = 0;
-          else if (x > dims_original[3] - 1)
-            x0 = x1 = dims_original[3] - 1;
-          else {
-            x0 = (int32_t)w_original;
-            x1 = x0 + 1;
-          }
-          if (y < 0)
-            y0 = y1 = 0;
-          else if (y > dims_original[2] - 1)
-            y0 = y1 = dims_original[2] - 1;
-          else {
-            y0 = (int32_t)h_original;
-            y1 = y0 + 1;
-          }
-          /**
-           * H(x0,y1)    G(x1,y1)
-           *      X(x,y)
-           * I(x0,y0)    J(x1,y0)
-           **/
-          float wx = x - x0, wy = y - y0;
-          float wI = (1 - wy) * (1 - wx);
-          float wJ = (1 - wy) * wx;
-          float wH = wy * (1 - wx);
-          float wG = wx * wy;
-          int32_t W = dims_original[3];
-          // todo: 加上exclude_outside系数
-          float value = wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
-                        wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
-          output[0] = value;
-          ++output;
-        }
-        input += dims_original[2] * dims_original[3];
+    THINKER_OMP_PARALLEL_FOR(rows * out_w)
+    for (int32_t r = 0; r < rows; ++r) {
+      const float *in_dptr = input + (r / out_h) * in_h * in_w;
+      float *out_dptr = output + r * out_w;
+      float h_original = (float)(r % out_h) * (in_h - 1) / (in_h - 1);
+      for (int32_t w = 0; w < out_w; ++w) {
+        float w_original = (float)w * (in_w - 1) / (in_w - 1);
+        out_dptr[w] = LinearSample(in_dptr, in_h, in_w, h_original, w_original);
       }
     }
   } else if (ctm == ktf_crop_and_resize) {
-    int32_t b_c = dims_resized[0] * dims_resized[1];
-    for (int32_t b = 0; b < b_c; ++b) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        for (int32_t w = 0; w < dims_resized[3]; ++w) {
-          float h_original =
-              dims_resized[2] > 1
-                  ? roi[2] * (dims_original[2] - 1) +
-                        (float)h * (roi[6] - roi[2]) * (dims_original[2] - 1) /
-                            (dims_resized[2] - 1)
-                  : 0.5 * (roi[2] + roi[6]) * (dims_original[2] - 1);
-
-          float w_original =
-              dims_resized[3] > 1
-                  ? roi[3] * (dims_original[3] - 1) +
-                        (float)w * (roi[7] - roi[3]) * (dims_original[3] - 1) /
-                            (dims_resized[3] - 1)
-                  : 0.5 * (roi[3] + roi[7]) * (dims_original[3] - 1);
-          float x = w_original, y = h_original;
-          int32_t x0, x1, y0, y1;
-          // 如果值在[0,H-1]或[0,W-1]之外
-          if (x < 0)
-            x0 = x1 = 0;
-          else if (x > dims_original[3] - 1)
-            x0 = x1 = dims_original[3] - 1;
-          else {
-            x0 = (int32_t)w_original;
-            x1 = x0 + 1;
-          }
-          if (y < 0)
-            y0 = y1 = 0;
-          else if (y > dims_original[2] - 1)
-            y0 = y1 = dims_original[2] - 1;
-          else {
-            y0 = (int32_t)h_original;
-            y1 = y0 + 1;
-          }
-          /**
-           * H(x0,y1)    G(x1,y1)
-           *      X(x,y)
-           * I(x0,y0)    J(x1,y0)
-           **/
-          float wx = x - x0, wy = y - y0;
-          float wI = (1 - wy) * (1 - wx);
-          float wJ = (1 - wy) * wx;
-          float wH = wy * (1 - wx);
-          float wG = wx * wy;
-          int32_t W = dims_original[3];
-          // todo: 加上exclude_outside系数
-          float value = wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
-                        wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
-          output[0] = value;
-          ++output;
-        }
-        input += dims_original[2] * dims_original[3];
+    THINKER_OMP_PARALLEL_FOR(rows * out_w)
+    for (int32_t r = 0; r < rows; ++r) {
+      const float *in_dptr = input + (r / out_h) * in_h * in_w;
+      float *out_dptr = output + r * out_w;
+      float h_original =
+          out_h > 1 ? roi[2] * (in_h - 1) +
+                          (float)(r % out_h) * (roi[6] - roi[2]) * (in_h - 1) / (out_h - 1)
+                    : 0.5 * (roi[2] + roi[6]) * (in_h - 1);
+      for (int32_t w = 0; w < out_w; ++w) {
+        float w_original =
+            out_w > 1 ? roi[3] * (in_w - 1) +
+                            (float)w * (roi[7] - roi[3]) * (in_w - 1) / (out_w - 1)
+                      : 0.5 * (roi[3] + roi[7]) * (in_w - 1);
+        out_dptr[w] = LinearSample(in_dptr, in_h, in_w, h_original, w_original);
       }
     }
   } else {
-    for (int32_t n = 0; n < dims_resized[0]; ++n) {
-      for (int32_t c = 0; c < dims_resized[1]; ++c) {
-        for (int32_t h = 0; h < dims_resized[2]; ++h)
-          for (int32_t w = 0; w < dims_resized[3]; ++w) {
-            float h_original =
-                GetCoordinateFunc(h, ctm, scale[2], dims_original[2],
-                                  dims_resized[2], roi[2], roi[6]);
-            float w_original =
-                GetCoordinateFunc(w, ctm, scale[3], dims_original[3],
-                                  dims_resized[3], roi[3], roi[7]);
-            float x = w_original, y = h_original;
-            int32_t x0, x1, y0, y1;
-            // 如果值在[0,H-1]或[0,W-1]之外
-            if (x < 0)
-              x0 = x1 = 0;
-            else if (x > dims_original[3] - 1)
-              x0 = x1 = dims_original[3] - 1;
-            else {
-              x0 = (int32_t)w_original;
-              x1 = x0 + 1;
-            }
-            if (y < 0)
-              y0 = y1 = 0;
-            else if (y > dims_original[2] - 1)
-              y0 = y1 = dims_original[2] - 1;
-            else {
-              y0 = (int32_t)h_original;
-              y1 = y0 + 1;
-            }
-            /**
-             * H(x0,y1)    G(x1,y1)
-             *      X(x,y)
-             * I(x0,y0)    J(x1,y0)
-             **/
-            float wx = x - x0, wy = y - y0;
-            float wI = (1 - wy) * (1 - wx);
-            float wJ = (1 - wy) * wx;
-            float wH = wy * (1 - wx);
-            float wG = wx * wy;
-            int32_t W = dims_original[3];
-            // todo: 加上exclude_outside系数
-            float value = wI * input[x0 + y0 * W] + wJ * input[x1 + y0 * W] +
-                          wH * input[x0 + y1 * W] + wG * input[x1 + y1 * W];
-            output[0] = value;
-            ++output;
-          }
-        input += dims_original[2] * dims_original[3];
+    THINKER_OMP_PARALLEL_FOR(rows * out_w)
+    for (int32_t r = 0; r < rows; ++r) {
+      const float *in_dptr = input + (r / out_h) * in_h * in_w;
+      float *out_dptr = output + r * out_w;
+      float h_original = GetCoordinateFunc(r % out_h, ctm, scale[2], in_h, out_h, roi[2], roi[6]);
+      for (int32_t w = 0; w < out_w; ++w) {
+        float w_original = GetCoordinateFunc(w, ctm, scale[3], in_w, out_w, roi[3], roi[7]);
+        out_dptr[w] = LinearSample(in_dptr, in_h, in_w, h_original, w_original);
       }
     }
   }
@@ -628,36 +396,26 @@ static int32_t Resize_linear_float3d(float *input, float *output, float *scale,
                               int32_t *dims_original, int32_t *dims_resized,
                               int32_t *roi, ctmode ctm) 
 {
-  for (int32_t n = 0; n < dims_resized[0]; ++n) {
-    for (int32_t c = 0; c < dims_resized[1]; ++c) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h) {
-        float h_original = GetCoordinateFunc(h, ctm, scale[2], dims_original[2],
-                                             dims_resized[2], roi[2], roi[6]);
-
-        float y = h_original;
-        int32_t y0, y1;
-        if (y < 0)
-          y0 = y1 = 0;
-        else if (y > dims_original[2] - 1)
-          y0 = y1 = dims_original[2] - 1;
-        else {
-          y0 = (int32_t)h_original;
-          y1 = y0 + 1;
-        }
-        /**
-         * H(x0,y1)    G(x1,y1)
-         *      X(x,y)
-         * I(x0,y0)    J(x1,y0)
-         **/
-        float wy = y - y0;
-        float wI = (1 - wy);
-        float wH = wy;
-        // todo: 加上exclude_outside系数
-        float value = wI * input[y0] + wH * input[y1];
-        output[0] = value;
-        ++output;
+  int32_t b_c = dims_resized[0] * dims_resized[1];
+  int32_t in_h = dims_original[2], out_h = dims_resized[2];
+  THINKER_OMP_PARALLEL_FOR(b_c * out_h)
+  for (int32_t b = 0; b < b_c; ++b) {
+    const float *in_dptr = input + b * in_h;
+    float *out_dptr = output + b * out_h;
+    for (int32_t h = 0; h < out_h; ++h) {
+      float y = GetCoordinateFunc(h, ctm, scale[2], in_h, out_h, roi[2], roi[6]);
+      int32_t y0, y1;
+      if (y < 0)
+        y0 = y1 = 0;
+      else if (y > in_h - 1)
+        y0 = y1 = in_h - 1;
+      else {
+        y0 = (int32_t)y;
+        y1 = y0 + 1;
       }
-      input += dims_original[2];
+      float wy = y - y0;
+      // todo: 加上exclude_outside系数
+      out_dptr[h] = (1 - wy) * in_dptr[y0] + wy * in_dptr[y1];
     }
   }
   return 0;
@@ -678,54 +436,50 @@ static int32_t Resize_cubic_float(float *input, float *output, float *scale,
                            int32_t *dims_original, int32_t *dims_resized,
                            int32_t *roi, ctmode ctm, float cubic_coeff_a) 
 {
-  for (int32_t n = 0; n < dims_resized[0]; ++n) {
-    for (int32_t c = 0; c < dims_resized[1]; ++c) {
-      for (int32_t h = 0; h < dims_resized[2]; ++h)
-        for (int32_t w = 0; w < dims_resized[3]; ++w) {
-          float h_original =
-              GetCoordinateFunc(h, ctm, scale[2], dims_original[2],
-                                dims_resized[2], roi[2], roi[6]);
-          float w_original =
-              GetCoordinateFunc(w, ctm, scale[3], dims_original[3],
-                                dims_resized[3], roi[3], roi[7]);
-          int32_t x = (int32_t)floor(w_original),
-                  y = (int32_t)floor(h_original);
-          int32_t H = dims_original[2];
-          int32_t W = dims_original[3];
-          // 获取周围4*4图像的坐标
-          int32_t dx[4], dy[4];
-          for (int32_t i = 0; i < 4; ++i) {
-            dx[i] = x + i - 1;
-            dy[i] = y + i - 1;
-            dx[i] = dx[i] < 0 ? 0 : dx[i];
-            dx[i] = dx[i] >= W ? W - 1 : dx[i];
-            dy[i] = dy[i] < 0 ? 0 : dy[i];
-            dy[i] = dy[i] >= H ? H - 1 : dy[i];
-          }
-          // 获取周围4*4图像的权重
-          float wx[4], wy[4];
-          float u = w_original - x;
-          float v = h_original - y;
-          wx[0] = Bicubic(1 + u, cubic_coeff_a);
-          wx[1] = Bicubic(u, cubic_coeff_a);
-          wx[2] = Bicubic(1 - u, cubic_coeff_a);
-          wx[3] = Bicubic(2 - u, cubic_coeff_a);
-          wy[0] = Bicubic(1 + v, cubic_coeff_a);
-          wy[1] = Bicubic(v, cubic_coeff_a);
-          wy[2] = Bicubic(1 - v, cubic_coeff_a);
-          wy[3] = Bicubic(2 - v, cubic_coeff_a);
-          // 加权求和得到最终结果
-          float value = 0;
+  int32_t b_c = dims_resized[0] * dims_resized[1];
+  int32_t out_h = dims_resized[2], H = dims_original[2];
+  int32_t out_w = dims_resized[3], W = dims_original[3];
+  int32_t rows = b_c * out_h;
+  THINKER_OMP_PARALLEL_FOR(rows * out_w)
+  for (int32_t r = 0; r < rows; ++r) {
+    const float *in_dptr = input + (r / out_h) * H * W;
+    float *out_dptr = output + r * out_w;
+    float h_original = GetCoordinateFunc(r % out_h, ctm, scale[2], H, out_h, roi[2], roi[6]);
+    int32_t y = (int32_t)floor(h_original);
+    // 获取周围4*4图像的行坐标和行权重
+    int32_t dy[4];
+    float wy[4];
+    float v = h_original - y;
+    for (int32_t i = 0; i < 4; ++i) {
+      dy[i] = ClampIndex(y + i - 1, H);
+    }
+    wy[0] = Bicubic(1 + v, cubic_coeff_a);
+    wy[1] = Bicubic(v, cubic_coeff_a);
+    wy[2] = Bicubic(1 - v, cubic_coeff_a);
+    wy[3] = Bicubic(2 - v, cubic_coeff_a);
+    for (int32_t w = 0; w < out_w; ++w) {
+      float w_original = GetCoordinateFunc(w, ctm, scale[3], W, out_w, roi[3], roi[7]);
+      int32_t x = (int32_t)floor(w_original);
+      // 获取周围4*4图像的列坐标和列权重
+      int32_t dx[4];
+      float wx[4];
+      float u = w_original - x;
+      for (int32_t i = 0; i < 4; ++i) {
+        dx[i] = ClampIndex(x + i - 1, W);
+      }
+      wx[0] = Bicubic(1 + u, cubic_coeff_a);
+      wx[1] = Bicubic(u, cubic_coeff_a);
+      wx[2] = Bicubic(1 - u, cubic_coeff_a);
+      wx[3] = Bicubic(2 - u, cubic_coeff_a);
+      // 加权求和得到最终结果
+      float value = 0;
 
-          // todo: 加上exclude_outside系数
-          for (int32_t i = 0; i < 4; ++i)
-            for (int32_t j = 0; j < 4; ++j) {
-              value += wx[i] * wy[j] * input[dx[i] + dy[j] * W];
-            }
-          output[0] = value;
-          ++output;
+      // todo: 加上exclude_outside系数
+      for (int32_t i = 0; i < 4; ++i)
+        for (int32_t j = 0; j < 4; ++j) {
+          value += wx[i] * wy[j] * in_dptr[dx[i] + dy[j] * W];
         }
-      input += dims_original[2] * dims_original[3];
+      out_dptr[w] = value;
     }
   }
   return 0;
@@ -41,15 +41,7 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     int32_t ret = T_ERR_NO_IMPLEMENTED;
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();  // Start profiling
-#endif
     ret = slice_luna(tensors[0], start, end, axis, step, tensors[op->num_input_]);  // Execute slice operation
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","Slice", total_t);  // Print profiling results
-#endif
 #endif
 
     return ret;
@@ -38,15 +38,7 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     }
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();  // Start profiling
-#endif
     ret = softmaxint_luna(tensors[0], tensors[op->num_input_], workspace, attr);
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","SoftmaxInt", total_t);  // Print profiling results
-#endif
 #endif
 
     return ret;
@@ -37,18 +37,10 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     tTensor *workspace = NULL;
 
 #if THINKER_USE_ARCS
-#if THINKER_PROFILE
-    uint64_t start_t = tick_count();  // Start profiling
-#endif
     if (num_tensor == op->num_input_ + op->num_output_ + 1) {
         workspace = tensors[op->num_input_ + op->num_output_];
     }
     ret = sparifyffnint_luna(input, weight1, bias1, weight2, bias2, weight3, bias3, workspace, output, attrs);
-#if THINKER_PROFILE
-    uint64_t finish_t = tick_count();
-    uint32_t total_t = (uint32_t)(finish_t - start_t);
-    printf("%8s | %u | (","SparifyFFNInt", total_t);  // Print profiling results
-#endif
 #endif
 
     return ret;
@@ -96,10 +96,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
     return ret;
 
 #if THINKER_USE_VENUS || THINKER_USE_ARCS || THINKER_USE_VENUSA
-#if THINKER_PROFILE
-  uint64_t start_t = tick_count();
-#endif
-
   if (num_tensor == op->num_input_ + op->num_output_ + 1) {
     workspace = ((tTensor**)tensors)[op->num_input_ + op->num_output_];
     workspace_size = workspace->shape_.dims_[0];
@@ -123,11 +119,6 @@ int32_t X(Forward)(tOperator *op, tTensor **tensors, int32_t num_tensor, tDMA_Li
   ret = merge_transpose_axes(axes, shape, &new_dims);
   ret |= transpose_luna(X, Y, workspace, new_dims, axes, shape);
 
-#if THINKER_PROFILE
-  uint64_t finish_t = tick_count();
-	uint32_t total_t = (uint32_t)(finish_t - start_t);
-  printf("%8s | %u | (","transpose", total_t);  
-#endif  
 #endif
 
   return ret;
@@ -28,13 +28,14 @@ int32_t logsoftmax_luna(tTensor *data, tTensor *out, LogSoftmaxAttrs *attrs) {
     // Check if input and output tensors have the same data type
     CHECK_EQ(data->dtype_, out->dtype_);
 
+    int32_t axis = attrs->axis;  // attrs are shared by executors and may be mapped read-only
     // Adjust negative axis to positive
-    if (attrs->axis < 0) {
-        attrs->axis += data->shape_.ndim_;
+    if (axis < 0) {
+        axis += data->shape_.ndim_;
     }
 
     // Ensure axis is within valid range
-    CHECK_LT(attrs->axis, data->shape_.ndim_);
+    CHECK_LT(axis, data->shape_.ndim_);
 
     // Calculate leading dimensions and stride
     int leading = 1;
@@ -42,7 +43,7 @@ int32_t logsoftmax_luna(tTensor *data, tTensor *out, LogSoftmaxAttrs *attrs) {
     int i = 0;
 
     // Compute leading dimensions up to the specified axis
-    for (; i < attrs->axis; ++i) {
+    for (; i < axis; ++i) {
         leading *= data->shape_.dims_[i];
     }
 
@@ -35,11 +35,13 @@ int32_t requant_luna(tTensor* X, tTensor* Y) {
     if (dst_bits > src_bits) {
         if (dst_bits == 32) {
             int32_t* output = (int32_t*)Y->dptr_;
+            THINKER_OMP_PARALLEL_FOR(size)
             for (int32_t i = 0; i < size; ++i) {
                 output[i] = input[i] << (q_y - q_x);
             }
         } else if (dst_bits == 16) {
             int16_t* output = (int16_t*)Y->dptr_;
+            THINKER_OMP_PARALLEL_FOR(size)
             for (int32_t i = 0; i < size; ++i) {
                 output[i] = input[i] << (q_y - q_x);
             }
@@ -20,19 +20,20 @@
  * @return int32_t Operation status
  */
 int32_t split_venus(tTensor *X, tTensor **tensors, SliceAttrs *attrs) {
+    int32_t axis = attrs->axis;  // attrs are shared by executors and may be mapped read-only
     // Adjust negative axis
-    if (attrs->axis < 0) {
-        attrs->axis += X->shape_.ndim_;
+    if (axis < 0) {
+        axis += X->shape_.ndim_;
     }
     // Check if axis is valid
-    if (attrs->axis >= X->shape_.ndim_) {
+    if (axis >= X->shape_.ndim_) {
         return -1;
     }
 
     // Calculate leading, middle, and stride dimensions
     int32_t leading = 1, middle = 1, stride = 1;
     int32_t index = 0;
-    for (; index < attrs->axis; ++index) {
+    for (; index < axis; ++index) {
         leading *= X->shape_.dims_[index];
     }
     middle = X->shape_.dims_[index++];
@@ -1,42 +1,464 @@
 #include "scalar_op.h"
+#include <string.h>
 #include "thinker_log.h"
 
-int32_t ScalarFunc(double *scalars, const ScalarOpType *op_type,
-                   const int32_t *io_ids, int input_num)
+#define ALIGN16(n) ((n+15)&~15)
+
+#define SCALAR_LIVE     1   // scalar reaches a graph output
+#define SCALAR_CONST    2   // value is known before any input is set
+#define SCALAR_PRODUCED 4   // scalar is the output of a node
+#define SCALAR_INPUT    8   // scalar is a graph input
+
+#define SCALAR_POWI_MAX 64  // largest exponent lowered to repeated multiplication
+
+#if THINKER_SCALAR_THREADED
+#define SCALAR_DISPATCH() goto *labels[pc->op_]
+#define SCALAR_CASE(op)   L_##op:
+#else
+#define SCALAR_DISPATCH() goto dispatch
+#define SCALAR_CASE(op)   case SCALAR_OP_##op:
+#endif
+#define SCALAR_NEXT() do { ++pc; SCALAR_DISPATCH(); } while (0)
+
+// runFraction status of a value leaving int32, the program is redone with doubles
+#define SCALAR_OVERFLOW T_ERR_INDEX_OF_BOUND
+
+static int64_t qGcd(int64_t a, int64_t b)
+{
+  while (b != 0) {
+    int64_t t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// store num/den reduced, -1 on a zero denominator, 1 on int32 overflow
+static int32_t qSet(tScalarReg *r, int64_t num, int64_t den)
 {
-  int32_t ret = 0;
-  switch (*op_type)
+  if (den == 0) return -1;
+  if (den < 0) {
+    num = -num;
+    den = -den;
+  }
+  if (den != 1) {
+    int64_t g = qGcd(num < 0 ? -num : num, den);
+    if (g > 1) {
+      num /= g;
+      den /= g;
+    }
+  }
+  if (num > INT32_MAX || num < INT32_MIN || den > INT32_MAX) return 1;
+  r->q_.num_ = (int32_t)num;
+  r->q_.den_ = (int32_t)den;
+  return 0;
+}
+
+// find a small exact fraction for a serialized constant
+static int32_t qFromDouble(tScalarReg *r, double v)
+{
+  for (int64_t den = 1; den <= 4096; ++den) {
+    double scaled = v * (double)den;
+    double num = floor(scaled + 0.5);
+    if (fabs(num) > (double)INT32_MAX) return -1;
+    if (fabs(scaled - num) <= 1e-9 * (double)den) return qSet(r, (int64_t)num, den);
+  }
+  return -1;
+}
+
+// status of a qSet result
+static tStatus qStatus(int32_t ret)
+{
+  return ret == 0 ? T_SUCCESS : (ret > 0 ? SCALAR_OVERFLOW : T_ERR_FAIL);
+}
+
+static tStatus runFraction(const tScalarCode *pc, tScalarReg *regs)
+{
+  tScalarReg *d;
+  int64_t an, ad, bn, bd, rn, rd;
+  int32_t q;
+#if THINKER_SCALAR_THREADED
+  static const void *labels[] = {&&L_END, &&L_ADD, &&L_MUL, &&L_DIV, &&L_POW, &&L_FLOOR,
+                                 &&L_CEIL, &&L_SQRT, &&L_MIN, &&L_MAX, &&L_POWI, &&L_COPY};
+  SCALAR_DISPATCH();
   {
-  case ADD:
-    _SCALAR_BINARY_FUNC(_SCALAR_ADD, scalars, io_ids, input_num);
-    break;
-  case MUL:
-    _SCALAR_BINARY_FUNC(_SCALAR_MUL, scalars, io_ids, input_num);
-    break;
-  case DIV:
-    _SCALAR_BINARY_FUNC(_SCALAR_DIV, scalars, io_ids, input_num);
-    break;
-  case POW:
-    _SCALAR_BINARY_FUNC(pow, scalars, io_ids, input_num);
-    break;
-  case FLOOR:
-    _SCALAR_UNARY_FUNC(floor, scalars, io_ids, input_num);
-    break;
-  case CEIL:
-    _SCALAR_UNARY_FUNC(ceil, scalars, io_ids, input_num);
-    break;
-  case SQRT:
-    _SCALAR_UNARY_FUNC(sqrt, scalars, io_ids, input_num);
-    break;
-  case MIN:
-    _SCALAR_BINARY_FUNC(_SCALAR_MIN, scalars, io_ids, input_num);
-    break;
-  case MAX:
-    _SCALAR_BINARY_FUNC(_SCALAR_MAX, scalars, io_ids, input_num);
-    break;
+#else
+dispatch:
+  switch (pc->op_) {
+#endif
+  SCALAR_CASE(END)
+    return T_SUCCESS;
+  SCALAR_CASE(ADD)
+    d = regs + pc->dst_;
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    bn = regs[pc->b_].q_.num_; bd = regs[pc->b_].q_.den_;
+    if (ad == 1 && bd == 1) {
+      rn = an + bn;
+      if (rn > INT32_MAX || rn < INT32_MIN) return SCALAR_OVERFLOW;
+      d->q_.num_ = (int32_t)rn;
+      d->q_.den_ = 1;
+    } else if ((q = qSet(d, an * bd + bn * ad, ad * bd)) != 0) {
+      return qStatus(q);
+    }
+    SCALAR_NEXT();
+  SCALAR_CASE(MUL)
+    d = regs + pc->dst_;
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    bn = regs[pc->b_].q_.num_; bd = regs[pc->b_].q_.den_;
+    if (ad == 1 && bd == 1) {
+      rn = an * bn;
+      if (rn > INT32_MAX || rn < INT32_MIN) return SCALAR_OVERFLOW;
+      d->q_.num_ = (int32_t)rn;
+      d->q_.den_ = 1;
+    } else if ((q = qSet(d, an * bn, ad * bd)) != 0) {
+      return qStatus(q);
+    }
+    SCALAR_NEXT();
+  SCALAR_CASE(DIV)
+    d = regs + pc->dst_;
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    bn = regs[pc->b_].q_.num_; bd = regs[pc->b_].q_.den_;
+    if ((q = qSet(d, an * bd, ad * bn)) != 0) return qStatus(q);
+    SCALAR_NEXT();
+  SCALAR_CASE(POWI)
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    rn = 1;
+    rd = 1;
+    for (int32_t k = pc->b_ < 0 ? -pc->b_ : pc->b_; k > 0; --k) {
+      rn *= an;
+      rd *= ad;
+      if (rn > INT32_MAX || rn < INT32_MIN || rd > INT32_MAX) return SCALAR_OVERFLOW;
+    }
+    if (pc->b_ < 0) {
+      bn = rn;
+      rn = rd;
+      rd = bn;
+    }
+    if ((q = qSet(regs + pc->dst_, rn, rd)) != 0) return qStatus(q);
+    SCALAR_NEXT();
+  SCALAR_CASE(FLOOR)
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    rn = an / ad;
+    if (an % ad != 0 && an < 0) rn--;
+    regs[pc->dst_].q_.num_ = (int32_t)rn;
+    regs[pc->dst_].q_.den_ = 1;
+    SCALAR_NEXT();
+  SCALAR_CASE(CEIL)
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    rn = an / ad;
+    if (an % ad != 0 && an > 0) rn++;
+    regs[pc->dst_].q_.num_ = (int32_t)rn;
+    regs[pc->dst_].q_.den_ = 1;
+    SCALAR_NEXT();
+  SCALAR_CASE(MIN)
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    bn = regs[pc->b_].q_.num_; bd = regs[pc->b_].q_.den_;
+    regs[pc->dst_] = regs[an * bd <= bn * ad ? pc->a_ : pc->b_];
+    SCALAR_NEXT();
+  SCALAR_CASE(MAX)
+    an = regs[pc->a_].q_.num_; ad = regs[pc->a_].q_.den_;
+    bn = regs[pc->b_].q_.num_; bd = regs[pc->b_].q_.den_;
+    regs[pc->dst_] = regs[an * bd >= bn * ad ? pc->a_ : pc->b_];
+    SCALAR_NEXT();
+  SCALAR_CASE(COPY)
+    regs[pc->dst_] = regs[pc->a_];
+    SCALAR_NEXT();
+  SCALAR_CASE(POW)
+  SCALAR_CASE(SQRT)
+    return T_ERR_FAIL;  // never lowered in integer mode
+#if !THINKER_SCALAR_THREADED
   default:
-    assert(0);
-    break;
+    return T_ERR_FAIL;
+#endif
+  }
+}
+
+static tStatus runDouble(const tScalarCode *pc, tScalarReg *regs)
+{
+  double a, b;
+#if THINKER_SCALAR_THREADED
+  static const void *labels[] = {&&L_END, &&L_ADD, &&L_MUL, &&L_DIV, &&L_POW, &&L_FLOOR,
+                                 &&L_CEIL, &&L_SQRT, &&L_MIN, &&L_MAX, &&L_POWI, &&L_COPY};
+  SCALAR_DISPATCH();
+  {
+#else
+dispatch:
+  switch (pc->op_) {
+#endif
+  SCALAR_CASE(END)
+    return T_SUCCESS;
+  SCALAR_CASE(ADD)
+    regs[pc->dst_].f_ = regs[pc->a_].f_ + regs[pc->b_].f_;
+    SCALAR_NEXT();
+  SCALAR_CASE(MUL)
+    regs[pc->dst_].f_ = regs[pc->a_].f_ * regs[pc->b_].f_;
+    SCALAR_NEXT();
+  SCALAR_CASE(DIV)
+    regs[pc->dst_].f_ = regs[pc->a_].f_ / regs[pc->b_].f_;
+    SCALAR_NEXT();
+  SCALAR_CASE(POW)
+    regs[pc->dst_].f_ = pow(regs[pc->a_].f_, regs[pc->b_].f_);
+    SCALAR_NEXT();
+  SCALAR_CASE(POWI)
+    regs[pc->dst_].f_ = pow(regs[pc->a_].f_, (double)pc->b_);
+    SCALAR_NEXT();
+  SCALAR_CASE(FLOOR)
+    regs[pc->dst_].f_ = floor(regs[pc->a_].f_);
+    SCALAR_NEXT();
+  SCALAR_CASE(CEIL)
+    regs[pc->dst_].f_ = ceil(regs[pc->a_].f_);
+    SCALAR_NEXT();
+  SCALAR_CASE(SQRT)
+    regs[pc->dst_].f_ = sqrt(regs[pc->a_].f_);
+    SCALAR_NEXT();
+  SCALAR_CASE(MIN)
+    a = regs[pc->a_].f_;
+    b = regs[pc->b_].f_;
+    regs[pc->dst_].f_ = a < b ? a : b;
+    SCALAR_NEXT();
+  SCALAR_CASE(MAX)
+    a = regs[pc->a_].f_;
+    b = regs[pc->b_].f_;
+    regs[pc->dst_].f_ = a > b ? a : b;
+    SCALAR_NEXT();
+  SCALAR_CASE(COPY)
+    regs[pc->dst_] = regs[pc->a_];
+    SCALAR_NEXT();
+#if !THINKER_SCALAR_THREADED
+  default:
+    return T_ERR_FAIL;
+#endif
+  }
+}
+
+uint64_t tScalarProgramSize(uint32_t graph_size)
+{
+  // every instruction consumes at least one serialized node word
+  uint64_t size = ALIGN16((graph_size / sizeof(int32_t) + 1) * sizeof(tScalarCode));
+  // scratch: node offsets and scalar flags, both smaller than the graph
+  size += ALIGN16(2 * (uint64_t)graph_size);
+  return size;
+}
+
+// lower one node, returns number of instructions written or -1
+static int32_t emitNode(const tScalarProgram *program, tScalarCode *code, const int32_t *node,
+                        int32_t input_num, const tScalarReg *regs)
+{
+  int32_t op = node[0];
+  const int32_t *inputs = node + 1;
+  int32_t output = node[1 + input_num];
+  int32_t n = 0;
+  if (input_num < 1) return -1;
+  switch (op) {
+    case FLOOR:
+    case CEIL:
+    case SQRT:
+      if (input_num != 1) return -1;
+      code[n].op_ = op == FLOOR ? SCALAR_OP_FLOOR : (op == CEIL ? SCALAR_OP_CEIL : SCALAR_OP_SQRT);
+      code[n].dst_ = output;
+      code[n].a_ = inputs[0];
+      code[n].b_ = 0;
+      n++;
+      break;
+    case POW:
+      if (input_num != 2) return -1;
+      code[n].dst_ = output;
+      code[n].a_ = inputs[0];
+      if (program->is_int_) {
+        code[n].op_ = SCALAR_OP_POWI;
+        code[n].b_ = regs[inputs[1]].q_.num_;
+      } else {
+        code[n].op_ = SCALAR_OP_POW;
+        code[n].b_ = inputs[1];
+      }
+      n++;
+      break;
+    case ADD:
+    case MUL:
+    case DIV:
+    case MIN:
+    case MAX:
+      if (input_num == 1) {
+        code[n].op_ = SCALAR_OP_COPY;
+        code[n].dst_ = output;
+        code[n].a_ = inputs[0];
+        code[n].b_ = 0;
+        n++;
+        break;
+      }
+      // left fold, the first instruction never reads the destination
+      for (int32_t i = 1; i < input_num; ++i) {
+        code[n].op_ = op;
+        code[n].dst_ = output;
+        code[n].a_ = i == 1 ? inputs[0] : output;
+        code[n].b_ = inputs[i];
+        n++;
+      }
+      break;
+    default:
+      return -1;
+  }
+  return n;
+}
+
+tStatus tScalarProgramBuild(tScalarGraph *graph, uint32_t graph_size, tScalarProgram *program, char *ptr)
+{
+  program->is_int_ = 0;
+  program->num_code_ = 0;
+  program->num_regs_ = graph->num_scalars_;
+  program->code_ = (tScalarCode *)ptr;
+  program->code_[0].op_ = SCALAR_OP_END;
+  program->regs_ = (tScalarReg *)graph->scalars_;
+  if (graph->num_scalars_ == 0) return T_SUCCESS;
+
+  ptr += ALIGN16((graph_size / sizeof(int32_t) + 1) * sizeof(tScalarCode));
+  int32_t *node_offsets = (int32_t *)ptr;
+  uint8_t *flags = (uint8_t *)(node_offsets + graph->num_node_);
+  memset(flags, 0, graph->num_scalars_);
+
+  int32_t i, j, offset = 0;
+  for (i = 0; i < graph->num_node_; ++i) {
+    node_offsets[i] = offset;
+    flags[graph->nodes_[offset + graph->node_metas_[i] - 1]] |= SCALAR_PRODUCED;
+    offset += graph->node_metas_[i];
+  }
+  for (i = 0; i < graph->num_input_; ++i) flags[graph->inputs_[i]] |= SCALAR_INPUT;
+  for (i = 0; i < graph->num_output_; ++i) flags[graph->outputs_[i]] |= SCALAR_LIVE;
+  for (i = 0; i < graph->num_scalars_; ++i) {
+    if (!(flags[i] & (SCALAR_INPUT | SCALAR_PRODUCED))) flags[i] |= SCALAR_CONST;
+  }
+
+  // dead node elimination: walk backwards from the outputs
+  for (i = graph->num_node_ - 1; i >= 0; --i) {
+    const int32_t *node = graph->nodes_ + node_offsets[i];
+    int32_t input_num = graph->node_metas_[i] - 2;
+    if (!(flags[node[1 + input_num]] & SCALAR_LIVE)) continue;
+    for (j = 0; j < input_num; ++j) flags[node[1 + j]] |= SCALAR_LIVE;
+  }
+
+  // constant propagation, and integer mode unless a live node needs doubles
+  program->is_int_ = 1;
+  for (i = 0; i < graph->num_node_; ++i) {
+    const int32_t *node = graph->nodes_ + node_offsets[i];
+    int32_t input_num = graph->node_metas_[i] - 2;
+    int32_t output = node[1 + input_num];
+    if (!(flags[output] & SCALAR_LIVE)) continue;
+    int32_t is_const = 1;
+    for (j = 0; j < input_num; ++j) is_const &= (flags[node[1 + j]] & SCALAR_CONST) != 0;
+    if (is_const) flags[output] |= SCALAR_CONST;
+    if (node[0] == SQRT) program->is_int_ = 0;
+    if (node[0] == POW) {
+      // integer exponent must be a serialized constant
+      double e = input_num == 2 ? graph->scalars_[node[2]] : 0.5;
+      if ((flags[node[2]] & SCALAR_PRODUCED) || !(flags[node[2]] & SCALAR_CONST) ||
+          e != floor(e) || fabs(e) > SCALAR_POWI_MAX)
+        program->is_int_ = 0;
+    }
+  }
+
+  // every live serialized constant must be an exact fraction
+  for (i = 0; i < graph->num_scalars_ && program->is_int_; ++i) {
+    tScalarReg r;
+    if ((flags[i] & SCALAR_LIVE) && !(flags[i] & (SCALAR_INPUT | SCALAR_PRODUCED)) &&
+        qFromDouble(&r, graph->scalars_[i]) != 0)
+      program->is_int_ = 0;
+  }
+  if (program->is_int_) {
+    for (i = 0; i < graph->num_scalars_; ++i) {
+      double v = graph->scalars_[i];
+      program->regs_[i].q_.num_ = 0;
+      program->regs_[i].q_.den_ = 1;
+      if ((flags[i] & SCALAR_LIVE) && !(flags[i] & (SCALAR_INPUT | SCALAR_PRODUCED)))
+        qFromDouble(program->regs_ + i, v);
+    }
+  }
+
+  // emit live nodes, nodes of constants are evaluated now and dropped
+  tScalarCode *code = program->code_;
+  int32_t num_code = 0;
+  for (i = 0; i < graph->num_node_; ++i) {
+    const int32_t *node = graph->nodes_ + node_offsets[i];
+    int32_t input_num = graph->node_metas_[i] - 2;
+    int32_t output = node[1 + input_num];
+    if (!(flags[output] & SCALAR_LIVE)) continue;
+    int32_t n = emitNode(program, code + num_code, node, input_num, program->regs_);
+    if (n < 0) return T_ERR_FAIL;
+    if (flags[output] & SCALAR_CONST) {
+      code[num_code + n].op_ = SCALAR_OP_END;
+      tStatus ret = program->is_int_ ? runFraction(code + num_code, program->regs_)
+                                     : runDouble(code + num_code, program->regs_);
+      if (ret == SCALAR_OVERFLOW && program->is_int_) {
+        // a folded constant leaves int32, emit the whole program for doubles
+        for (j = 0; j < graph->num_scalars_; ++j)
+          program->regs_[j].f_ = (double)program->regs_[j].q_.num_ / program->regs_[j].q_.den_;
+        program->is_int_ = 0;
+        num_code = 0;
+        i = -1;
+        continue;
+      }
+      if (ret != T_SUCCESS) return ret;
+    } else {
+      num_code += n;
+    }
+  }
+  code[num_code].op_ = SCALAR_OP_END;
+  program->num_code_ = num_code;
+  return T_SUCCESS;
+}
+
+// Repeat an integer program with doubles after a value left int32. Registers
+// whose value is unchanged get their initial fraction back, which keeps the
+// constants exact for the next run; inputs and results are whole numbers
+// after rounding, as tScalarGetInt reads them.
+static tStatus runFallback(const tScalarProgram *program, tScalarReg *regs)
+{
+  int32_t i;
+  for (i = 0; i < program->num_regs_; ++i)
+    regs[i].f_ = (double)regs[i].q_.num_ / regs[i].q_.den_;
+  tStatus ret = runDouble(program->code_, regs);
+  for (i = 0; i < program->num_regs_; ++i) {
+    const tScalarReg *init = program->regs_ + i;
+    double v = regs[i].f_;
+    if (v == (double)init->q_.num_ / init->q_.den_) {
+      regs[i] = *init;
+      continue;
+    }
+    v = floor(v + 0.5);
+    regs[i].q_.num_ = v >= INT32_MAX ? INT32_MAX : (v > INT32_MIN ? (int32_t)v : INT32_MIN);
+    regs[i].q_.den_ = 1;
   }
   return ret;
-}
\ No newline at end of file
+}
+
+tStatus tScalarProgramRun(const tScalarProgram *program, tScalarReg *regs)
+{
+  if (program->is_int_) {
+    tStatus ret = runFraction(program->code_, regs);
+    return ret == SCALAR_OVERFLOW ? runFallback(program, regs) : ret;
+  }
+  return runDouble(program->code_, regs);
+}
+
+void tScalarSetInt(const tScalarProgram *program, tScalarReg *reg, int32_t value)
+{
+  if (program->is_int_) {
+    reg->q_.num_ = value;
+    reg->q_.den_ = 1;
+  } else {
+    reg->f_ = (double)value;
+  }
+}
+
+int32_t tScalarGetInt(const tScalarProgram *program, const tScalarReg *reg)
+{
+  if (program->is_int_) {
+    int64_t num = reg->q_.num_;
+    int64_t den = reg->q_.den_;
+    if (den == 1) return (int32_t)num;
+    int64_t twice = 2 * num + den;
+    int64_t q = twice / (2 * den);
+    if (twice % (2 * den) != 0 && twice < 0) q--;
+    return (int32_t)q;
+  }
+  return (int32_t)(reg->f_ + 0.5f);
+}
@@ -4,24 +4,18 @@
 #include <math.h>
 #include <assert.h>
 #include "thinker_api.h"
+#include "thinker_define.h"
 
+// Labels-as-values dispatch for the scalar program, a switch is used otherwise
+#ifndef THINKER_SCALAR_THREADED
+#if defined(__GNUC__) || defined(__clang__)
+#define THINKER_SCALAR_THREADED 1
+#else
+#define THINKER_SCALAR_THREADED 0
+#endif
+#endif
 
-#define _SCALAR_ADD(a, b) (a + b)
-#define _SCALAR_SUB(a, b) (a - b)
-#define _SCALAR_MUL(a, b) (a * b)
-#define _SCALAR_DIV(a, b) (a / b)
-#define _SCALAR_MIN(a, b) (a < b ? a : b)
-#define _SCALAR_MAX(a, b) (a > b ? a : b)
-
-#define _SCALAR_UNARY_FUNC(func, data, ids, input_num)                         \
-  CHECK_EQ(input_num, 1);                                                      \
-  data[ids[input_num]] = func(data[ids[0]]);
-
-#define _SCALAR_BINARY_FUNC(func, data, ids, input_num)                        \
-  data[ids[input_num]] = data[ids[0]];                    \
-  for(int i = 1; i < input_num; i++) \
-    data[ids[input_num]] = func(data[ids[input_num]],  data[ids[i]])
-
+// Operators of the serialized scalar graph
 typedef enum ScalarOpType {
   ADD   = 1,
   MUL   = 2,
@@ -34,7 +28,68 @@ typedef enum ScalarOpType {
   MAX   = 9,
 } ScalarOpType;
 
-int32_t ScalarFunc(double *scalars, const ScalarOpType *op_type,
-                   const int32_t *io_ids, int input_num);
+// Instructions of the lowered scalar program
+typedef enum ScalarOpCode {
+  SCALAR_OP_END   = 0,
+  SCALAR_OP_ADD   = 1,
+  SCALAR_OP_MUL   = 2,
+  SCALAR_OP_DIV   = 3,
+  SCALAR_OP_POW   = 4,
+  SCALAR_OP_FLOOR = 5,
+  SCALAR_OP_CEIL  = 6,
+  SCALAR_OP_SQRT  = 7,
+  SCALAR_OP_MIN   = 8,
+  SCALAR_OP_MAX   = 9,
+  SCALAR_OP_POWI  = 10,
+  SCALAR_OP_COPY  = 11,
+} tScalarOpCode;
+
+/**
+ * Calculate workspace size of a lowered scalar graph
+ * @param graph_size Size of the serialized scalar graph
+ * @return Size in bytes
+ */
+uint64_t tScalarProgramSize(uint32_t graph_size);
+
+/**
+ * Lower a scalar graph into a flat program
+ * Nodes not reaching an output are dropped and nodes depending only on
+ * constants are evaluated once. Integer mode is chosen unless the graph
+ * needs sqrt, a non-integer exponent or a constant that is not a fraction,
+ * or a folded constant does not fit an int32 fraction.
+ * The graph scalars are turned into the initial registers in place.
+ * @param graph Scalar graph
+ * @param graph_size Size of the serialized scalar graph
+ * @param program Program to build
+ * @param ptr Workspace of tScalarProgramSize bytes
+ * @return Status code
+ */
+tStatus tScalarProgramBuild(tScalarGraph *graph, uint32_t graph_size, tScalarProgram *program,
+                            char *ptr);
+
+/**
+ * Run a scalar program
+ * An integer program whose values leave int32 is repeated with doubles.
+ * @param program Lowered program
+ * @param regs Registers, a copy of program->regs_ with inputs set
+ * @return Status code
+ */
+tStatus tScalarProgramRun(const tScalarProgram *program, tScalarReg *regs);
+
+/**
+ * Write an integer into a register
+ * @param program Lowered program
+ * @param reg Register to write
+ * @param value Integer value
+ */
+void tScalarSetInt(const tScalarProgram *program, tScalarReg *reg, int32_t value);
+
+/**
+ * Read a register rounded to the nearest integer
+ * @param program Lowered program
+ * @param reg Register to read
+ * @return Integer value
+ */
+int32_t tScalarGetInt(const tScalarProgram *program, const tScalarReg *reg);
 
-#endif // __SOURCE_EXECUTOR_CORE_SCALAR_OP_H__
\ No newline at end of file
+#endif // __SOURCE_EXECUTOR_CORE_SCALAR_OP_H__
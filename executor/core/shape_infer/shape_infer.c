@@ -37,15 +37,22 @@ static tStatus tScalarGraphInit(const char *ptr, tScalarGraph *graph)
   return T_SUCCESS;
 }
 
+uint64_t tShapeInferSize(const tShapeInferHdr *shape_hdr)
+{
+  uint64_t total_size    = ALIGN16(sizeof(tScalarGraph));
+  total_size             += ALIGN16(shape_hdr->graph_size_);
+  total_size             += ALIGN16(shape_hdr->num_id_pair_ * sizeof(tTenDimPair));
+  total_size             += ALIGN16(shape_hdr->num_dy_axis_ * sizeof(tDyAxisInfo));
+  total_size             += tScalarProgramSize(shape_hdr->graph_size_);
+  return total_size;
+}
+
 tStatus tShapeInferInit(const char *res, tShapeInfer *shape_infer)
 {
   tStatus ret = T_SUCCESS;
   const tShapeInferHdr shape_hdr = *(tShapeInferHdr *)(res);
   // calculate workspace size
-  uint64_t total_size    = ALIGN16(sizeof(tScalarGraph));
-  total_size             += ALIGN16(shape_hdr.graph_size_);
-  total_size             += ALIGN16(shape_hdr.num_id_pair_ * sizeof(tTenDimPair));
-  total_size             += ALIGN16(shape_hdr.num_dy_axis_ * sizeof(tDyAxisInfo));
+  uint64_t total_size    = tShapeInferSize(&shape_hdr);
 
   // xMemory inst_memory = { total_size, 0, 0, 0};
 
@@ -71,6 +78,8 @@ tStatus tShapeInferInit(const char *res, tShapeInfer *shape_infer)
   shape_infer->num_dy_axis_  = shape_hdr.num_dy_axis_;
   memcpy(ptr, res+shape_hdr.dy_axis_offset_, shape_hdr.num_dy_axis_*sizeof(tDyAxisInfo));
   ptr += ALIGN16(shape_hdr.num_dy_axis_ * sizeof(tDyAxisInfo));
+  // lower scalar graph into a flat program
+  ret = tScalarProgramBuild(shape_infer->graph_, shape_hdr.graph_size_, &shape_infer->program_, ptr);
   return ret;
 }
 
@@ -79,35 +88,11 @@ tStatus tShapeInferFini(tShapeInfer *shape_infer)
   return T_SUCCESS;
 }
 
-static tStatus tScalarGraphForward(tScalarGraph *graph, double *scalars)
-{
-  // scalar graph inference
-  int32_t      ret = 0;
-  int32_t      *op_ptr = graph->nodes_;
-  ScalarOpType *op_type = NULL;
-  int32_t      *input_ids = NULL;
-  int32_t      *output_ids = NULL;
-  int32_t      node_io_ids[8];
-  int          input_num = 0;
-  for (int i = 0, cnt = 0; i < graph->num_node_; ++i) {
-    input_num = graph->node_metas_[i] - 2;
-    CHECK_LE(input_num, 8);
-    op_type    = (ScalarOpType *)(op_ptr++);
-    input_ids  = (int32_t *)op_ptr;
-    op_ptr     += input_num;
-    output_ids = (int32_t *)(op_ptr++);
-    for (int index = 0; index < input_num; ++index)
-      node_io_ids[index] = input_ids[index];
-    node_io_ids[input_num] = output_ids[0];
-    ret = ScalarFunc(scalars, op_type, node_io_ids, input_num);
-    if (ret != 0) return T_ERR_FAIL;
-  }
-  return T_SUCCESS;
-}
-
-tStatus tSetShapeInferInputByTensors(tShapeInfer *shape_infer, double *scalars, tTensor *tensors)
+tStatus tSetShapeInferInputByTensors(tShapeInfer *shape_infer, tScalarReg *scalars, tTensor *tensors)
 {
   tScalarGraph *graph = shape_infer->graph_;
+  // a static model carries an empty graph whose header is not meaningful
+  if (graph->num_scalars_ == 0) return T_SUCCESS;
   CHECK_LE(graph->num_input_, 8);
   uint8_t set_flag[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   // check all inputs axis size are same on the corresponding dynamic axis.
@@ -115,23 +100,23 @@ tStatus tSetShapeInferInputByTensors(tShapeInfer *shape_infer, double *scalars,
   {
     tDyAxisInfo dy_info    = shape_infer->dynamic_axis_[i];
     tTensor     *tensor    = &tensors[dy_info.tensor_id_];
-    double    size       = (double)tensor->shape_.dims_[dy_info.dy_dim_id_];
+    int32_t     size       = (int32_t)tensor->shape_.dims_[dy_info.dy_dim_id_];
     uint8_t     input_id   = dy_info.scalar_input_id_;
     uint32_t    scalar_id  = graph->inputs_[input_id];
     if (set_flag[input_id] == 1)
     {
-      if (scalars[scalar_id] != size) return T_ERR_INVALID_DATA;
+      if (tScalarGetInt(&shape_infer->program_, &scalars[scalar_id]) != size) return T_ERR_INVALID_DATA;
     }
     else
     {
-      scalars[scalar_id] = size;
+      tScalarSetInt(&shape_infer->program_, &scalars[scalar_id], size);
       set_flag[input_id] = 1;
     }
   }
   return T_SUCCESS;
 }
 
-tStatus tSetShapeInferInputByNames(tShapeInfer *shape_infer, double *scalars, 
+tStatus tSetShapeInferInputByNames(tShapeInfer *shape_infer, tScalarReg *scalars, 
                                    const char **axis_names, const uint32_t *axis_sizes, int num)
 {
   tScalarGraph *graph = shape_infer->graph_;
@@ -147,7 +132,7 @@ tStatus tSetShapeInferInputByNames(tShapeInfer *shape_infer, double *scalars,
       if (strcmp(axis_names[i], name) == 0)
       {
         match_flag = 1;
-        scalars[graph->inputs_[j]] = (double)axis_sizes[i];
+        tScalarSetInt(&shape_infer->program_, &scalars[graph->inputs_[j]], (int32_t)axis_sizes[i]);
       }
       name += shape_infer->graph_->name_max_len;
     }
@@ -156,18 +141,104 @@ tStatus tSetShapeInferInputByNames(tShapeInfer *shape_infer, double *scalars,
   return T_SUCCESS;
 }
 
-tStatus tShapeInferForward(tShapeInfer *shape_infer, double *scalars, tTensor *tensors)
+tStatus tShapeInferForward(tShapeInfer *shape_infer, tScalarReg *scalars, tTensor *tensors)
 {
   tScalarGraph *graph = shape_infer->graph_;
-  tStatus ret = tScalarGraphForward(graph, scalars);
+  tStatus ret = tScalarProgramRun(&shape_infer->program_, scalars);
   if (ret != T_SUCCESS) return ret;
   // assign scalar graph outputs to tensors shape by tTenDimPair.
   CHECK_EQ(shape_infer->num_id_pair_, graph->num_output_);
   for (int i = 0; i < shape_infer->num_id_pair_; ++i)
   {
-    uint32_t size = (uint32_t)(scalars[graph->outputs_[i]] + 0.5f);
+    uint32_t size = (uint32_t)tScalarGetInt(&shape_infer->program_, &scalars[graph->outputs_[i]]);
     tTenDimPair pair = shape_infer->tid_pairs_[i];
     tensors[pair.tensor_id_].shape_.dims_[pair.dim_id_] = size;
   }
   return T_SUCCESS;
-}
\ No newline at end of file
+}
+
+int32_t tShapeCacheSize(int32_t num_input, int32_t num_id_pair)
+{
+  int32_t size = 0;
+  size += ALIGN16(THINKER_SHAPE_CACHE_SIZE * num_input * (int32_t)sizeof(tScalarReg));
+  size += ALIGN16(THINKER_SHAPE_CACHE_SIZE * num_id_pair * (int32_t)sizeof(uint32_t));
+  return size;
+}
+
+void tShapeCacheInit(tShapeCache *cache, char *ptr, int32_t num_input, int32_t num_id_pair)
+{
+  cache->num_key_   = num_input;
+  cache->num_dim_   = num_id_pair;
+  cache->num_entry_ = 0;
+  cache->next_      = 0;
+  cache->last_      = -1;
+  cache->stamp_     = 0;
+  cache->keys_      = (tScalarReg *)ptr;
+  ptr += ALIGN16(THINKER_SHAPE_CACHE_SIZE * num_input * sizeof(tScalarReg));
+  cache->dims_      = (uint32_t *)ptr;
+}
+
+static int32_t tShapeCacheFind(const tShapeCache *cache, const tScalarReg *key)
+{
+  // check the applied entry first, it is the common case when streaming
+  if (cache->last_ >= 0 &&
+      memcmp(cache->keys_ + cache->last_ * cache->num_key_, key, cache->num_key_ * sizeof(tScalarReg)) == 0)
+    return cache->last_;
+  for (int i = 0; i < cache->num_entry_; ++i)
+  {
+    if (memcmp(cache->keys_ + i * cache->num_key_, key, cache->num_key_ * sizeof(tScalarReg)) == 0)
+      return i;
+  }
+  return -1;
+}
+
+tStatus tShapeInferForwardCached(tShapeInfer *shape_infer, tShapeCache *cache, tScalarReg *scalars, tTensor *tensors)
+{
+  tScalarGraph *graph = shape_infer->graph_;
+  if (graph->num_scalars_ == 0)
+    return tShapeInferForward(shape_infer, scalars, tensors);
+  if (graph->num_input_ > 8)
+  {
+    cache->stamp_++;
+    return tShapeInferForward(shape_infer, scalars, tensors);
+  }
+
+  tScalarReg key[8];
+  for (int i = 0; i < graph->num_input_; ++i)
+    key[i] = scalars[graph->inputs_[i]];
+
+  int32_t entry = tShapeCacheFind(cache, key);
+  if (entry >= 0 && entry == cache->last_)
+    return T_SUCCESS;  // tensors already carry these dims
+
+  if (entry >= 0)
+  {
+    const uint32_t *dims = cache->dims_ + entry * cache->num_dim_;
+    for (int i = 0; i < shape_infer->num_id_pair_; ++i)
+    {
+      tTenDimPair pair = shape_infer->tid_pairs_[i];
+      tensors[pair.tensor_id_].shape_.dims_[pair.dim_id_] = dims[i];
+    }
+    cache->last_ = entry;
+    cache->stamp_++;
+    return T_SUCCESS;
+  }
+
+  cache->last_ = -1;
+  cache->stamp_++;
+  tStatus ret = tShapeInferForward(shape_infer, scalars, tensors);
+  if (ret != T_SUCCESS) return ret;
+
+  entry = cache->next_;
+  cache->next_ = (cache->next_ + 1) % THINKER_SHAPE_CACHE_SIZE;
+  if (cache->num_entry_ < THINKER_SHAPE_CACHE_SIZE) cache->num_entry_++;
+  memcpy(cache->keys_ + entry * cache->num_key_, key, cache->num_key_ * sizeof(tScalarReg));
+  uint32_t *dims = cache->dims_ + entry * cache->num_dim_;
+  for (int i = 0; i < shape_infer->num_id_pair_; ++i)
+  {
+    tTenDimPair pair = shape_infer->tid_pairs_[i];
+    dims[i] = tensors[pair.tensor_id_].shape_.dims_[pair.dim_id_];
+  }
+  cache->last_ = entry;
+  return T_SUCCESS;
+}
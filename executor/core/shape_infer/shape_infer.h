@@ -9,11 +9,20 @@
 extern "C" {
 #endif
 
+// Number of dynamic axis tuples remembered by each executor
+#ifndef THINKER_SHAPE_CACHE_SIZE
+#define THINKER_SHAPE_CACHE_SIZE 4
+#endif
+
+uint64_t tShapeInferSize(const tShapeInferHdr *shape_hdr);
 tStatus tShapeInferInit(const char *res, tShapeInfer *shape_infer);
 tStatus tShapeInferFini(tShapeInfer *shape_infer);
-tStatus tSetShapeInferInputByTensors(tShapeInfer *shape_infer, double *scalars, tTensor *tensors);
-tStatus tSetShapeInferInputByNames(tShapeInfer *shape_infer, double *scalars, const char **axis_names, const uint32_t *axis_sizes, int num);
-tStatus tShapeInferForward(tShapeInfer *shape_infer, double *scalars, tTensor *tensors);
+tStatus tSetShapeInferInputByTensors(tShapeInfer *shape_infer, tScalarReg *scalars, tTensor *tensors);
+tStatus tSetShapeInferInputByNames(tShapeInfer *shape_infer, tScalarReg *scalars, const char **axis_names, const uint32_t *axis_sizes, int num);
+tStatus tShapeInferForward(tShapeInfer *shape_infer, tScalarReg *scalars, tTensor *tensors);
+int32_t tShapeCacheSize(int32_t num_input, int32_t num_id_pair);
+void    tShapeCacheInit(tShapeCache *cache, char *ptr, int32_t num_input, int32_t num_id_pair);
+tStatus tShapeInferForwardCached(tShapeInfer *shape_infer, tShapeCache *cache, tScalarReg *scalars, tTensor *tensors);
 
 #if defined(__cplusplus)
 }
@@ -72,6 +72,35 @@ THINKER_API(tStatus, tModelInit,
             (tModelHandle * model, const int8_t *res, const uint64_t size,
              const tMemory *memory, int32_t num_memory));
 
+/**
+ * Get memory plan for a model loaded by tModelInitMapped
+ * The model memory leaves out the tables referenced in the resource, the
+ * resource CRC is only verified when built with THINKER_MAPPED_CRC
+ * @param memory: Memory allocation array
+ * @param num_memory: Number of memory entries
+ * @param res: Mapped resource data pointer
+ * @param size: Resource size
+ * @return: Status code
+ */
+THINKER_API(tStatus, tGetMemoryPlanMapped,
+            (tMemory * memory, int32_t *num_memory, const int8_t *res,
+             const uint64_t size));
+
+/**
+ * Initialize model from a memory-mapped resource without copying it
+ * The resource must stay mapped until tModelFini, read-only tables and
+ * parameters are referenced in place
+ * @param model: Model handle pointer
+ * @param res: Mapped resource data pointer
+ * @param size: Resource size
+ * @param memory: Memory allocation array from tGetMemoryPlanMapped or tGetMemoryPlan
+ * @param num_memory: Number of memory entries
+ * @return: Status code
+ */
+THINKER_API(tStatus, tModelInitMapped,
+            (tModelHandle * model, const int8_t *res, const uint64_t size,
+             const tMemory *memory, int32_t num_memory));
+
 /**
  * Finalize model
  * @param model: Model handle
@@ -178,6 +207,8 @@ THINKER_API(tStatus, tReleaseExecutor, (tExecHandle hdl));
 
 /**
  * Set input tensor by index
+ * State inputs of pairs packed with tpacker --states are carried over by
+ * tForward and rejected with T_ERR_INVALID_PARA, see tResetState.
  * @param hdl: Executor handle
  * @param idx: Input index
  * @param input: Input data
@@ -216,6 +247,43 @@ THINKER_API(tStatus, tGetOutput,
 THINKER_API(tStatus, tGetOutputByName,
             (const tExecHandle hdl, const char *name, tData *input));
 
+/**
+ * Bind caller buffer to input tensor without copying
+ * The buffer is used for the executor lifetime, must be 16 bytes aligned and
+ * hold the largest input shape. Inputs planned in share memory are copied
+ * from the buffer at the start of tForward instead. Other inputs are
+ * rejected with T_ERR_INVALID_PARA when the memory plan shares their buffer
+ * in place with another tensor or belong to a state pair, and buffers
+ * overlapping another binding with T_ERR_INVALID_DATA.
+ * @param hdl: Executor handle
+ * @param idx: Input index
+ * @param input: Caller buffer, NULL dptr_ to unbind
+ * @return: Status code
+ */
+THINKER_API(tStatus, tBindInput,
+            (const tExecHandle hdl, const int32_t idx, const tData *input));
+
+/**
+ * Bind caller buffer to output tensor without copying
+ * Same requirements as tBindInput. Outputs planned in share memory are
+ * copied to the buffer at the end of tForward instead.
+ * @param hdl: Executor handle
+ * @param idx: Output index
+ * @param output: Caller buffer, NULL dptr_ to unbind
+ * @return: Status code
+ */
+THINKER_API(tStatus, tBindOutput,
+            (const tExecHandle hdl, const int32_t idx, const tData *output));
+
+/**
+ * Reset recurrent states to zero
+ * State pairs packed by tpacker are carried between tForward calls by
+ * swapping the state input and output buffers, this starts a new stream.
+ * @param hdl: Executor handle
+ * @return: Status code
+ */
+THINKER_API(tStatus, tResetState, (tExecHandle hdl));
+
 /**
  * Execute forward pass
  * @param hdl: Executor handle
@@ -223,6 +291,54 @@ THINKER_API(tStatus, tGetOutputByName,
  */
 THINKER_API(tStatus, tForward, (const tExecHandle hdl));
 
+/**
+ * Completion callback of tForwardAsync
+ * @param hdl: Executor handle
+ * @param status: Status code returned by the forward pass
+ * @param user: User data passed to tForwardAsync
+ */
+typedef void (*tForwardCallback)(tExecHandle hdl, tStatus status, void *user);
+
+/**
+ * Execute forward pass on a worker thread (Linux only)
+ * Returns immediately, callback is called on the worker thread before
+ * tWait returns on other threads. The executor is idle while the callback
+ * runs, so the callback may read outputs, call tWait or start the next
+ * tForwardAsync. Only one forward can be in flight per executor; use
+ * tExecutorStop to cancel it.
+ * @param hdl: Executor handle
+ * @param callback: Completion callback, may be NULL
+ * @param user: User data passed to callback
+ * @return: Status code, T_ERR_EXEC_BUSY if a forward is in flight
+ */
+THINKER_API(tStatus, tForwardAsync,
+            (const tExecHandle hdl, tForwardCallback callback, void *user));
+
+/**
+ * Wait for the forward pass started by tForwardAsync
+ * @param hdl: Executor handle
+ * @return: Status code of the finished forward pass
+ */
+THINKER_API(tStatus, tWait, (const tExecHandle hdl));
+
+/**
+ * Execute forward pass for a batch of input sets
+ * Samples run in groups of up to THINKER_BATCH_MAX (build option, default 1,
+ * each extra sample costs a runtime memory copy); each operator runs for
+ * every sample of a group before the next one, so weights prefetched through
+ * DMA are fetched once per group. Models with recurrent states run sample by
+ * sample and ignore the entries of state inputs. Io bindings are ignored
+ * during the call.
+ * @param hdl: Executor handle
+ * @param inputs: num_batch * input count entries, inputs of sample s start at s * input count
+ * @param outputs: num_batch * output count caller buffers, filled like tGetOutput
+ * @param num_batch: Number of samples
+ * @return: Status code
+ */
+THINKER_API(tStatus, tForwardBatch,
+            (const tExecHandle hdl, const tData *inputs, tData *outputs,
+             const int32_t num_batch));
+
 /**
  * Update dynamic shapes
  * @param hdl: Executor handle
@@ -233,6 +349,62 @@ THINKER_API(tStatus, tForward, (const tExecHandle hdl));
  */
 THINKER_API(tStatus, tUpdateShape, (tExecHandle hdl, const char **axis_names, const uint32_t *axis_sizes, int32_t num));
 
+/**
+ * Get peak usage of a runtime memory, tUpdateShape re-plans it when
+ * THINKER_MEMORY_REPLAN is enabled
+ * @param hdl: Executor handle
+ * @param dev_type: Device type of the runtime memory
+ * @param peak: Peak usage in bytes
+ * @return: Status code
+ */
+THINKER_API(tStatus, tGetMemoryPeak, (const tExecHandle hdl, const int32_t dev_type, uint64_t *peak));
+
+/**
+ * Get the most recent operator records, oldest first, requires THINKER_PROFILE
+ * @param hdl: Executor handle
+ * @param records: Record buffer
+ * @param num: Capacity of records on input, number of records on output
+ * @return: Status code
+ */
+THINKER_API(tStatus, tGetProfile, (const tExecHandle hdl, tProfileRecord *records, int32_t *num));
+
+/**
+ * Drop all operator records and DMA counters, requires THINKER_PROFILE
+ * @param hdl: Executor handle
+ * @return: Status code
+ */
+THINKER_API(tStatus, tResetProfile, (const tExecHandle hdl));
+
+/**
+ * Get the counters of the weight prefetch DMA entries and the overlap
+ * efficiency of the model, requires THINKER_PROFILE
+ * @param hdl: Executor handle
+ * @param records: Record buffer, one record per DMA entry
+ * @param num: Capacity of records on input, number of records on output
+ * @param overlap: Share of the transfer time hidden behind compute, 0 to 1
+ * @return: Status code
+ */
+THINKER_API(tStatus, tGetDMAProfile, (const tExecHandle hdl, tDMARecord *records, int32_t *num, float *overlap));
+
+/**
+ * Get the runtime counters of the executor: forwards, operator calls, bytes
+ * read and written by memory type, input/output copies, operator copies and
+ * DMA transfers, compiled out with THINKER_STATS=0
+ * @param hdl: Executor handle
+ * @param stats: Counters since creation or tResetStats
+ * @param op_counts: Invocations of each operator, may be NULL
+ * @param num: Capacity of op_counts on input, number of operators on output
+ * @return: Status code
+ */
+THINKER_API(tStatus, tGetStats, (const tExecHandle hdl, tStats *stats, uint32_t *op_counts, int32_t *num));
+
+/**
+ * Zero the runtime counters of the executor
+ * @param hdl: Executor handle
+ * @return: Status code
+ */
+THINKER_API(tStatus, tResetStats, (const tExecHandle hdl));
+
 /**
  * Start executor
  * @param hdl: Executor handle
@@ -327,6 +499,21 @@ typedef struct _thinkerApi {
     Proc_tGetListResult tGetListResult;
 #endif
 
+    Proc_tBindInput tBindInput;
+    Proc_tBindOutput tBindOutput;
+    Proc_tResetState tResetState;
+    Proc_tForwardAsync tForwardAsync;
+    Proc_tWait tWait;
+    Proc_tForwardBatch tForwardBatch;
+    Proc_tModelInitMapped tModelInitMapped;
+    Proc_tGetMemoryPeak tGetMemoryPeak;
+    Proc_tGetProfile tGetProfile;
+    Proc_tResetProfile tResetProfile;
+    Proc_tGetDMAProfile tGetDMAProfile;
+    Proc_tGetStats tGetStats;
+    Proc_tResetStats tResetStats;
+    Proc_tGetMemoryPlanMapped tGetMemoryPlanMapped;
+
     void * reserve[3];  // aligned 4*sizeof(pointer)
 } thinkerApi;
 
@@ -14,10 +14,12 @@ typedef enum _thinker_StatusCode_ {
     T_ERR_RES_MISSING = 20000,   // Resource missing error
     T_ERR_RES_INCOMPLETE = 20001, // Resource incomplete error
     T_ERR_RES_CRC_CHECK = 20002,  // Resource CRC check failed
+    T_ERR_RES_DMA_LIST = 20003,   // DMA table exceeds the executor limits or is misordered
     
     T_ERR_INVALID_PARA = 30000,   // Invalid parameter error
     T_ERR_INVALID_INST = 30001,   // Invalid instruction error
     T_ERR_INVALID_DATA = 30002,   // Invalid data error
+    T_ERR_EXEC_BUSY = 30003,      // Executor is running an asynchronous forward
     
     T_ERR_NO_IMPLEMENTED = 40000, // Not implemented error
     T_ERR_INDEX_OF_BOUND = 40001, // Index out of bounds error
@@ -104,6 +104,56 @@ typedef struct _thinker_Memory_ {
     addr_type dptr_;    // Memory address
 } tMemory;
 
+/**
+ * Profile record of one operator execution, ticks are microseconds on
+ * Windows/Linux and CPU cycles on embedded systems
+ */
+typedef struct _thinker_ProfileRecord_ {
+    uint64_t start_;        // Tick when the operator started
+    uint64_t end_;          // Tick when the operator finished
+    uint64_t dma_wait_;     // Ticks spent waiting for weight DMA
+    uint64_t bytes_in_;     // Bytes of input tensors
+    uint64_t bytes_out_;    // Bytes of output tensors
+    const char *name_;      // Operator type name
+    const char *tensor_name_; // Debug name of the first output tensor, NULL if not packed
+    uint32_t forward_;      // Forward count since tResetProfile
+    int32_t tensor_id_;     // First output tensor, indexes the debug tensor names
+    uint16_t op_index_;     // Operator index in the model
+} tProfileRecord;
+
+/**
+ * Counters of one weight prefetch DMA entry, the completion is seen when
+ * an operator waits on the channel so busy_ is an upper bound of the transfer
+ */
+typedef struct _thinker_DMARecord_ {
+    uint64_t bytes_;        // Bytes transferred
+    uint64_t issue_;        // Tick of the last issue
+    uint64_t done_;         // Tick the last transfer was seen complete, 0 while in flight
+    uint64_t busy_;         // Ticks from issue to seen complete, summed over transfers
+    uint64_t wait_;         // Ticks operators stalled on the entry
+    uint32_t count_;        // Transfers issued
+    int32_t tensor_id_;     // Destination tensor
+} tDMARecord;
+
+/**
+ * Runtime counters of one executor, bytes of operator tensors are taken
+ * from their shapes and split by the memory type of the tensor
+ */
+typedef struct _thinker_Stats_ {
+    uint64_t forward_;          // Forward passes, every sample of tForwardBatch counts
+    uint64_t op_count_;         // Operator invocations
+    uint64_t bytes_read_;       // Bytes of operator inputs
+    uint64_t bytes_written_;    // Bytes of operator outputs
+    uint64_t mem_read_[3];      // Bytes of operator inputs in FLASH, PSRAM and SHARE_MEM
+    uint64_t mem_written_[3];   // Bytes of operator outputs in FLASH, PSRAM and SHARE_MEM
+    uint64_t io_count_;         // Copies of input and output data in and out of the executor
+    uint64_t io_bytes_;         // Bytes of those copies
+    uint64_t memcpy_count_;     // Synchronous copies made by operators and batch samples
+    uint64_t memcpy_bytes_;     // Bytes of those copies
+    uint64_t dma_count_;        // Weight and activation DMA transfers started
+    uint64_t dma_bytes_;        // Bytes of those transfers
+} tStats;
+
 /**
  * Memory list structure
  */
@@ -151,9 +201,13 @@ typedef struct _t_Tensor_ {
         addr_type offset_; // Offset
     };
     uint8_t layout_;    // Layout information
-    uint32_t reserved;  // Reserved field
+    uint32_t life_;     // Liveness: bit31 valid, bits 16-30 last op, bits 0-15 first op
 } tTensor;
 
+#define TENSOR_LIFE_VALID 0x80000000u
+#define TENSOR_LIFE_BEGIN(life) ((life) & 0xFFFF)
+#define TENSOR_LIFE_END(life) (((life) >> 16) & 0x7FFF)
+
 /**
  * Tensor list structure
  */
@@ -295,7 +349,7 @@ typedef struct _t_DMA_ {
     tDevice dst_device_;    // Destination device
     uint16_t src_tensor_id_; // Source tensor ID
     uint16_t dst_tensor_id_; // Destination tensor ID
-    uint64_t size_;         // Transfer size
+    uint64_t size_;         // Transfer size, 0 if served by the burst of the previous entry
 } tDMA;
 
 /**
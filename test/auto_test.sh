@@ -32,6 +32,10 @@ download_onnx_thinker_models "test_logsoftmax" "logsoftmaxint.onnx" "input.bin"
 download_onnx_thinker_models "test_iqsigmoid" "iqsigmoid.onnx" "input.bin" "output.bin"
 download_onnx_thinker_models "test_layernorm" "layernorm_int.onnx" "input.bin" "output.bin"
 download_onnx_thinker_models "test_shufflechannel" "shuffle_net_10_09.onnx" "input.bin" "output.bin"
+mkdir -p $test_dir/test_state
+python test/gen_state_model.py $test_dir/test_state/state.onnx
+mkdir -p $test_dir/test_replan
+python test/gen_replan_model.py $test_dir/test_replan/replan.onnx
 popd
 
 ###################### compile thinker.so ######################
@@ -46,6 +50,7 @@ cmake -DCMAKE_BUILD_TYPE="Release"  \
     -DTHINKER_SHARED_LIB=ON         \
     -DTHINKER_PROFILE=OFF           \
     -DTHINKER_DUMP=OFF              \
+    -DTHINKER_MEMORY_REPLAN=ON      \
     ..
 make -j4
 popd
@@ -60,6 +65,7 @@ popd
 ###################### compile test.cpp ######################
 pushd ./
 tpacker -g $test_dir/test_conv2d/net.onnx -s Remove_QuantDequant -o $test_dir/test_conv2d/model.bin
+tpacker -g $test_dir/test_conv2d/net.onnx -s Remove_QuantDequant --threshold4 0 -o $test_dir/test_conv2d/model_psram.bin
 tpacker -g $test_dir/test_conv1d/conv1d.onnx -s Remove_QuantDequant -o $test_dir/test_conv1d/model.bin
 tpacker -g $test_dir/test_batchnorm/batchnormInt.onnx -s Remove_QuantDequant -o $test_dir/test_batchnorm/model.bin
 tpacker -g $test_dir/test_softmaxint/softmaxint.onnx -s Remove_QuantDequant -o $test_dir/test_softmaxint/model.bin
@@ -68,6 +74,8 @@ tpacker -g $test_dir/test_iqsigmoid/iqsigmoid.onnx -s Remove_QuantDequant -o $te
 tpacker -g $test_dir/test_layernorm/layernorm_int.onnx -s Remove_QuantDequant -o $test_dir/test_layernorm/model.bin
 tpacker -g $test_dir/test_shufflechannel/shuffle_net_10_09.onnx -s Remove_QuantDequant -o $test_dir/test_shufflechannel/model.bin
 tpacker -g $test_dir/test_gru/gru_int.onnx -s Remove_QuantDequant -o $test_dir/test_gru/model.bin
+tpacker -g $test_dir/test_state/state.onnx --states h_in:h_out -o $test_dir/test_state/model.bin
+tpacker -g $test_dir/test_replan/replan.onnx -c T=1:16:1 -o $test_dir/test_replan/model.bin
 
 cd test/linux_x86   && rm -rf build && rm -rf bin && mkdir -p build && cd build && cmake  -DCMAKE_BUILD_TYPE="Release" ../
 make
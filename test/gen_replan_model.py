@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Build the dynamic model used by the [replan] tests of test_x86:
+# c = x ++ x is aliased by two in-place Unsqueeze siblings read at different
+# ops, so tpacker gives the aliases different lives, y = x repeated 10 times.
+# The trailing full Slice only gives the resource a parameter section.
+# Pack it with: tpacker -g replan.onnx -c T=1:16:1
+
+import sys
+from onnx import helper, TensorProto, save
+
+
+def make_cat(inputs, output, axis, platform):
+    scales = {"scale_x_%d" % i: 1.0 for i in range(len(inputs))}
+    return helper.make_node("iqCat", inputs, [output], domain="thinker", axis=axis,
+                            scale_o=1.0, platform_quant="luna_quant", platform=platform,
+                            **scales)
+
+
+def make_replan_model(platform: str = "venus"):
+    x = helper.make_tensor_value_info("x", TensorProto.INT8, [1, "T"])
+    y = helper.make_tensor_value_info("y", TensorProto.INT8, [1, 1, "10*T"])
+    starts = helper.make_tensor("starts", TensorProto.INT64, [1], [0])
+    ends = helper.make_tensor("ends", TensorProto.INT64, [1], [2**31 - 1])
+    axes = helper.make_tensor("axes", TensorProto.INT64, [1], [2])
+    nodes = [
+        make_cat(["x", "x"], "c", 1, platform),
+        helper.make_node("Unsqueeze", ["c"], ["u1"], axes=[0]),
+        helper.make_node("Unsqueeze", ["c"], ["u2"], axes=[0]),
+        make_cat(["u1", "u1"], "a", 2, platform),
+        make_cat(["a", "a"], "b", 2, platform),
+        make_cat(["b", "u2"], "z", 2, platform),
+        helper.make_node("Slice", ["z", "starts", "ends", "axes"], ["y"]),
+    ]
+    graph = helper.make_graph(nodes, "replan", [x], [y], [starts, ends, axes])
+    model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 12),
+                                                    helper.make_opsetid("thinker", 1)])
+    model.ir_version = 7
+    return model
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("usage: gen_replan_model.py output.onnx [platform]")
+        sys.exit(1)
+    save(make_replan_model(sys.argv[2] if len(sys.argv) > 2 else "venus"), sys.argv[1])
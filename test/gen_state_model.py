@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Build the stateful model used by the [states] tests of test_x86:
+# h_out = (h_in ++ x)[4:12], so each forward shifts x into the state.
+# Pack it with: tpacker -g state.onnx --states h_in:h_out
+
+import sys
+from onnx import helper, TensorProto, save
+
+
+def make_state_model(platform: str = "venus"):
+    x = helper.make_tensor_value_info("x", TensorProto.INT8, [1, 4])
+    h_in = helper.make_tensor_value_info("h_in", TensorProto.INT8, [1, 8])
+    h_out = helper.make_tensor_value_info("h_out", TensorProto.INT8, [1, 8])
+    starts = helper.make_tensor("starts", TensorProto.INT64, [1], [4])
+    ends = helper.make_tensor("ends", TensorProto.INT64, [1], [12])
+    axes = helper.make_tensor("axes", TensorProto.INT64, [1], [1])
+    cat = helper.make_node("iqCat", ["h_in", "x"], ["cat"], domain="thinker", axis=1,
+                           scale_x_0=1.0, scale_x_1=1.0, scale_o=1.0,
+                           platform_quant="luna_quant", platform=platform)
+    shift = helper.make_node("Slice", ["cat", "starts", "ends", "axes"], ["h_out"])
+    graph = helper.make_graph([cat, shift], "state", [x, h_in], [h_out], [starts, ends, axes])
+    model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 12),
+                                                    helper.make_opsetid("thinker", 1)])
+    model.ir_version = 7
+    return model
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("usage: gen_state_model.py output.onnx [platform]")
+        sys.exit(1)
+    save(make_state_model(sys.argv[2] if len(sys.argv) > 2 else "venus"), sys.argv[1])
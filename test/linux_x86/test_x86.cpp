@@ -1127,3 +1127,548 @@ TEST_CASE("test_gru","[interface]")
     }
 }
 
+TEST_CASE("test_bind_input","[bind]")
+{
+    SECTION("bound input and output in psram")
+    {
+        #define PSRAM_SIZE  (2*1024*1024)
+        #define SHARE_SIZE  (640*1024)
+
+        static int8_t g_psram_buf[PSRAM_SIZE];
+        static int8_t g_share_buf[SHARE_SIZE];
+
+        int32_t use_psram_size = 0;
+        int32_t use_share_size = 0;
+
+        memset(g_psram_buf, 0, PSRAM_SIZE);
+        memset(g_share_buf, 0, SHARE_SIZE);
+
+        // packed with --threshold4 0, every activation lives in psram and is bound in place
+        int8_t *res;
+        int8_t *input_data = NULL;
+        int8_t *result = NULL;
+        uint64_t res_len = 0;
+        uint64_t input_size = 0;
+        uint64_t result_size = 0;
+        load_bin_file("./model.test/test_conv2d/model_psram.bin", &res, &res_len);
+        load_bin_file("./model.test/test_conv2d/input.bin", &input_data, &input_size);
+        load_bin_file("./model.test/test_conv2d/output.bin", &result, &result_size);
+
+        tStatus ret = T_SUCCESS;
+        ret = tInitialize();
+        REQUIRE(ret == T_SUCCESS);
+
+        int32_t num_memory = 0;
+        tMemory memory_list[5];
+        ret = tGetMemoryPlan((tMemory *)memory_list, &num_memory, (int8_t*)res, res_len);
+        for(int32_t i = 0; i < num_memory; i++)
+        {
+            int32_t mem_size = memory_list[i].size_;
+            if (memory_list[i].dptr_ == 0)
+            {
+                if (1 == memory_list[i].dev_type_ || 3 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_psram_buf + use_psram_size);
+                    use_psram_size += (mem_size+63)&(~63);
+                }
+                else if (2 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_share_buf + use_share_size);
+                    use_share_size += (mem_size+63)&(~63);
+                }
+            }
+        }
+
+        tModelHandle model_hdl;   //typedef uint64_t
+        ret = tModelInit(&model_hdl, (int8_t*)res, res_len, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        tExecHandle hdl;
+        ret = tCreateExecutor(model_hdl, &hdl, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        std::vector<float> bound_in(input_size / 4 + 4);
+        std::vector<float> bound_out(result_size / 4 + 4);
+        float *in_ptr = (float *)(((uintptr_t)bound_in.data() + 15) & ~(uintptr_t)15);
+        float *out_ptr = (float *)(((uintptr_t)bound_out.data() + 15) & ~(uintptr_t)15);
+        memcpy(in_ptr, input_data, input_size);
+        memset(out_ptr, 0, result_size);
+
+        tData input;
+        input.dptr_ = in_ptr;
+        input.dtype_ = Float32;
+        input.scale_ = 1.0f;
+        input.shape_.ndim_ = 4;
+        input.shape_.dims_[0] = 1;
+        input.shape_.dims_[1] = 8;
+        input.shape_.dims_[2] = 64;
+        input.shape_.dims_[3] = 128;
+        ret = tBindInput(hdl, 0, &input);
+        REQUIRE(ret == T_SUCCESS);
+
+        // the same buffer can not serve as an output while it is a bound input
+        tData output;
+        output.dptr_ = in_ptr;
+        output.dtype_ = Float32;
+        output.scale_ = 1.0f;
+        output.shape_ = tGetOutputShape(model_hdl, 0);
+        REQUIRE(tBindOutput(hdl, 0, &output) != T_SUCCESS);
+
+        output.dptr_ = out_ptr;
+        ret = tBindOutput(hdl, 0, &output);
+        REQUIRE(ret == T_SUCCESS);
+
+        // the input tensor reads the caller buffer itself
+        tData info;
+        ret = tGetInputInfo(hdl, 0, &info);
+        REQUIRE(ret == T_SUCCESS);
+        REQUIRE(info.dptr_ == (void *)in_ptr);
+
+        tStats stats;
+        int32_t has_stats = (tResetStats(hdl) == T_SUCCESS);
+        for (int32_t k = 0; k < 2; k++)
+        {
+            ret = tForward(hdl);
+            REQUIRE(ret == T_SUCCESS);
+            REQUIRE(memcmp(in_ptr, input_data, input_size) == 0);
+
+            ret = tGetOutput(hdl, 0, &output);
+            REQUIRE(ret == T_SUCCESS);
+            REQUIRE(output.dptr_ == (void *)out_ptr);
+            uint32_t size = 1;
+            for (uint32_t j = 0; j < output.shape_.ndim_; ++j) {
+                size *= output.shape_.dims_[j];
+            }
+            const float *result_data = (float *)result;
+            REQUIRE(size * 4 == result_size);
+            for (uint32_t j = 0; j < size; j++)
+            {
+                REQUIRE(out_ptr[j] == result_data[j]);
+            }
+        }
+
+        // nothing was copied in or out of the executor
+        if (has_stats)
+        {
+            ret = tGetStats(hdl, &stats, NULL, NULL);
+            REQUIRE(ret == T_SUCCESS);
+            REQUIRE(stats.io_count_ == 0);
+        }
+
+        ret = tReleaseExecutor(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tModelFini(model_hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tUninitialize();
+        REQUIRE(ret == T_SUCCESS);
+    }
+}
+
+TEST_CASE("test_states","[states]")
+{
+    SECTION("state carried between forwards")
+    {
+        #define PSRAM_SIZE  (2*1024*1024)
+        #define SHARE_SIZE  (640*1024)
+
+        static int8_t g_psram_buf[PSRAM_SIZE];
+        static int8_t g_share_buf[SHARE_SIZE];
+
+        int32_t use_psram_size = 0;
+        int32_t use_share_size = 0;
+
+        memset(g_psram_buf, 0x55, PSRAM_SIZE);
+        memset(g_share_buf, 0x55, SHARE_SIZE);
+
+        // h_out = (h_in ++ x)[4:12], packed with --states h_in:h_out
+        int8_t *res;
+        uint64_t res_len = 0;
+        load_bin_file("./model.test/test_state/model.bin", &res, &res_len);
+
+        tStatus ret = T_SUCCESS;
+        ret = tInitialize();
+        REQUIRE(ret == T_SUCCESS);
+
+        int32_t num_memory = 0;
+        tMemory memory_list[5];
+        ret = tGetMemoryPlan((tMemory *)memory_list, &num_memory, (int8_t*)res, res_len);
+        REQUIRE(ret == T_SUCCESS);
+        for(int32_t i = 0; i < num_memory; i++)
+        {
+            int32_t mem_size = memory_list[i].size_;
+            if (memory_list[i].dptr_ == 0)
+            {
+                if (1 == memory_list[i].dev_type_ || 3 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_psram_buf + use_psram_size);
+                    use_psram_size += (mem_size+63)&(~63);
+                }
+                else if (2 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_share_buf + use_share_size);
+                    use_share_size += (mem_size+63)&(~63);
+                }
+            }
+        }
+
+        tModelHandle model_hdl;   //typedef uint64_t
+        ret = tModelInit(&model_hdl, (int8_t*)res, res_len, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+        REQUIRE(tGetInputCount(model_hdl) == 2);
+        REQUIRE(strcmp(tGetInputName(model_hdl, 1), "h_in") == 0);
+
+        tExecHandle hdl;
+        ret = tCreateExecutor(model_hdl, &hdl, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        int8_t x[4];
+        tData input;
+        input.dptr_ = x;
+        input.dtype_ = Int8;
+        input.scale_ = 0;
+        input.shape_.ndim_ = 2;
+        input.shape_.dims_[0] = 1;
+        input.shape_.dims_[1] = 4;
+
+        // the state input is owned by the executor
+        int8_t h[8] = {0};
+        tData state = input;
+        state.dptr_ = h;
+        state.shape_.dims_[1] = 8;
+        REQUIRE(tSetInput(hdl, 1, &state) == T_ERR_INVALID_PARA);
+        REQUIRE(tSetInputByName(hdl, "h_in", &state) == T_ERR_INVALID_PARA);
+        REQUIRE(tBindInput(hdl, 1, &state) == T_ERR_INVALID_PARA);
+
+        ret = tResetState(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        for (int32_t k = 1; k <= 3; k++)
+        {
+            memset(x, k, sizeof(x));
+            ret = tSetInput(hdl, 0, &input);
+            REQUIRE(ret == T_SUCCESS);
+            ret = tForward(hdl);
+            REQUIRE(ret == T_SUCCESS);
+
+            tData output;
+            ret = tGetOutput(hdl, 0, &output);
+            REQUIRE(ret == T_SUCCESS);
+            const int8_t *h_out = (const int8_t *)output.dptr_;
+            for (int32_t j = 0; j < 8; j++)
+            {
+                REQUIRE(h_out[j] == ((j < 4) ? k - 1 : k));
+            }
+        }
+
+        // a new stream starts from zero
+        ret = tResetState(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        memset(x, 5, sizeof(x));
+        ret = tSetInput(hdl, 0, &input);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tForward(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        tData output;
+        ret = tGetOutput(hdl, 0, &output);
+        REQUIRE(ret == T_SUCCESS);
+        for (int32_t j = 0; j < 8; j++)
+        {
+            REQUIRE(((const int8_t *)output.dptr_)[j] == ((j < 4) ? 0 : 5));
+        }
+
+        // one more forward leaves the state pair swapped
+        memset(x, 6, sizeof(x));
+        ret = tSetInput(hdl, 0, &input);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tForward(hdl);
+        REQUIRE(ret == T_SUCCESS);
+
+        // tForwardBatch carries the state through its samples and on to tForward
+        int8_t xb[2][4];
+        int8_t hb[2][8];
+        tData batch_inputs[2 * 2];
+        tData batch_outputs[2];
+        for (int32_t s = 0; s < 2; s++)
+        {
+            memset(xb[s], 7 + s, sizeof(xb[s]));
+            memset(hb[s], 0x55, sizeof(hb[s]));
+            batch_inputs[s * 2] = input;
+            batch_inputs[s * 2].dptr_ = xb[s];
+            batch_inputs[s * 2 + 1] = state;
+            batch_outputs[s].dptr_ = hb[s];
+        }
+        ret = tForwardBatch(hdl, batch_inputs, batch_outputs, 2);
+        REQUIRE(ret == T_SUCCESS);
+        for (int32_t s = 0; s < 2; s++)
+        {
+            for (int32_t j = 0; j < 8; j++)
+            {
+                REQUIRE(hb[s][j] == ((j < 4) ? 6 + s : 7 + s));
+            }
+        }
+
+        memset(x, 9, sizeof(x));
+        ret = tSetInput(hdl, 0, &input);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tForward(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tGetOutput(hdl, 0, &output);
+        REQUIRE(ret == T_SUCCESS);
+        for (int32_t j = 0; j < 8; j++)
+        {
+            REQUIRE(((const int8_t *)output.dptr_)[j] == ((j < 4) ? 8 : 9));
+        }
+
+        ret = tReleaseExecutor(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tModelFini(model_hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tUninitialize();
+        REQUIRE(ret == T_SUCCESS);
+    }
+}
+
+TEST_CASE("test_replan","[replan]")
+{
+    SECTION("in-place aliases move together")
+    {
+        #define PSRAM_SIZE  (2*1024*1024)
+        #define SHARE_SIZE  (640*1024)
+
+        static int8_t g_psram_buf[PSRAM_SIZE];
+        static int8_t g_share_buf[SHARE_SIZE];
+
+        int32_t use_psram_size = 0;
+        int32_t use_share_size = 0;
+
+        memset(g_psram_buf, 0x55, PSRAM_SIZE);
+        memset(g_share_buf, 0x55, SHARE_SIZE);
+
+        // y = x repeated 10 times, c = x ++ x is read through two Unsqueeze aliases
+        // with different lives, packed with -c T=1:16:1
+        int8_t *res;
+        uint64_t res_len = 0;
+        load_bin_file("./model.test/test_replan/model.bin", &res, &res_len);
+
+        tStatus ret = T_SUCCESS;
+        ret = tInitialize();
+        REQUIRE(ret == T_SUCCESS);
+
+        int32_t num_memory = 0;
+        tMemory memory_list[5];
+        ret = tGetMemoryPlan((tMemory *)memory_list, &num_memory, (int8_t*)res, res_len);
+        REQUIRE(ret == T_SUCCESS);
+        uint64_t share_size = 0;
+        for(int32_t i = 0; i < num_memory; i++)
+        {
+            int32_t mem_size = memory_list[i].size_;
+            if (memory_list[i].dptr_ == 0)
+            {
+                if (1 == memory_list[i].dev_type_ || 3 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_psram_buf + use_psram_size);
+                    use_psram_size += (mem_size+63)&(~63);
+                }
+                else if (2 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_share_buf + use_share_size);
+                    use_share_size += (mem_size+63)&(~63);
+                    if (3 == memory_list[i].mem_type_)
+                    {
+                        share_size = memory_list[i].size_;
+                    }
+                }
+            }
+        }
+
+        tModelHandle model_hdl;   //typedef uint64_t
+        ret = tModelInit(&model_hdl, (int8_t*)res, res_len, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        tExecHandle hdl;
+        ret = tCreateExecutor(model_hdl, &hdl, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        const char *axis_names[1] = {"T"};
+        const uint32_t axis_sizes[4] = {4, 16, 9, 1};
+        int8_t x[16];
+        for (int32_t k = 0; k < 4; k++)
+        {
+            uint32_t len = axis_sizes[k];
+            ret = tUpdateShape(hdl, axis_names, axis_sizes + k, 1);
+            REQUIRE(ret == T_SUCCESS);
+
+            uint64_t peak = 0;
+            ret = tGetMemoryPeak(hdl, 2, &peak);
+            REQUIRE(ret == T_SUCCESS);
+            REQUIRE(peak <= share_size);
+
+            for (uint32_t j = 0; j < len; j++)
+            {
+                x[j] = (int8_t)(k * 16 + j);
+            }
+            tData input;
+            input.dptr_ = x;
+            input.dtype_ = Int8;
+            input.scale_ = 0;
+            input.shape_.ndim_ = 2;
+            input.shape_.dims_[0] = 1;
+            input.shape_.dims_[1] = len;
+            ret = tSetInput(hdl, 0, &input);
+            REQUIRE(ret == T_SUCCESS);
+            ret = tForward(hdl);
+            REQUIRE(ret == T_SUCCESS);
+
+            tData output;
+            ret = tGetOutput(hdl, 0, &output);
+            REQUIRE(ret == T_SUCCESS);
+            REQUIRE(output.shape_.dims_[2] == 10 * len);
+            const int8_t *y = (const int8_t *)output.dptr_;
+            for (uint32_t j = 0; j < 10 * len; j++)
+            {
+                REQUIRE(y[j] == x[j % len]);
+            }
+        }
+
+        ret = tReleaseExecutor(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tModelFini(model_hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tUninitialize();
+        REQUIRE(ret == T_SUCCESS);
+    }
+}
+
+#ifndef WIN32
+struct ChainCtx
+{
+    int32_t remaining;
+    int32_t done;
+    tStatus chain_ret;
+    tStatus wait_ret;
+};
+
+static void chain_forward(tExecHandle hdl, tStatus status, void *user)
+{
+    ChainCtx *ctx = (ChainCtx *)user;
+    // the finished forward is already published, waiting on it returns at once
+    ctx->wait_ret = tWait(hdl);
+    if (status != T_SUCCESS || --ctx->remaining == 0)
+    {
+        ctx->done = 1;
+        return;
+    }
+    ctx->chain_ret = tForwardAsync(hdl, chain_forward, user);
+    if (ctx->chain_ret != T_SUCCESS)
+    {
+        ctx->done = 1;
+    }
+}
+
+TEST_CASE("test_forward_async","[async]")
+{
+    SECTION("chain forward from callback")
+    {
+        #define PSRAM_SIZE  (2*1024*1024)
+        #define SHARE_SIZE  (640*1024)
+
+        static int8_t g_psram_buf[PSRAM_SIZE];
+        static int8_t g_share_buf[SHARE_SIZE];
+
+        int32_t use_psram_size = 0;
+        int32_t use_share_size = 0;
+
+        memset(g_psram_buf, 0, PSRAM_SIZE);
+        memset(g_share_buf, 0, SHARE_SIZE);
+
+        int8_t *res;
+        int8_t *input_data = NULL;
+        int8_t *result = NULL;
+        uint64_t res_len = 0;
+        uint64_t input_size = 0;
+        uint64_t result_size = 0;
+        load_bin_file("./model.test/test_conv2d/model.bin", &res, &res_len);
+        load_bin_file("./model.test/test_conv2d/input.bin", &input_data, &input_size);
+        load_bin_file("./model.test/test_conv2d/output.bin", &result, &result_size);
+
+        tStatus ret = T_SUCCESS;
+        ret = tInitialize();
+        REQUIRE(ret == T_SUCCESS);
+
+        int32_t num_memory = 0;
+        tMemory memory_list[5];
+        ret = tGetMemoryPlan((tMemory *)memory_list, &num_memory, (int8_t*)res, res_len);
+        for(int32_t i = 0; i < num_memory; i++)
+        {
+            int32_t mem_size = memory_list[i].size_;
+            if (memory_list[i].dptr_ == 0)
+            {
+                if (1 == memory_list[i].dev_type_ || 3 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_psram_buf + use_psram_size);
+                    use_psram_size += (mem_size+63)&(~63);
+                }
+                else if (2 == memory_list[i].dev_type_)
+                {
+                    memory_list[i].dptr_ = (uint64_t)(g_share_buf + use_share_size);
+                    use_share_size += (mem_size+63)&(~63);
+                }
+            }
+        }
+
+        tModelHandle model_hdl;   //typedef uint64_t
+        ret = tModelInit(&model_hdl, (int8_t*)res, res_len, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        tExecHandle hdl;
+        ret = tCreateExecutor(model_hdl, &hdl, memory_list, num_memory);
+        REQUIRE(ret == T_SUCCESS);
+
+        tData input;
+        input.dptr_ = (int8_t*)input_data;
+        input.dtype_ = Float32;
+        input.scale_ = 1.0f;
+        input.shape_.ndim_ = 4;
+        input.shape_.dims_[0] = 1;
+        input.shape_.dims_[1] = 8;
+        input.shape_.dims_[2] = 64;
+        input.shape_.dims_[3] = 128;
+        ret = tSetInput(hdl, 0, &input);
+        REQUIRE(ret == T_SUCCESS);
+
+        ChainCtx ctx = {3, 0, T_SUCCESS, T_SUCCESS};
+        ret = tForwardAsync(hdl, chain_forward, &ctx);
+        REQUIRE(ret == T_SUCCESS);
+
+        // tWait returns once the whole chain stopped and its last callback returned
+        ret = tWait(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        REQUIRE(ctx.done == 1);
+        REQUIRE(ctx.remaining == 0);
+        REQUIRE(ctx.chain_ret == T_SUCCESS);
+        REQUIRE(ctx.wait_ret == T_SUCCESS);
+
+        tData output;
+        ret = tGetOutput(hdl, 0, &output);
+        REQUIRE(ret == T_SUCCESS);
+        uint32_t size = 1;
+        for (uint32_t j = 0; j < output.shape_.ndim_; ++j) {
+            size *= output.shape_.dims_[j];
+        }
+        const float *output_data = (float *)output.dptr_;
+        const float *result_data = (float *)result;
+        REQUIRE(size * 4 == result_size);
+        for (uint32_t j = 0; j < size; j++)
+        {
+            REQUIRE(output_data[j] == result_data[j]);
+        }
+
+        ret = tReleaseExecutor(hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tModelFini(model_hdl);
+        REQUIRE(ret == T_SUCCESS);
+        ret = tUninitialize();
+        REQUIRE(ret == T_SUCCESS);
+    }
+}
+#endif
+
@@ -0,0 +1,646 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+#define LUNA_HOST_IMPL
+#include "host/luna_host.h"
+}
+#undef bool     // luna_math_types.h maps it to int8_t for C
+#undef FAIL     // luna_error.h status code, catch defines its own
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#define CATCH_CONFIG_NO_POSIX_SIGNALS     // catch 2.13.1 sizes its signal stack with a glibc 2.34+ non-constant
+#include "catch.hpp"
+
+/*
+ * Differential conformance of the host luna kernels (executor/core/ops/arcs/host)
+ * against the simulator library. Every case is run through both and the
+ * outputs must match bit for bit; a failure reports the case and the first
+ * mismatching element. Shapes, shifts and data are random, seeded by
+ * --rng-seed, and LUNA_DIFF_ITERS sets the cases per section.
+ * The hidden [bench] test times both on fixed shapes:  test_luna "[bench]"
+ */
+
+#define ALIGN2(x) (((x) + 1) & ~1)
+#define ALIGN8(x) (((x) + 7) & ~7)
+#define LUNA_SPLIT_MAX 8192     // bytes of weights in one conv split, a kernel pair past it faults the simulator packer
+
+// One call of a luna entry point, run against the simulator or the host kernel
+struct LunaCase {
+    std::string desc;
+    size_t count;           // output elements
+    int32_t elem;           // bytes per output element
+    std::function<int32_t(bool host, void *out)> run;
+};
+
+static std::mt19937 &rng() {
+    static std::mt19937 gen(Catch::rngSeed() ? Catch::rngSeed() : 1);
+    return gen;
+}
+
+static int32_t rnd(int32_t lo, int32_t hi) {
+    return std::uniform_int_distribution<int32_t>(lo, hi)(rng());
+}
+
+static int32_t iterations() {
+    const char *env = getenv("LUNA_DIFF_ITERS");
+    return env ? atoi(env) : 300;
+}
+
+static void fill8(std::vector<int8_t> &v, int32_t lo, int32_t hi) {
+    for (auto &x : v) {
+        x = (int8_t)rnd(lo, hi);
+    }
+}
+
+// int32 data in one of the ranges the operators feed: int8, Q27, full range or edge values
+static void fill32(std::vector<int32_t> &v, int32_t mode) {
+    static const int32_t edges[] = {INT32_MIN, INT32_MAX, 0, -1, 1, INT32_MIN + 1};
+    for (auto &x : v) {
+        switch (mode) {
+            case 0: x = rnd(-128, 127); break;
+            case 1: x = rnd(-(1 << 27), 1 << 27) >> rnd(0, 3); break;
+            case 2: x = rnd(INT32_MIN, INT32_MAX); break;
+            default: x = rnd(0, 3) ? (rnd(INT32_MIN, INT32_MAX) >> rnd(0, 30)) : edges[rnd(0, 5)]; break;
+        }
+    }
+}
+
+// Output shift, including the floor flag (bit 6) and the out of range counts
+static uint32_t randShift() {
+    switch (rnd(0, 9)) {
+        case 0: return 64 + rnd(0, 63);
+        case 1: return 32 + rnd(0, 40);
+        case 2: return 128 + rnd(0, 7);
+        case 3: return (uint32_t)-rnd(0, 70);
+        default: return rnd(0, 31);
+    }
+}
+
+static int64_t element(const std::vector<uint8_t> &buf, size_t index, int32_t elem) {
+    if (elem == 1) {
+        return (int8_t)buf[index];
+    }
+    int32_t v;
+    memcpy(&v, buf.data() + index * 4, 4);
+    return v;
+}
+
+static void check(const LunaCase &c) {
+    size_t bytes = c.count * c.elem;
+    std::vector<uint8_t> ref(bytes + 4, 0x55), got(bytes + 4, 0x66);
+    int32_t ret_ref = c.run(false, ref.data());
+    int32_t ret_got = c.run(true, got.data());
+    INFO(c.desc);
+    REQUIRE(ret_ref == ret_got);
+    if (memcmp(ref.data(), got.data(), bytes) != 0) {
+        for (size_t i = 0; i < c.count; i++) {
+            if (element(ref, i, c.elem) != element(got, i, c.elem)) {
+                FAIL("first mismatch at element " << i << " of " << c.count << ": simulator "
+                     << element(ref, i, c.elem) << ", host " << element(got, i, c.elem));
+            }
+        }
+    }
+}
+
+/************************************ conv ************************************/
+
+typedef int32_t (*ConvFn)(const int8_t *, int8_t *, int32_t *, void *, luna_cnn_static_para_t *);
+
+static const int32_t g_conv_types[4] = {LUNA_CONV, LUNA_DEPTHWISE, LUNA_CONV1D, LUNA_DEPTHWISE1D};
+static const char *g_conv_names[4] = {"conv2d", "depthwise2d", "conv1d", "depthwise1d"};
+
+// [type][w4][o32]
+static const ConvFn g_conv_sim[4][2][2] = {
+    {{(ConvFn)luna_conv2d_i8i8o8, (ConvFn)luna_conv2d_i8i8o32}, {(ConvFn)luna_conv2d_i8i4o8, (ConvFn)luna_conv2d_i8i4o32}},
+    {{(ConvFn)luna_depthwise2d_i8i8o8, (ConvFn)luna_depthwise2d_i8i8o32}, {(ConvFn)luna_depthwise2d_i8i4o8, (ConvFn)luna_depthwise2d_i8i4o32}},
+    {{(ConvFn)luna_conv1d_i8i8o8, (ConvFn)luna_conv1d_i8i8o32}, {(ConvFn)luna_conv1d_i8i4o8, (ConvFn)luna_conv1d_i8i4o32}},
+    {{(ConvFn)luna_depthwise1d_i8i8o8, (ConvFn)luna_depthwise1d_i8i8o32}, {(ConvFn)luna_depthwise1d_i8i4o8, (ConvFn)luna_depthwise1d_i8i4o32}}};
+static const ConvFn g_conv_host[4][2][2] = {
+    {{(ConvFn)luna_host_conv2d_i8i8o8, (ConvFn)luna_host_conv2d_i8i8o32}, {(ConvFn)luna_host_conv2d_i8i4o8, (ConvFn)luna_host_conv2d_i8i4o32}},
+    {{(ConvFn)luna_host_depthwise2d_i8i8o8, (ConvFn)luna_host_depthwise2d_i8i8o32}, {(ConvFn)luna_host_depthwise2d_i8i4o8, (ConvFn)luna_host_depthwise2d_i8i4o32}},
+    {{(ConvFn)luna_host_conv1d_i8i8o8, (ConvFn)luna_host_conv1d_i8i8o32}, {(ConvFn)luna_host_conv1d_i8i4o8, (ConvFn)luna_host_conv1d_i8i4o32}},
+    {{(ConvFn)luna_host_depthwise1d_i8i8o8, (ConvFn)luna_host_depthwise1d_i8i8o32}, {(ConvFn)luna_host_depthwise1d_i8i4o8, (ConvFn)luna_host_depthwise1d_i8i4o32}}};
+
+struct ConvData {
+    conv_struct_t conv;
+    luna_cnn_static_para_t sim_para;
+    luna_cnn_static_para_t host_para;
+    std::vector<int8_t> input;
+    std::vector<int8_t> weight;
+    std::vector<int32_t> bias;
+};
+
+/**
+ * @brief Build a conv case, weights packed in the tpacker arcs layout
+ * @param c Case to fill
+ * @param kind 0 conv2d, 1 depthwise2d, 2 conv1d, 3 depthwise1d
+ * @param conv Shape, shifts and activation, output size is derived
+ * @param w4 int4 weights
+ * @return bool False if the simulator cannot pack this shape
+ */
+static bool makeConv(LunaCase &c, int32_t kind, conv_struct_t conv, int32_t w4) {
+    int32_t depthwise = (kind & 1);
+    int32_t C = conv.input_c, O = conv.output_c, kh = conv.weight_h, kw = conv.weight_w;
+    int32_t ekh = (kh - 1) * (conv.dilation_h ? conv.dilation_h : 1) + 1;
+    int32_t ekw = (kw - 1) * (conv.dilation_w ? conv.dilation_w : 1) + 1;
+    conv.output_h = (conv.input_h + conv.padding_h_up + conv.padding_h_down - ekh) / conv.stride_h + 1;
+    conv.output_w = (conv.input_w + conv.padding_w_left + conv.padding_w_right - ekw) / conv.stride_w + 1;
+    conv.weight_bits = w4 ? 4 : 8;
+    conv.group = depthwise ? C : 1;
+
+    std::shared_ptr<ConvData> d = std::make_shared<ConvData>();
+    d->input.resize(C * conv.input_h * conv.input_w);
+    fill8(d->input, -128, 127);
+    std::vector<int8_t> w(O * (depthwise ? 1 : C) * kh * kw);
+    fill8(w, w4 ? -8 : -128, w4 ? 7 : 127);
+    d->bias.resize(O);
+    for (auto &b : d->bias) {
+        b = rnd(-10000, 10000);
+    }
+
+    std::vector<int8_t> packed;
+    if (!depthwise) {
+        // [O/2][kh][kw][Ca/8][2][8], outputs padded to even splits that fit LUNA_SPLIT_MAX
+        int32_t Ca = ALIGN8(C), Oa = ALIGN2(O);
+        if (Oa * Ca * kh * kw > LUNA_SPLIT_MAX) {
+            int32_t most = LUNA_SPLIT_MAX / (Ca * kh * kw);
+            most -= most % 2;
+            if (most < 2) {
+                return false;
+            }
+            int32_t splits = (O + most - 1) / most;
+            int32_t each = ALIGN2((O + splits - 1) / splits);
+            Oa = each * splits;
+        }
+        packed.assign(Oa * Ca * kh * kw, 0);
+        for (int32_t o = 0; o < O; o++)
+            for (int32_t ch = 0; ch < C; ch++)
+                for (int32_t i = 0; i < kh; i++)
+                    for (int32_t j = 0; j < kw; j++)
+                        packed[((((o / 2) * kh * kw + i * kw + j) * (Ca / 8) + ch / 8) * 2 + o % 2) * 8 + ch % 8] =
+                            w[((o * C + ch) * kh + i) * kw + j];
+    } else {
+        // [O/8][kh][kw][8]
+        packed.assign(ALIGN8(O) * kh * kw, 0);
+        for (int32_t o = 0; o < O; o++)
+            for (int32_t i = 0; i < kh; i++)
+                for (int32_t j = 0; j < kw; j++)
+                    packed[(((o / 8) * kh + i) * kw + j) * 8 + o % 8] = w[(o * kh + i) * kw + j];
+    }
+    if (w4) {
+        // low nibble holds the even element
+        d->weight.resize(packed.size() / 2);
+        for (size_t i = 0; i < d->weight.size(); i++) {
+            d->weight[i] = (int8_t)((packed[2 * i + 1] << 4) | (packed[2 * i] & 0x0F));
+        }
+    } else {
+        d->weight = packed;
+    }
+
+    d->conv = conv;
+    conv_struct_t host_conv = conv;
+    if (luna_split_conv_para_pack(&d->conv, &d->sim_para, g_conv_types[kind]) != 0 ||
+        luna_host_split_conv_para_pack(&host_conv, &d->host_para, g_conv_types[kind]) != 0) {
+        return false;
+    }
+
+    int32_t o32 = (conv.ou_bits == 32);
+    std::ostringstream desc;
+    desc << g_conv_names[kind] << (w4 ? " i8i4" : " i8i8") << (o32 ? "o32" : "o8") << " C" << C << " O" << O
+         << " in " << (int32_t)conv.input_h << "x" << (int32_t)conv.input_w << " k " << kh << "x" << kw << " stride " << (int32_t)conv.stride_h
+         << "x" << (int32_t)conv.stride_w << " dilation " << (int32_t)conv.dilation_h << "x" << (int32_t)conv.dilation_w << " pad "
+         << (int32_t)conv.padding_h_up << "," << (int32_t)conv.padding_h_down << "," << (int32_t)conv.padding_w_left << ","
+         << (int32_t)conv.padding_w_right << " act " << (int32_t)conv.activation_type << " shift " << (int32_t)conv.positive_shift_value << "/"
+         << (int32_t)conv.negative_shift_value << (conv.positive_shift_type == ShiftType_Floor ? " floor" : " round")
+         << " bias " << (int32_t)conv.is_bias;
+    c.desc = desc.str();
+    c.count = O * conv.output_h * conv.output_w;
+    c.elem = o32 ? 4 : 1;
+    ConvFn sim = g_conv_sim[kind][w4][o32], host = g_conv_host[kind][w4][o32];
+    c.run = [d, sim, host](bool use_host, void *out) {
+        return use_host ? host(d->input.data(), d->weight.data(), d->bias.data(), out, &d->host_para)
+                        : sim(d->input.data(), d->weight.data(), d->bias.data(), out, &d->sim_para);
+    };
+    return true;
+}
+
+static bool randomConv(LunaCase &c, int32_t kind, int32_t large) {
+    int32_t depthwise = (kind & 1), oned = (kind >= 2);
+    conv_struct_t conv;
+    memset(&conv, 0, sizeof(conv));
+    conv.input_c = rnd(1, large ? 96 : 24);
+    conv.output_c = depthwise ? conv.input_c : rnd(1, large ? 96 : 24);
+    conv.weight_h = oned ? 1 : rnd(1, 5);
+    conv.weight_w = rnd(1, oned ? 8 : 5);
+    conv.stride_h = oned ? 1 : rnd(1, 3);
+    conv.stride_w = rnd(1, 3);
+    conv.dilation_h = oned ? 1 : rnd(1, 2);
+    conv.dilation_w = (oned && rnd(0, 2) == 0) ? 0 : rnd(1, 2);       // conv1dint leaves it 0
+    int32_t ekh = (conv.weight_h - 1) * conv.dilation_h + 1;
+    int32_t ekw = (conv.weight_w - 1) * (conv.dilation_w ? conv.dilation_w : 1) + 1;
+    conv.input_h = oned ? 1 : ekh + rnd(0, 11);
+    conv.input_w = ekw + rnd(0, rnd(0, 7) ? 15 : 299);
+    conv.padding_h_up = oned ? 0 : rnd(0, conv.weight_h - 1);
+    conv.padding_h_down = oned ? 0 : rnd(0, conv.weight_h - 1);
+    conv.padding_w_left = rnd(0, conv.weight_w - 1);
+    conv.padding_w_right = rnd(0, conv.weight_w - 1);
+    int32_t act = rnd(0, 2);
+    conv.activation_type = (act == 1) ? RELU : ((act == 2) ? PRELU : NO_ACTIVE);
+    conv.positive_shift_type = rnd(0, 3) ? ShiftType_FloorX05 : ShiftType_Floor;
+    conv.negative_shift_type = conv.positive_shift_type;
+    conv.positive_shift_value = rnd(0, 13);
+    conv.negative_shift_value = rnd(0, 13);
+    conv.is_bias = rnd(0, 1);
+    conv.ou_bits = rnd(0, 1) ? 32 : 8;
+    return makeConv(c, kind, conv, rnd(0, 1));
+}
+
+/*********************************** matmul ***********************************/
+
+typedef int32_t (*MatFn)(const int8_t *, const int8_t *, void *, uint32_t, uint32_t, uint32_t, uint32_t);
+typedef int32_t (*MatBiasFn)(const int8_t *, const int8_t *, const int32_t *, void *, uint32_t, uint32_t, uint32_t, uint32_t);
+
+struct MatData {
+    std::vector<int8_t> a;
+    std::vector<int8_t> b;
+    std::vector<int32_t> bias;
+};
+
+/**
+ * @brief Build a matmul case
+ * @param c Case to fill
+ * @param kind 0-3 mat_mul / split_mat_mul o8 and o32, 4-7 split_mat_mul_bias i8 and i4 o8 and o32
+ * @param row Rows of src1
+ * @param col Columns of src1, rows of src2
+ * @param col2 Columns of src2
+ * @param shift Output shift
+ */
+static void makeMatMul(LunaCase &c, int32_t kind, int32_t row, int32_t col, int32_t col2, uint32_t shift) {
+    static const char *names[8] = {"mat_mul_i8i8o8", "mat_mul_i8i8o32", "split_mat_mul_i8i8o8",
+                                   "split_mat_mul_i8i8o32", "split_mat_mul_bias_i8i8i32o8",
+                                   "split_mat_mul_bias_i8i8i32o32", "split_mat_mul_bias_i4i8i32o8",
+                                   "split_mat_mul_bias_i4i8i32o32"};
+    static const MatFn sim[4] = {(MatFn)luna_mat_mul_i8i8o8, (MatFn)luna_mat_mul_i8i8o32,
+                                 (MatFn)luna_split_mat_mul_i8i8o8, (MatFn)luna_split_mat_mul_i8i8o32};
+    static const MatFn host[4] = {(MatFn)luna_host_mat_mul_i8i8o8, (MatFn)luna_host_mat_mul_i8i8o32,
+                                  (MatFn)luna_host_split_mat_mul_i8i8o8, (MatFn)luna_host_split_mat_mul_i8i8o32};
+    static const MatBiasFn sim_bias[4] = {
+        (MatBiasFn)luna_split_mat_mul_bias_i8i8i32o8, (MatBiasFn)luna_split_mat_mul_bias_i8i8i32o32,
+        (MatBiasFn)luna_split_mat_mul_bias_i4i8i32o8, (MatBiasFn)luna_split_mat_mul_bias_i4i8i32o32};
+    static const MatBiasFn host_bias[4] = {
+        (MatBiasFn)luna_host_split_mat_mul_bias_i8i8i32o8, (MatBiasFn)luna_host_split_mat_mul_bias_i8i8i32o32,
+        (MatBiasFn)luna_host_split_mat_mul_bias_i4i8i32o8, (MatBiasFn)luna_host_split_mat_mul_bias_i4i8i32o32};
+
+    if (kind >= 6) {
+        col = ALIGN2(col);      // int4 rows are whole bytes
+    }
+    std::shared_ptr<MatData> d = std::make_shared<MatData>();
+    d->a.resize(row * col);
+    d->b.resize(col * col2);
+    d->bias.resize(row);
+    fill8(d->a, -128, 127);
+    fill8(d->b, -128, 127);
+    for (auto &b : d->bias) {
+        b = rnd(-100000, 100000);
+    }
+    std::ostringstream desc;
+    desc << names[kind] << " " << row << "x" << col << "x" << col2 << " shift " << shift;
+    c.desc = desc.str();
+    c.count = row * col2;
+    c.elem = (kind & 1) ? 4 : 1;
+    if (kind < 4) {
+        MatFn s = sim[kind], h = host[kind];
+        c.run = [d, s, h, row, col, col2, shift](bool use_host, void *out) {
+            return (use_host ? h : s)(d->a.data(), d->b.data(), out, row, col, col2, shift);
+        };
+    } else {
+        MatBiasFn s = sim_bias[kind - 4], h = host_bias[kind - 4];
+        c.run = [d, s, h, row, col, col2, shift](bool use_host, void *out) {
+            return (use_host ? h : s)(d->a.data(), d->b.data(), d->bias.data(), out, row, col, col2, shift);
+        };
+    }
+}
+
+/*********************************** vector ***********************************/
+
+struct VecData {
+    std::vector<int8_t> a8, b8;
+    std::vector<int32_t> a32, b32;
+};
+
+typedef int32_t (*Vec8Fn)(const int8_t *, const int8_t *, void *, uint32_t, uint32_t);
+typedef int32_t (*Vec32Fn)(const int32_t *, const int32_t *, void *, uint32_t, uint32_t);
+typedef int32_t (*Scale8Fn)(const int8_t *, int8_t, void *, uint32_t, uint32_t);
+typedef int32_t (*Scale32Fn)(const int32_t *, int32_t, void *, uint32_t, uint32_t);
+typedef int32_t (*Relu8Fn)(const int8_t *, void *, uint32_t, uint32_t);
+typedef int32_t (*Relu32Fn)(const int32_t *, void *, uint32_t, uint32_t);
+typedef int32_t (*Prelu8Fn)(const int8_t *, uint32_t, void *, uint32_t, uint32_t);
+typedef int32_t (*Prelu32Fn)(const int32_t *, uint32_t, void *, uint32_t, uint32_t);
+typedef int32_t (*ActFn)(const int32_t *, void *, uint32_t);
+
+#define LUNA_PAIR(fn, type) {#fn, (type)luna_##fn, (type)luna_host_##fn, (strstr(#fn, "o32") ? 4 : 1)}
+
+template <typename Fn>
+struct VecEntry {
+    const char *name;
+    Fn sim;
+    Fn host;
+    int32_t elem;
+};
+
+static const VecEntry<Vec8Fn> g_vec8[] = {
+    LUNA_PAIR(add_i8i8o8, Vec8Fn), LUNA_PAIR(add_i8i8o32, Vec8Fn), LUNA_PAIR(sub_i8i8o8, Vec8Fn),
+    LUNA_PAIR(sub_i8i8o32, Vec8Fn), LUNA_PAIR(mul_i8i8o8, Vec8Fn), LUNA_PAIR(mul_i8i8o32, Vec8Fn)};
+static const VecEntry<Vec32Fn> g_vec32[] = {
+    LUNA_PAIR(add_i32i32o8, Vec32Fn), LUNA_PAIR(add_i32i32o32, Vec32Fn), LUNA_PAIR(sub_i32i32o8, Vec32Fn),
+    LUNA_PAIR(sub_i32i32o32, Vec32Fn), LUNA_PAIR(mul_i32i32o8, Vec32Fn), LUNA_PAIR(mul_i32i32o32, Vec32Fn)};
+static const VecEntry<Scale8Fn> g_scale8[] = {
+    LUNA_PAIR(scale_i8i8o8, Scale8Fn), LUNA_PAIR(scale_i8i8o32, Scale8Fn), LUNA_PAIR(offset_i8i8o8, Scale8Fn),
+    LUNA_PAIR(offset_i8i8o32, Scale8Fn)};
+static const VecEntry<Scale32Fn> g_scale32[] = {
+    LUNA_PAIR(scale_i32i32o8, Scale32Fn), LUNA_PAIR(scale_i32i32o32, Scale32Fn),
+    LUNA_PAIR(offset_i32i32o8, Scale32Fn), LUNA_PAIR(offset_i32i32o32, Scale32Fn)};
+static const VecEntry<Relu8Fn> g_relu8[] = {LUNA_PAIR(relu_i8o8, Relu8Fn), LUNA_PAIR(relu_i8o32, Relu8Fn)};
+static const VecEntry<Relu32Fn> g_relu32[] = {LUNA_PAIR(relu_i32o8, Relu32Fn), LUNA_PAIR(relu_i32o32, Relu32Fn)};
+static const VecEntry<Prelu8Fn> g_prelu8[] = {LUNA_PAIR(prelu_i8o8, Prelu8Fn), LUNA_PAIR(prelu_i8o32, Prelu8Fn)};
+static const VecEntry<Prelu32Fn> g_prelu32[] = {LUNA_PAIR(prelu_i32o8, Prelu32Fn), LUNA_PAIR(prelu_i32o32, Prelu32Fn)};
+static const VecEntry<ActFn> g_act[] = {LUNA_PAIR(sigmoid_i32o8, ActFn), LUNA_PAIR(sigmoid_i32o32, ActFn),
+                                        LUNA_PAIR(tanh_i32o8, ActFn), LUNA_PAIR(tanh_i32o32, ActFn),
+                                        LUNA_PAIR(softmax_i32o32, ActFn)};
+
+#define LUNA_COUNT(arr) ((int32_t)(sizeof(arr) / sizeof(arr[0])))
+
+static std::shared_ptr<VecData> makeVecData(uint32_t size, int32_t mode) {
+    std::shared_ptr<VecData> d = std::make_shared<VecData>();
+    d->a8.resize(size);
+    d->b8.resize(size);
+    d->a32.resize(size);
+    d->b32.resize(size);
+    fill8(d->a8, -128, 127);
+    fill8(d->b8, -128, 127);
+    fill32(d->a32, mode);
+    fill32(d->b32, mode);
+    return d;
+}
+
+template <typename Fn>
+static void describe(LunaCase &c, const VecEntry<Fn> &e, uint32_t size, uint32_t shift) {
+    std::ostringstream desc;
+    desc << e.name << " size " << size << " shift " << (int32_t)shift;
+    c.desc = desc.str();
+    c.count = size;
+    c.elem = e.elem;
+}
+
+/**
+ * @brief Build a vector case
+ * @param c Case to fill
+ * @param family 0 binary i8, 1 binary i32, 2 scalar i8, 3 scalar i32, 4 relu, 5 prelu, 6 sigmoid/tanh/softmax
+ * @param index Entry within the family
+ * @param size Number of elements
+ * @param mode Range of the int32 data, see fill32
+ */
+static void makeVector(LunaCase &c, int32_t family, int32_t index, uint32_t size, int32_t mode) {
+    std::shared_ptr<VecData> d = makeVecData(size, mode);
+    uint32_t shift = randShift();
+    uint32_t slope = randShift();
+    int8_t s8 = (int8_t)rnd(-128, 127);
+    int32_t s32 = (mode == 0) ? rnd(-128, 127) : rnd(INT32_MIN, INT32_MAX) >> rnd(0, 31);
+    switch (family) {
+        case 0: {
+            const VecEntry<Vec8Fn> &e = g_vec8[index % LUNA_COUNT(g_vec8)];
+            describe(c, e, size, shift);
+            c.run = [d, e, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a8.data(), d->b8.data(), out, size, shift); };
+            break;
+        }
+        case 1: {
+            const VecEntry<Vec32Fn> &e = g_vec32[index % LUNA_COUNT(g_vec32)];
+            describe(c, e, size, shift);
+            c.run = [d, e, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a32.data(), d->b32.data(), out, size, shift); };
+            break;
+        }
+        case 2: {
+            const VecEntry<Scale8Fn> &e = g_scale8[index % LUNA_COUNT(g_scale8)];
+            describe(c, e, size, shift);
+            c.desc += " scalar " + std::to_string(s8);
+            c.run = [d, e, s8, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a8.data(), s8, out, size, shift); };
+            break;
+        }
+        case 3: {
+            const VecEntry<Scale32Fn> &e = g_scale32[index % LUNA_COUNT(g_scale32)];
+            describe(c, e, size, shift);
+            c.desc += " scalar " + std::to_string(s32);
+            c.run = [d, e, s32, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a32.data(), s32, out, size, shift); };
+            break;
+        }
+        case 4: {
+            if (index % 2 == 0) {
+                const VecEntry<Relu8Fn> &e = g_relu8[(index / 2) % LUNA_COUNT(g_relu8)];
+                describe(c, e, size, shift);
+                c.run = [d, e, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a8.data(), out, size, shift); };
+            } else {
+                const VecEntry<Relu32Fn> &e = g_relu32[(index / 2) % LUNA_COUNT(g_relu32)];
+                describe(c, e, size, shift);
+                c.run = [d, e, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a32.data(), out, size, shift); };
+            }
+            break;
+        }
+        case 5: {
+            if (index % 2 == 0) {
+                const VecEntry<Prelu8Fn> &e = g_prelu8[(index / 2) % LUNA_COUNT(g_prelu8)];
+                describe(c, e, size, shift);
+                c.run = [d, e, slope, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a8.data(), slope, out, size, shift); };
+            } else {
+                const VecEntry<Prelu32Fn> &e = g_prelu32[(index / 2) % LUNA_COUNT(g_prelu32)];
+                describe(c, e, size, shift);
+                c.run = [d, e, slope, size, shift](bool h, void *out) { return (h ? e.host : e.sim)(d->a32.data(), slope, out, size, shift); };
+            }
+            c.desc += " slope " + std::to_string((int32_t)slope);
+            break;
+        }
+        default: {
+            const VecEntry<ActFn> &e = g_act[index % LUNA_COUNT(g_act)];
+            describe(c, e, size, 0);
+            c.run = [d, e, size](bool h, void *out) { return (h ? e.host : e.sim)(d->a32.data(), out, size); };
+            break;
+        }
+    }
+    c.desc += " data " + std::to_string(mode);
+}
+
+static uint32_t randSize() {
+    return rnd(0, 4) ? rnd(0, 40) : rnd(0, 2048);
+}
+
+/*********************************** tests ************************************/
+
+TEST_CASE("luna conv and depthwise", "[conv]")
+{
+    for (int32_t kind = 0; kind < 4; kind++) {
+        SECTION(g_conv_names[kind])
+        {
+            int32_t done = 0;
+            for (int32_t i = 0; i < iterations(); i++) {
+                LunaCase c;
+                if (randomConv(c, kind, i % 2)) {
+                    check(c);
+                    done++;
+                }
+            }
+            REQUIRE(done > 0);
+        }
+    }
+}
+
+TEST_CASE("luna matmul", "[matmul]")
+{
+    for (int32_t i = 0; i < iterations(); i++) {
+        int32_t kind = i % 8;
+        int32_t row = rnd(1, (i % 3 == 0) ? 64 : 9);
+        int32_t col = rnd(1, (i % 5 == 0) ? 2000 : 70);
+        int32_t col2 = rnd(1, (i % 2) ? 80 : 20);
+        if (kind < 2) {
+            // the unsplit simulator kernels overflow an internal buffer on larger sizes
+            row = 1 + row % 9;
+            col = 1 + col % 70;
+            col2 = 1 + col2 % 20;
+        }
+        LunaCase c;
+        makeMatMul(c, kind, row, col, col2, rnd(0, 23));
+        check(c);
+    }
+}
+
+TEST_CASE("luna element-wise", "[vector]")
+{
+    static const char *families[4] = {"binary i8", "binary i32", "scalar i8", "scalar i32"};
+    for (int32_t family = 0; family < 4; family++) {
+        SECTION(families[family])
+        {
+            for (int32_t i = 0; i < iterations(); i++) {
+                LunaCase c;
+                makeVector(c, family, i, randSize(), rnd(0, 3));
+                check(c);
+            }
+        }
+    }
+}
+
+TEST_CASE("luna activation", "[vector]")
+{
+    static const char *families[3] = {"relu", "prelu", "sigmoid tanh softmax"};
+    for (int32_t family = 0; family < 3; family++) {
+        SECTION(families[family])
+        {
+            for (int32_t i = 0; i < iterations(); i++) {
+                LunaCase c;
+                makeVector(c, 4 + family, i, randSize(), rnd(0, 3));
+                check(c);
+            }
+        }
+    }
+    SECTION("softmax in place")
+    {
+        for (int32_t i = 0; i < iterations(); i++) {
+            uint32_t size = randSize();
+            std::shared_ptr<VecData> d = makeVecData(size, 1);
+            LunaCase c;
+            c.desc = "softmax_i32o32 in place size " + std::to_string(size);
+            c.count = size;
+            c.elem = 4;
+            c.run = [d, size](bool h, void *out) {
+                memcpy(out, d->a32.data(), size * 4);
+                return (h ? luna_host_softmax_i32o32 : luna_softmax_i32o32)((int32_t *)out, (int32_t *)out, size);
+            };
+            check(c);
+        }
+    }
+}
+
+/********************************* throughput *********************************/
+
+static double secondsPerRun(const LunaCase &c, bool host, void *out) {
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    double elapsed = 0;
+    int32_t runs = 0;
+    do {
+        c.run(host, out);
+        runs++;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < 0.2 && runs < 100000);
+    return elapsed / runs;
+}
+
+static void bench(const LunaCase &c) {
+    check(c);
+    std::vector<uint8_t> out(c.count * c.elem + 4);
+    double sim = secondsPerRun(c, false, out.data());
+    double host = secondsPerRun(c, true, out.data());
+    printf("%-64s %12.1f %12.1f %8.2fx\n", c.desc.c_str(), sim * 1e6, host * 1e6, sim / host);
+}
+
+static conv_struct_t benchConv(int32_t C, int32_t O, int32_t H, int32_t W, int32_t kh, int32_t kw, int32_t stride) {
+    conv_struct_t conv;
+    memset(&conv, 0, sizeof(conv));
+    conv.input_c = C;
+    conv.output_c = O;
+    conv.input_h = H;
+    conv.input_w = W;
+    conv.weight_h = kh;
+    conv.weight_w = kw;
+    conv.stride_h = (H == 1) ? 1 : stride;
+    conv.stride_w = stride;
+    conv.dilation_h = 1;
+    conv.dilation_w = 1;
+    conv.padding_h_up = kh / 2;
+    conv.padding_h_down = kh / 2;
+    conv.padding_w_left = kw / 2;
+    conv.padding_w_right = kw / 2;
+    conv.activation_type = RELU;
+    conv.positive_shift_type = ShiftType_FloorX05;
+    conv.negative_shift_type = ShiftType_FloorX05;
+    conv.positive_shift_value = 8;
+    conv.is_bias = 1;
+    conv.ou_bits = 8;
+    return conv;
+}
+
+TEST_CASE("luna throughput", "[.][bench]")
+{
+    printf("%-64s %12s %12s %9s\n", "kernel", "simulator us", "host us", "speedup");
+    LunaCase c;
+    REQUIRE(makeConv(c, 0, benchConv(32, 32, 32, 32, 3, 3, 1), 0));
+    bench(c);
+    REQUIRE(makeConv(c, 0, benchConv(32, 32, 32, 32, 3, 3, 1), 1));
+    bench(c);
+    REQUIRE(makeConv(c, 1, benchConv(64, 64, 32, 32, 3, 3, 1), 0));
+    bench(c);
+    REQUIRE(makeConv(c, 2, benchConv(64, 64, 1, 256, 1, 5, 1), 0));
+    bench(c);
+    REQUIRE(makeConv(c, 3, benchConv(64, 64, 1, 256, 1, 5, 1), 0));
+    bench(c);
+    makeMatMul(c, 4, 16, 256, 256, 8);
+    bench(c);
+    makeMatMul(c, 6, 16, 256, 256, 8);
+    bench(c);
+    makeMatMul(c, 3, 32, 64, 64, 0);
+    bench(c);
+    struct { int32_t family, index, mode; } vectors[] = {
+        {0, 0, 0}, {0, 4, 0}, {1, 1, 1}, {1, 5, 0}, {2, 0, 0}, {3, 1, 1}, {3, 0, 1},
+        {4, 0, 0}, {5, 1, 1}, {6, 0, 1}, {6, 3, 1}, {6, 4, 1}};
+    for (auto &v : vectors) {
+        makeVector(c, v.family, v.index, 16384, v.mode);
+        bench(c);
+    }
+}
@@ -40,6 +40,16 @@ def parse_shape_config(s: str) -> Dict[str, Tuple[int]]:
         dynamic_shape[key] = shape
     return dynamic_shape
 
+def parse_state_config(s: str) -> List[Tuple[str, str]]:
+    """Parse state pairs configuration string into a list of (input, output) names."""
+    states = []
+    if not s:
+        return states
+    for item in s.split(","):
+        in_name, out_name = item.split(":")
+        states.append((in_name, out_name))
+    return states
+
 def split_csv_string(s: str) -> List[str]:
     """Split a comma-separated string into a list of strings."""
     return s.split(",") if s else []
@@ -118,6 +128,10 @@ def export_configuration(args, model_config, device_config, memory_config, param
                 "isstream": {
                     "value": model_config.isstream,
                     "comment": parameter_comments["isstream"]
+                },
+                "states": {
+                    "value": ",".join(f"{i}:{o}" for i, o in model_config.states),
+                    "comment": parameter_comments["states"]
                 }
             },
             "Device Configuration": {
@@ -139,6 +153,22 @@ def export_configuration(args, model_config, device_config, memory_config, param
                     "value": memory_config.dma_prefetch,
                     "comment": parameter_comments["dma_prefetch"]
                 },
+                "dma_depth": {
+                    "value": memory_config.dma_depth,
+                    "comment": parameter_comments["dma_depth"]
+                },
+                "dma_merge_size": {
+                    "value": memory_config.dma_merge_size,
+                    "comment": parameter_comments["dma_merge_size"]
+                },
+                "spill_size": {
+                    "value": memory_config.spill_size,
+                    "comment": parameter_comments["spill_size"]
+                },
+                "spill_gap": {
+                    "value": memory_config.spill_gap,
+                    "comment": parameter_comments["spill_gap"]
+                },
                 "memory": {
                     "value": ",".join(f"{k}:{v}" for k, v in memory_config.storage_location.items()),
                     "comment": parameter_comments["memory"]
@@ -211,6 +241,10 @@ def parse_arguments() -> Tuple[argparse.Namespace, Dict, Dict]:
         "--isstream", default=None, type=str, choices=[None, "split_h", "split_w"],
         help="Enable stream processing"
     )
+    model_config.add_argument(
+        "--states", default='', type=str,
+        help="Comma-separated state pairs carried between forwards (e.g. h_in:h_out,c_in:c_out)"
+    )
 
     # Device Configuration
     device_config = parser.add_argument_group("Device Configuration")
@@ -233,6 +267,22 @@ def parse_arguments() -> Tuple[argparse.Namespace, Dict, Dict]:
         "--dma_prefetch", default='True', type=parse_boolean,
         help="DMA prefetching function switch"
     )
+    memory_config.add_argument(
+        "--dma_depth", default=2, type=int,
+        help="Number of share-memory buffers in the weight prefetch ring"
+    )
+    memory_config.add_argument(
+        "--dma_merge_size", default=0, type=int,
+        help="Maximum size of one DMA burst merging the weights of adjacent operators, 0 disables merging"
+    )
+    memory_config.add_argument(
+        "--spill_size", default=0, type=int,
+        help="Minimum size of a share-memory activation spilled to PSRAM across a long idle stretch, 0 disables spilling"
+    )
+    memory_config.add_argument(
+        "--spill_gap", default=8, type=int,
+        help="Minimum number of operators an activation stays unused before it is spilled"
+    )
     memory_config.add_argument(
         "-m", "--memory", default='', type=str,
         help="Specify the storage location of node data as either PSRAM or shared memory.(e.g. inputs[0]:share-memory)"
@@ -307,7 +357,8 @@ def parse_parameters(args) -> Tuple[ModelConfig, DeviceConfig, MemoryConfig]:
         outputs=split_csv_string(args.outputs),
         strategy=split_csv_string(args.strategy),
         dynamic_shape=parse_shape_config(args.dynamic_shape),
-        isstream=args.isstream
+        isstream=args.isstream,
+        states=parse_state_config(args.states)
     )
 
     device_config = DeviceConfig(
@@ -322,7 +373,11 @@ def parse_parameters(args) -> Tuple[ModelConfig, DeviceConfig, MemoryConfig]:
         threshold1=args.threshold1,
         threshold2=args.threshold2,
         threshold3=args.threshold3,
-        threshold4=args.threshold4
+        threshold4=args.threshold4,
+        dma_depth=args.dma_depth,
+        dma_merge_size=args.dma_merge_size,
+        spill_size=args.spill_size,
+        spill_gap=args.spill_gap
     )
 
     print(f"{Colors.GREEN}1.3 Parse parameter all passed{Colors.RESET}")
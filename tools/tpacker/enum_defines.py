@@ -68,7 +68,7 @@ class TensorType(EnumBase):
 # Model configuration
 class ModelConfig:
     """Configuration parameters for the model."""
-    def __init__(self, inputs: List[str], outputs: List[str], strategy: List[str], dynamic_shape: Dict[str, Tuple[int]], isstream: Optional[str]):
+    def __init__(self, inputs: List[str], outputs: List[str], strategy: List[str], dynamic_shape: Dict[str, Tuple[int]], isstream: Optional[str], states: Optional[List[Tuple[str, str]]] = None):
         """
         Initialize the model configuration.
         
@@ -77,12 +77,14 @@ class ModelConfig:
             outputs: List of output node names.
             dynamic_shape: Dictionary mapping node names to their dynamic shapes.
             isstream: Stream processing mode, optional.
+            states: List of (state input name, state output name) pairs.
         """
         self.inputs = inputs
         self.outputs = outputs
         self.strategy = strategy
         self.dynamic_shape = dynamic_shape
         self.isstream = isstream
+        self.states = states if states is not None else []
 
 # Device configuration
 class DeviceConfig:
@@ -104,7 +106,9 @@ class DeviceConfig:
 class MemoryConfig:
     """Configuration parameters for memory pre-allocation."""
     def __init__(self, dma_prefetch: bool, memory: Dict[str, Tuple[int]], 
-                 threshold1: int, threshold2: int, threshold3: int, threshold4: int):
+                 threshold1: int, threshold2: int, threshold3: int, threshold4: int,
+                 dma_depth: int = 2, dma_merge_size: int = 0,
+                 spill_size: int = 0, spill_gap: int = 8):
         """
         Initialize the memory configuration.
         
@@ -115,8 +119,16 @@ class MemoryConfig:
             threshold2: Maximum size for convolution operator outputs.
             threshold3: Maximum size for linear operator outputs.
             threshold4: Maximum size for nodes in shared memory.
+            dma_depth: Number of DMA buffers weights are prefetched into.
+            dma_merge_size: Maximum size of a burst merging adjacent weights, 0 disables merging.
+            spill_size: Minimum size of a share memory activation spilled to PSRAM, 0 disables spilling.
+            spill_gap: Minimum number of ops an activation stays unused to be spilled.
         """
         self.dma_prefetch = dma_prefetch
+        self.dma_depth = dma_depth
+        self.dma_merge_size = dma_merge_size
+        self.spill_size = spill_size
+        self.spill_gap = spill_gap
         self.storage_location = memory
         self.threshold1 = threshold1
         self.threshold2 = threshold2
@@ -131,7 +131,7 @@ typedef struct _t_Tensor_ {
     addr_type offset_;
   };
   uint8_t layout_;
-  uint32_t reserved;
+  uint32_t life_;
 } tTensor;  // 56bytes
 
 typedef struct _t_TensorList_ {
@@ -26,6 +26,7 @@ class Graph(object):
         self.dynamic_args_max = {}
         self.dynamic_args_opt = {}
         self.dynamic_shape = {}
+        self.states = []
         self.platform = None
 
     def add_node(self, node: GraphNode):
@@ -47,6 +48,7 @@ class Graph(object):
         self.dynamic_args_max = src.dynamic_args_max
         self.dynamic_args_opt = src.dynamic_args_opt
         self.dynamic_shape = src.dynamic_shape
+        self.states = src.states
         self.platform = src.platform
         return self
 
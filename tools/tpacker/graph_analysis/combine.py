@@ -55,7 +55,9 @@ def _get_memory_plan(graph: Graph, device: Device, memory_config: MemoryConfig,
     new_graph = _graph_bind_device(new_graph, device, memory_config.storage_location, memory_config.threshold4)
     new_graph.acquire_dynamic_shape()
     new_graph.pack_params()
-    memory_planer = memory_plan(new_graph, memory_config.dma_prefetch)
+    memory_planer = memory_plan(new_graph, memory_config.dma_prefetch, memory_config.dma_depth,
+                                memory_config.dma_merge_size, memory_config.spill_size,
+                                memory_config.spill_gap)
     return new_graph, memory_planer, is_linearint
 
 def _graph_bind_device(graph: Graph, device: Device, dy_memory: Dict[str, Tuple[int]], threshold: int) -> Graph:
@@ -9,6 +9,69 @@ from ..enum_defines import DevType, MemType
 WORKSPACE_NAME = "workspace"
 DMA_BUFFER1_NAME = "dma_buffer1"
 DMA_BUFFER2_NAME = "dma_buffer2"
+DMA_OP_TYPES = {"Conv1dInt", "Conv2dInt", "ConvTranspose2dInt", "LinearInt", "LSTMInt", "GRUInt", "LayerNormInt"}
+# ops fetching their weights once per call, the recurrent ones fetch them per step
+DMA_MERGE_OP_TYPES = {"Conv1dInt", "Conv2dInt", "ConvTranspose2dInt", "LinearInt", "LayerNormInt"}
+# the executor keeps 64 activation transfers, a spill and a fill per tensor
+SPILL_MAX_TENSORS = 32
+
+
+def dma_buffer_name(slot: int) -> str:
+    """Name of the DMA buffer in ring slot 0, 1, ..."""
+    return f"dma_buffer{slot + 1}"
+
+
+def get_dma_params(node):
+    """Constant inputs of a weighted op moved by DMA, their size and memory type"""
+    params = []
+    size = 0
+    mem_type = None
+    if node.op_type in DMA_OP_TYPES:
+        for x in node.inputs:
+            if x.tensor.mem_type != MemType.SHARE_MEM and x.is_constant() and x.tensor.data is not None:
+                params.append(x)
+                if x.tensor.bits != 0.5:
+                    size += x.tensor.nbytes
+                else:
+                    size += x.tensor.nbytes // 2
+                mem_type = x.tensor.mem_type
+    return params, size, mem_type
+
+
+def _dma_mergeable(node, params) -> bool:
+    if node.op_type not in DMA_MERGE_OP_TYPES:
+        return False
+    # packed 4-bit weights are rounded up in the parameter memory
+    if any(x.tensor.bits == 0.5 for x in params):
+        return False
+    return all(params[i + 1].index == params[i].index + 1 for i in range(len(params) - 1))
+
+
+def plan_dma_groups(graph, merge_size: int = 0) -> List[List[tuple]]:
+    """
+    Split the weights of the graph into DMA transfers in execution order.
+    Ops whose weights follow each other in the same parameter memory are
+    merged into one burst of at most merge_size bytes, 0 disables merging.
+    Each group is a list of (node, params, size, mem_type), the first op issues the burst.
+    """
+    groups = []
+    for node in graph.nodes.values():
+        if not hasattr(node, "op_type"):
+            continue
+        params, size, mem_type = get_dma_params(node)
+        if size == 0:
+            continue
+        if merge_size > 0 and len(groups) != 0 and _dma_mergeable(node, params):
+            last = groups[-1]
+            last_node, last_params, _, last_mem_type = last[-1]
+            if (_dma_mergeable(last_node, last_params)
+                    and mem_type == last_mem_type
+                    and params[0].index == last_params[-1].index + 1
+                    and sum(x[2] for x in last) + size <= merge_size):
+                last.append((node, params, size, mem_type))
+                continue
+        groups.append([(node, params, size, mem_type)])
+    return groups
 
 
 def sub_list(list1, list2):
@@ -34,14 +97,24 @@ class NodeContext(object):
         self.total_size = 0
 
 class MemoryPlaner(object):
-    def __init__(self, graph, dma_prefetch: bool = True):
+    def __init__(self, graph, dma_prefetch: bool = True, dma_depth: int = 2, dma_merge_size: int = 0,
+                 spill_size: int = 0, spill_gap: int = 8):
         self.node_ctx_list = [NodeContext(x) for x in graph.nodes.values()]
         self.entry_ctx_list = [EntryContext(e) for e in graph.entries.values()]
         self.entries = graph.entries
+        self.state_names = set(name for pair in graph.states for name in pair)
+        assert dma_depth >= 1, f"dma_depth must be at least 1, got {dma_depth}"
+        self.dma_depth = dma_depth
+        self.dma_buffer_names = set(dma_buffer_name(i) for i in range(dma_depth))
+        self.dma_merge_size = dma_merge_size
         # add workspace
         self.get_workspace(graph)
         if dma_prefetch:
             self.get_dma_buffer(graph)
+        self.spill_lives = {}
+        self.spills = []
+        if spill_size > 0:
+            self.get_spill(spill_size, spill_gap)
 
         for x in self.entry_ctx_list:
             x.nbytes = x.entry.tensor.nbytes
@@ -99,61 +172,68 @@ class MemoryPlaner(object):
             self.entry_ctx_list.append(ctx)
 
     def get_dma_buffer(self, graph):
-        max_dma_buffer1 = {}
-        max_dma_buffer2 = {}
-        index = 0
-        for node in graph.nodes.values():
-            dma_size = 0
-            if node.op_type in {"Conv1dInt", "Conv2dInt", "ConvTranspose2dInt", "LinearInt", "LSTMInt", "GRUInt", "LayerNormInt"}:
-            # if node.op_type in {"Conv1dInt", "Conv2dInt", "ConvTranspose2dInt", "LinearInt", "LayerNormInt"} \
-            #     and node.dev_type == DevType.LUNA:
-                for x in node.inputs:
-                    if x.tensor.mem_type != MemType.SHARE_MEM and x.is_constant():
-                        dma_size += x.tensor.nbytes
-                if dma_size != 0:
-                    # max workspace
-                    if index % 2 == 0:
-                        if MemType.SHARE_MEM not in max_dma_buffer1:
-                            max_dma_buffer1[MemType.SHARE_MEM] = dma_size
-                        elif max_dma_buffer1[MemType.SHARE_MEM] < dma_size:
-                            max_dma_buffer1[MemType.SHARE_MEM] = dma_size
-                    else:
-                        if MemType.SHARE_MEM not in max_dma_buffer2:
-                            max_dma_buffer2[MemType.SHARE_MEM] = dma_size
-                        elif max_dma_buffer2[MemType.SHARE_MEM] < dma_size:
-                            max_dma_buffer2[MemType.SHARE_MEM] = dma_size
-                    index += 1
-            # elif node.op_type == "LSTMInt":
-            #     for x in node.inputs:
-            #         if x.tensor.mem_type != MemType.SHARE_MEM and x.is_constant():
-            #             dma_size = x.tensor.nbytes
-
-            #             if index % 2 == 0:
-            #                 if MemType.SHARE_MEM not in max_dma_buffer1:
-            #                     max_dma_buffer1[MemType.SHARE_MEM] = dma_size
-            #                 elif max_dma_buffer1[MemType.SHARE_MEM] < dma_size:
-            #                     max_dma_buffer1[MemType.SHARE_MEM] = dma_size
-            #             else:
-            #                 if MemType.SHARE_MEM not in max_dma_buffer2:
-            #                     max_dma_buffer2[MemType.SHARE_MEM] = dma_size
-            #                 elif max_dma_buffer2[MemType.SHARE_MEM] < dma_size:
-            #                     max_dma_buffer2[MemType.SHARE_MEM] = dma_size
-
-            #             index += 1
-
-        for k, v in max_dma_buffer1.items():
-            entry = GraphEntry(DMA_BUFFER1_NAME, Tensor.from_shape([v], np.int8, k))
-            entry.tensor.mem_type = k
-            entry.index = len(self.entry_ctx_list)
-            ctx = EntryContext(entry)
-            self.entry_ctx_list.append(ctx)
-
-        for k, v in max_dma_buffer2.items():
-            entry = GraphEntry(DMA_BUFFER2_NAME, Tensor.from_shape([v], np.int8, k))
-            entry.tensor.mem_type = k
-            entry.index = len(self.entry_ctx_list)
-            ctx = EntryContext(entry)
-            self.entry_ctx_list.append(ctx)
+        # transfers rotate through a ring of dma_depth buffers by transfer index, the
+        # executor keeps up to dma_depth - 1 transfers ahead of the op being computed
+        max_dma_buffer = [{} for _ in range(self.dma_depth)]
+        for index, group in enumerate(plan_dma_groups(graph, self.dma_merge_size)):
+            dma_size = sum(x[2] for x in group)
+            # max workspace
+            slot = max_dma_buffer[index % self.dma_depth]
+            if MemType.SHARE_MEM not in slot:
+                slot[MemType.SHARE_MEM] = dma_size
+            elif slot[MemType.SHARE_MEM] < dma_size:
+                slot[MemType.SHARE_MEM] = dma_size
+
+        for i, max_size in enumerate(max_dma_buffer):
+            for k, v in max_size.items():
+                entry = GraphEntry(dma_buffer_name(i), Tensor.from_shape([v], np.int8, k))
+                entry.tensor.mem_type = k
+                entry.index = len(self.entry_ctx_list)
+                ctx = EntryContext(entry)
+                self.entry_ctx_list.append(ctx)
+
+    def get_spill(self, spill_size, spill_gap):
+        # an activation idle for spill_gap ops is copied to PSRAM after the use before the gap
+        # and back into a new share memory tensor before the use after it, the executor runs
+        # the spill during the op after the first use and the fill during the op before the second
+        candidates = []
+        for ctx in list(self.entry_ctx_list):
+            e = ctx.entry
+            if e.is_constant() or e.is_graph_input() or e.is_graph_output():
+                continue
+            if e.name in self.state_names or e.tensor.mem_type != MemType.SHARE_MEM:
+                continue
+            if e.src_node is None or len(e.dst_nodes) == 0:
+                continue
+            nbytes = e.tensor.nbytes
+            if is_sympy(nbytes) or nbytes < spill_size:
+                continue
+            # memory shared in place with another tensor can not move alone
+            if e.src_node.op.is_inplace() or any(x.op.is_inplace() for x in e.dst_nodes):
+                continue
+            uses = sorted(set([e.src_node.index] + [x.index for x in e.dst_nodes]))
+            if len(uses) < 2:
+                continue
+            gap, u, v = max((uses[k + 1] - uses[k], uses[k], uses[k + 1]) for k in range(len(uses) - 1))
+            # share memory is free from u + 2 to v - 3
+            if gap < max(spill_gap, 5):
+                continue
+            candidates.append((nbytes * gap, ctx, u, v, uses[-1]))
+
+        candidates.sort(key=lambda x: x[0], reverse=True)
+        for _, ctx, u, v, last in candidates[:SPILL_MAX_TENSORS]:
+            e = ctx.entry
+            spill = GraphEntry(e.name + "_spill", e.tensor.clone(mem_type=MemType.PSRAM))
+            fill = GraphEntry(e.name + "_fill", e.tensor.clone(mem_type=MemType.SHARE_MEM))
+            # the executor starts a transfer after the first op of its destination
+            # and completes it after the last op of its source
+            self.spill_lives[e.name] = (e.src_node.index, u + 1)
+            self.spill_lives[spill.name] = (u, v - 1)
+            self.spill_lives[fill.name] = (v - 2, last)
+            for x in (spill, fill):
+                x.index = len(self.entry_ctx_list)
+                self.entry_ctx_list.append(EntryContext(x))
+            self.spills.append((e, spill, fill, v))
 
     def update_share_id(self):
         for s in self.entry_ctx_list:
@@ -180,9 +260,11 @@ class MemoryPlaner(object):
                 s.life_end = len(self.node_ctx_list) - 1
             elif s.entry.name == WORKSPACE_NAME:
                 pass
-            elif s.entry.name == DMA_BUFFER1_NAME or s.entry.name == DMA_BUFFER2_NAME:
+            elif s.entry.name in self.dma_buffer_names:
                 s.life_begin = 0
                 s.life_end  = len(self.node_ctx_list) - 1
+            elif s.entry.name in self.spill_lives:
+                s.life_begin, s.life_end = self.spill_lives[s.entry.name]
             else:
                 s.life_begin = s.entry.src_node.index
                 if len(s.entry.dst_nodes) == 0:  # unused tensor
@@ -190,6 +272,11 @@ class MemoryPlaner(object):
                 else:
                     s.life_end = max([x.index for x in s.entry.dst_nodes])
 
+            # state buffers are swapped by the executor between forwards
+            if s.entry.name in self.state_names:
+                s.life_begin = 0
+                s.life_end = len(self.node_ctx_list) - 1
+
         # update inplace alive status
         for i, _t in enumerate(self.entry_ctx_list):
             _t_prev = _t
@@ -400,11 +487,12 @@ class MemoryGreedyByOrder(MemoryPlaner):
                 # print("greedy by order on {}:{},{},{}".format(memory_list[d].name, len(mem_sizes),mem_sizes,sum(mem_sizes)))
                 self.mem_sizes[memory_list[d].value] = mem_sizes
 
-def memory_plan(graph: Graph, dma_prefetch_on: bool) -> Dict[int, List[int]]:
+def memory_plan(graph: Graph, dma_prefetch_on: bool, dma_depth: int = 2, dma_merge_size: int = 0,
+                spill_size: int = 0, spill_gap: int = 8) -> Dict[int, List[int]]:
     plan_list = [
-        MemoryGreedyBySize(graph, dma_prefetch_on),
-        MemoryGreedyByBreadth(graph, dma_prefetch_on),
-        MemoryGreedyByOrder(graph, dma_prefetch_on),
+        MemoryGreedyBySize(graph, dma_prefetch_on, dma_depth, dma_merge_size, spill_size, spill_gap),
+        MemoryGreedyByBreadth(graph, dma_prefetch_on, dma_depth, dma_merge_size, spill_size, spill_gap),
+        MemoryGreedyByOrder(graph, dma_prefetch_on, dma_depth, dma_merge_size, spill_size, spill_gap),
     ]
 
     memory_list = []
@@ -431,4 +519,4 @@ def memory_plan(graph: Graph, dma_prefetch_on: bool) -> Dict[int, List[int]]:
 def get_memory_size(memory_plan: Dict[int, List[int]], memory_type: MemType) -> int:
     return sum(memory_plan.mem_sizes[memory_type.value])
 
-__all__ = ["WORKSPACE_NAME", "DMA_BUFFER1_NAME", "DMA_BUFFER2_NAME", "memory_plan", "get_memory_size",]
+__all__ = ["WORKSPACE_NAME", "DMA_BUFFER1_NAME", "DMA_BUFFER2_NAME", "dma_buffer_name", "plan_dma_groups", "memory_plan", "get_memory_size",]
@@ -267,6 +267,11 @@ def _convert_from_onnx_model(graph_path: str, model_config: ModelConfig, is_dump
             thinker_graph.entries[name].set_graph_output()
             thinker_graph.outputs.append(thinker_graph.entries[name])
 
+    for in_name, out_name in model_config.states:
+        assert (in_name in thinker_graph.entries), f"state entry:{in_name} do not in original graph"
+        assert (out_name in thinker_graph.entries), f"state entry:{out_name} do not in original graph"
+    thinker_graph.states = model_config.states
+
     if model_config.inputs or model_config.outputs:
         thinker_graph.update()
         thinker_graph._apply_dynamic_axes(model_config.dynamic_shape)
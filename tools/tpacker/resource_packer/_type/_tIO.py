@@ -28,7 +28,9 @@ class tIOInfo(Structure):
         ("name_offset", c_uint32),
     ]
 
-    def __init__(self, inputs, outputs, states=[]):
+    def __init__(self, inputs, outputs, states=None):
+        if states is None:
+            states = []
         self.num_input = c_uint16(len(inputs))
         self.num_output = c_uint16(len(outputs))
         self.num_state = c_uint16(len(states))
@@ -64,4 +66,4 @@ class tIOInfo(Structure):
         return self.bytes
 
 
-__all__ = ["tIO", "tIOInfo"]
+__all__ = ["tIO", "tState", "tIOInfo"]
@@ -11,7 +11,7 @@ def nptype_to_thinker(nptype):
 
 
 class tTensor(object):
-    def __init__(self, tensor, mem_id, mem_offset, mem_type):
+    def __init__(self, tensor, mem_id, mem_offset, mem_type, life=None):
         dtype = nptype_to_thinker(tensor.dtype)
 
         self.obj = tffi.new("tTensor *")
@@ -25,6 +25,10 @@ class tTensor(object):
         self.obj.shape_.dims_ = tensor.shape
         self.obj.offset_ = mem_offset
         self.obj.layout_ = tensor.layout.value
+        # liveness of runtime tensors lets the executor re-plan offsets for smaller shapes
+        if life is not None:
+            begin, end = life
+            self.obj.life_ = (1 << 31) | (min(end, 0x7FFF) << 16) | min(begin, 0xFFFF)
 
     def to_bytes(self):
         return bytes(tffi.buffer(self.obj))
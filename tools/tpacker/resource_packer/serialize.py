@@ -38,7 +38,7 @@ def serialize_model(graph: Graph, memory_plan: Dict[int, List[int]], device: Dev
     operator_list, dma_list = pack_operator(graph, memory_plan)
     
     # 打包输入输出
-    input_list, output_list = pack_io(graph)
+    input_list, output_list, state_list = pack_io(graph)
     
     # 打包形状信息
     dy_axis_list, id_pairs_list, scalar_graph = pack_shape(graph)
@@ -55,7 +55,7 @@ def serialize_model(graph: Graph, memory_plan: Dict[int, List[int]], device: Dev
         tMemoryList(shared_memory_list, runtime_memory_list, device.sram_size),
         tTensorList(tensor_list),
         tOperatorList(operator_list),
-        tIOInfo(input_list, output_list),
+        tIOInfo(input_list, output_list, state_list),
         tParameterList(param_list),
         tShapeInferHdr(dy_axis_list, id_pairs_list, scalar_graph),
         tDebugList(tensor_name_list),
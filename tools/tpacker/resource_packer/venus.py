@@ -3,7 +3,7 @@ from typing import List, Tuple, Dict
 from ._type import *
 from ..graph import Graph, ScalarGraph
 from ..enum_defines import MemType, ALIGN16, TensorType
-from ..graph_analysis.memory import WORKSPACE_NAME, DMA_BUFFER1_NAME, DMA_BUFFER2_NAME
+from ..graph_analysis.memory import WORKSPACE_NAME, DMA_BUFFER1_NAME, DMA_BUFFER2_NAME, dma_buffer_name, plan_dma_groups
 
 
 def pack_memory(memory_planer: Dict[int, List[int]]) -> List[tMemory]:
@@ -34,9 +34,11 @@ def pack_tensor(memory_planer: Dict[int, List[int]]) -> Tuple[List[tTensor], Lis
         tensor = ctx.entry.tensor
         run_mem_id = 0
         offset = 0
+        life = None
         if mem_id != -1:
             offset = mem_offset[ctx.entry.tensor.mem_type.value][mem_id]
             run_mem_id = 1
+            life = (ctx.life_begin, ctx.life_end)
         else:
             run_mem_id = 0
             offset = param_offset[ctx.entry.tensor.mem_type.value]
@@ -45,12 +47,18 @@ def pack_tensor(memory_planer: Dict[int, List[int]]) -> Tuple[List[tTensor], Lis
             else:
                 param_offset[ctx.entry.tensor.mem_type.value] += tensor.nbytes
 
-        tensor_list.append(tTensor(tensor, run_mem_id, offset, ctx.entry.tensor.mem_type.value))
+        tensor_list.append(tTensor(tensor, run_mem_id, offset, ctx.entry.tensor.mem_type.value, life))
         tensor_name_list.append(tTensorName(ctx.entry.name))
     return tensor_list, tensor_name_list
 
 def pack_operator(graph: Graph, memory_planer: Dict[int, List[int]], arch=None) -> Tuple[List[tOperator], List[tDMA]]:
-    node_index = 0
+    # ring slot and transfer size of every weighted op, 0 for ops served by the burst of the one before
+    dma_plan = {}
+    for index, group in enumerate(plan_dma_groups(graph, memory_planer.dma_merge_size)):
+        for i, (node, _, _, _) in enumerate(group):
+            dma_plan[node.name] = (index, sum(x[2] for x in group) if i == 0 else 0)
+    # readers after the gap of a spilled activation take the share memory copy filled back
+    fills = {e.index: (fill.index, v) for e, _, fill, v in memory_planer.spills}
     dma_list = []
     operator_list = []
     for node in graph.nodes.values():
@@ -64,7 +72,11 @@ def pack_operator(graph: Graph, memory_planer: Dict[int, List[int]], arch=None)
                 if "workspace" in ctxt.entry.name:
                     temp_tensor_ids.append(ctxt.entry.index)
                     break
-        tensor_ids = ([x.index for x in node.inputs] + [x.index for x in node.outputs] + temp_tensor_ids)
+        input_ids = [x.index for x in node.inputs]
+        for k, x in enumerate(node.inputs):
+            if x.index in fills and node.index >= fills[x.index][1]:
+                input_ids[k] = fills[x.index][0]
+        tensor_ids = (input_ids + [x.index for x in node.outputs] + temp_tensor_ids)
         size = 0
         mem_type = None
         param_ids = []
@@ -79,22 +91,16 @@ def pack_operator(graph: Graph, memory_planer: Dict[int, List[int]], arch=None)
                         size += x.tensor.nbytes//2
                     mem_type = x.tensor.mem_type
             if size != 0:
-                if node_index % 2 == 0:
-                    for ctxt in memory_planer.entry_ctx_list:
-                        if ctxt.entry.name == DMA_BUFFER1_NAME:
-                            dma_tensor_ids.append(ctxt.entry.index)
-                            tensor_ids.append(ctxt.entry.index)
-                            break
-                else:
-                    for ctxt in memory_planer.entry_ctx_list:
-                        if ctxt.entry.name == DMA_BUFFER2_NAME:
-                            dma_tensor_ids.append(ctxt.entry.index)
-                            tensor_ids.append(ctxt.entry.index)
-                            break
+                slot, size = dma_plan[node.name]
+                buffer_name = dma_buffer_name(slot % memory_planer.dma_depth)
+                for ctxt in memory_planer.entry_ctx_list:
+                    if ctxt.entry.name == buffer_name:
+                        dma_tensor_ids.append(ctxt.entry.index)
+                        tensor_ids.append(ctxt.entry.index)
+                        break
 
                 if len(dma_tensor_ids) != 0:
                     dma_list.append([tDMA(mem_type, MemType.SHARE_MEM,param_ids[0], dma_tensor_ids[0],size,)])
-                node_index += 1
         # elif node.op_type == "LSTMInt":
         #     for x in node.inputs:
         #         size = 0
@@ -157,9 +163,19 @@ def pack_operator(graph: Graph, memory_planer: Dict[int, List[int]], arch=None)
         num_input = len(node.inputs)
         num_output = len(node.outputs)
         operator_list.append(tOperator(op_attrs, node.op_type, "HIFI", num_input, num_output, tensor_ids))
+    # activation transfers follow the weights, ordered by the op they start after
+    act_list = []
+    for e, spill, fill, _ in memory_planer.spills:
+        size = e.tensor.nbytes
+        act_list.append((memory_planer.spill_lives[spill.name][0],
+                         tDMA(MemType.SHARE_MEM, MemType.PSRAM, e.index, spill.index, size)))
+        act_list.append((memory_planer.spill_lives[fill.name][0],
+                         tDMA(MemType.PSRAM, MemType.SHARE_MEM, spill.index, fill.index, size)))
+    act_list.sort(key=lambda x: x[0])
+    dma_list.extend([[x[1]] for x in act_list])
     return operator_list, dma_list
 
-def pack_io(graph: Graph) -> Tuple[List[tIO], List[tIO]]:
+def pack_io(graph: Graph) -> Tuple[List[tIO], List[tIO], List[tState]]:
     input_list = []
     for input_entry in graph.inputs:
         if input_entry.tensor_type == TensorType.Input:
@@ -170,7 +186,15 @@ def pack_io(graph: Graph) -> Tuple[List[tIO], List[tIO]]:
     for output_entry in graph.outputs:
         tid = output_entry.index
         output_list.append(tIO(tid, output_entry.name))
-    return input_list, output_list
+
+    state_list = []
+    for in_name, out_name in graph.states:
+        in_entry = graph.entries[in_name]
+        out_entry = graph.entries[out_name]
+        assert in_entry.tensor.nbytes == out_entry.tensor.nbytes, f"state {in_name}:{out_name} size mismatch"
+        assert in_entry.tensor.dtype == out_entry.tensor.dtype, f"state {in_name}:{out_name} dtype mismatch"
+        state_list.append(tState(in_entry.index, out_entry.index, in_name))
+    return input_list, output_list, state_list
 
 def pack_param(memory_planer: Dict[int, List[int]]) -> Tuple[List[tParameter], List[tMemory]]:
     memory_list = []
@@ -9,6 +9,7 @@ from .onnx_graph import Graph, Tensor, Node
 from typing import Dict, List, Optional, Any, Tuple
 
 from . import luna_profile_arcs as luna_profile
+from .runtime_profile import RuntimeProfile, format_compare
 
 # ============================================================================================
 
@@ -19,6 +20,7 @@ class ONNXProfile:
     def __init__(self):
         self.graph = None
         self.estimate_result = []
+        self.estimate_outputs = []
         self.op_cycle_funcs = {
             "ArgMax": self._estimate_argmax_cycles,
             "AvgPool2dInt": self._estimate_avgpool2dint_cycles,
@@ -123,6 +125,7 @@ class ONNXProfile:
         total_luna_cycles = 0
         pre_luna_cycles = 0
         self.estimate_result = []
+        self.estimate_outputs = []
         index = 0
         for node in self.graph.node:
             logging.debug(f"estimate op, index:{index}, name:{node.name}")
@@ -154,6 +157,8 @@ class ONNXProfile:
             self.estimate_result.append(
                 (node.name, op_cycles, cpu_cycles, dma_tail, luna_cycles)
             )
+            # first output names the op in the packed model, used to match measured records
+            self.estimate_outputs.append(node.output[0] if node.output else "")
             index += 1
         # self.estimate_result.append(('', total_cycles, total_cpu_cycles, total_dma_cycles, total_luna_cycles))
         return self.estimate_result
@@ -1605,17 +1610,36 @@ def tprofile(args: argparse.Namespace):
         filename="log_onnx_profile.txt",
         filemode="w",
     )
-    assert os.path.isfile(args.input), f"{args.input} is not a file."
     assert args.format in [
         "speedscope",
         "csv",
         "debug",
+        "chrome",
+        "compare",
     ], f"Format {args.format} is not supported."
     assert args.platform in ["arcs"], f"Platform {args.platform} is not supported."
 
-    profiler = ONNXProfile()
-    profiler.estimate(args)
-    format_result = profiler.get_format_result(format=args.format)
+    measured = None
+    if args.measured:
+        assert os.path.isfile(args.measured), f"{args.measured} is not a file."
+        measured = RuntimeProfile(args.measured, args.ticks_per_us)
+    else:
+        assert args.format not in ["chrome", "compare"], f"Format {args.format} needs --measured."
+
+    if measured is not None and args.format in ["chrome", "speedscope"]:
+        # measured trace only, the model is just used for its name
+        model_name = os.path.splitext(os.path.basename(args.input or args.measured))[0]
+        format_result = measured.get_format_result(model_name, format=args.format)
+    else:
+        assert args.input and os.path.isfile(args.input), f"{args.input} is not a file."
+        profiler = ONNXProfile()
+        profiler.estimate(args)
+        if args.format == "compare":
+            format_result = format_compare(
+                profiler.estimate_result, profiler.estimate_outputs, measured
+            )
+        else:
+            format_result = profiler.get_format_result(format=args.format)
 
     # Save results
     with open(args.output, "w", encoding="utf-8") as f:
@@ -1625,7 +1649,19 @@ def tprofile(args: argparse.Namespace):
 def parse_arguments(argv=None) -> argparse.Namespace:
     parser = argparse.ArgumentParser(description="ONNX Shape Inference Tool")
     parser.add_argument(
-        "--input", type=str, required=True, help="Path to input ONNX model"
+        "--input", type=str, required=False, help="Path to input ONNX model"
+    )
+    parser.add_argument(
+        "--measured",
+        type=str,
+        required=False,
+        help="Path to the profile csv written by test_thinker with THINKER_PROFILE",
+    )
+    parser.add_argument(
+        "--ticks-per-us",
+        type=float,
+        default=1.0,
+        help="Measured ticks per microsecond, 1 on host, cpu MHz on chip",
     )
     parser.add_argument(
         "--output",
@@ -1635,7 +1671,7 @@ def parse_arguments(argv=None) -> argparse.Namespace:
     parser.add_argument(
         "--format",
         type=str,
-        help="Output format, e.g., csv, speedscope",
+        help="Output format, e.g., csv, speedscope, chrome, compare",
     )
     parser.add_argument(
         "--platform", type=str, default="arcs", help="Target platform, e.g., arcs"
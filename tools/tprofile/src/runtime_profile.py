@@ -0,0 +1,171 @@
+import csv
+import json
+from typing import Dict, List, Tuple
+
+# ============================================================================================
+
+
+class RuntimeRecord:
+    """One operator execution measured by the executor (tProfileRecord)"""
+
+    def __init__(self, row: Dict[str, str]):
+        self.op_index = int(row["op_index"])
+        self.op_type = row["op_type"]
+        self.tensor_name = row["tensor_name"]
+        self.forward = int(row["forward"])
+        self.start = int(row["start"])
+        self.end = int(row["end"])
+        self.dma_wait = int(row["dma_wait"])
+        self.bytes_in = int(row["bytes_in"])
+        self.bytes_out = int(row["bytes_out"])
+
+    @property
+    def ticks(self) -> int:
+        return self.end - self.start
+
+    @property
+    def name(self) -> str:
+        """Debug tensor name of the first output, operator type if not packed"""
+        return self.tensor_name if self.tensor_name else f"{self.op_type}_{self.op_index}"
+
+
+class RuntimeProfile:
+    """Measured per-op timing written by test_thinker with THINKER_PROFILE enabled"""
+
+    def __init__(self, path: str, ticks_per_us: float = 1.0):
+        with open(path, "r", encoding="utf-8") as f:
+            self.records = [RuntimeRecord(row) for row in csv.DictReader(f)]
+        self.records.sort(key=lambda r: r.start)
+        self.ticks_per_us = ticks_per_us
+
+    def _us(self, ticks: int) -> float:
+        return ticks / self.ticks_per_us
+
+    def get_op_ticks(self) -> Dict[int, Tuple[RuntimeRecord, float, float]]:
+        """Average ticks and dma wait of every operator over all recorded forwards"""
+        total = {}
+        wait = {}
+        count = {}
+        first = {}
+        for r in self.records:
+            total[r.op_index] = total.get(r.op_index, 0) + r.ticks
+            wait[r.op_index] = wait.get(r.op_index, 0) + r.dma_wait
+            count[r.op_index] = count.get(r.op_index, 0) + 1
+            first.setdefault(r.op_index, r)
+        return {k: (first[k], total[k] / count[k], wait[k] / count[k]) for k in sorted(total)}
+
+    def get_format_result(self, model_name: str, format="chrome") -> str:
+        """Get the formatted measured result"""
+        if format == "chrome":
+            return self._format_chrome(model_name)
+        elif format == "speedscope":
+            return self._format_speedscope(model_name)
+        else:
+            raise NotImplementedError(f"Format {format} is not implemented.")
+
+    def _format_chrome(self, model_name: str) -> str:
+        # chrome://tracing or https://ui.perfetto.dev/
+        # every forward is one thread, the weight DMA wait is nested at the start of its op
+        events = [
+            {"name": "process_name", "ph": "M", "pid": 0, "args": {"name": model_name}}
+        ]
+        origin = self.records[0].start if self.records else 0
+        for r in self.records:
+            ts = self._us(r.start - origin)
+            args = {
+                "op_index": r.op_index,
+                "ticks": r.ticks,
+                "dma_wait": r.dma_wait,
+                "bytes_in": r.bytes_in,
+                "bytes_out": r.bytes_out,
+            }
+            events.append(
+                {"name": r.name, "cat": r.op_type, "ph": "X", "pid": 0,
+                 "tid": r.forward, "ts": ts, "dur": self._us(r.ticks), "args": args}
+            )
+            if r.dma_wait > 0:
+                events.append(
+                    {"name": "dma_wait", "cat": "dma", "ph": "X", "pid": 0,
+                     "tid": r.forward, "ts": ts, "dur": self._us(r.dma_wait)}
+                )
+        return json.dumps({"traceEvents": events, "displayTimeUnit": "ms"}, indent=1)
+
+    def _format_speedscope(self, model_name: str) -> str:
+        # https://www.speedscope.app/file-format-schema.json, one evented profile per forward
+        frames = []
+        frame_index = {}
+
+        def frame(name: str) -> int:
+            if name not in frame_index:
+                frame_index[name] = len(frames)
+                frames.append({"name": name})
+            return frame_index[name]
+
+        forwards = {}
+        for r in self.records:
+            forwards.setdefault(r.forward, []).append(r)
+
+        profiles = []
+        for forward, records in sorted(forwards.items()):
+            origin = records[0].start
+            events = []
+            for r in records:
+                op = frame(r.name)
+                start = self._us(r.start - origin)
+                end = self._us(r.end - origin)
+                events.append({"type": "O", "frame": op, "at": start})
+                if r.dma_wait > 0:
+                    wait = frame("dma_wait")
+                    events.append({"type": "O", "frame": wait, "at": start})
+                    events.append({"type": "C", "frame": wait,
+                                   "at": min(start + self._us(r.dma_wait), end)})
+                events.append({"type": "C", "frame": op, "at": end})
+            profiles.append(
+                {"type": "evented", "name": f"{model_name} forward {forward}",
+                 "unit": "microseconds", "startValue": 0,
+                 "endValue": self._us(records[-1].end - origin), "events": events}
+            )
+        return json.dumps(
+            {"$schema": "https://www.speedscope.app/file-format-schema.json",
+             "name": model_name, "shared": {"frames": frames}, "profiles": profiles},
+            indent=1,
+        )
+
+
+def format_compare(
+    estimate: List[Tuple[str, int, int, int, int]],
+    estimate_outputs: List[str],
+    measured: RuntimeProfile,
+) -> str:
+    """
+    Side-by-side csv of estimated cycles and measured ticks per op.
+    Ops are matched by the first output tensor name; the shares of the
+    totals are unit free, share_ratio far from 1 points to the cost model.
+    """
+    by_output = {}
+    for (op_name, op_cycles, *_), output in zip(estimate, estimate_outputs):
+        by_output[output] = (op_name, op_cycles)
+
+    rows = []
+    for op_index, (record, ticks, dma_wait) in measured.get_op_ticks().items():
+        op_name, op_cycles = by_output.get(record.tensor_name, ("", None))
+        rows.append((op_index, record.op_type, record.name, op_name, op_cycles, ticks, dma_wait))
+
+    total_cycles = sum(r[4] for r in rows if r[4] is not None) or 1
+    total_ticks = sum(r[5] for r in rows if r[4] is not None) or 1
+    format_result = "op_index, op_type, tensor_name, onnx_node, estimated_cycles, measured_ticks, dma_wait, estimated_share, measured_share, share_ratio,\n"
+    for op_index, op_type, name, op_name, op_cycles, ticks, dma_wait in rows:
+        if op_cycles is None:
+            format_result += f"{op_index},{op_type},{name},,,{ticks:.0f},{dma_wait:.0f},,,,\n"
+            continue
+        est_share = op_cycles / total_cycles
+        mea_share = ticks / total_ticks
+        ratio = f"{mea_share / est_share:.3f}" if est_share > 0 else ""
+        format_result += (
+            f"{op_index},{op_type},{name},{op_name},{op_cycles},{ticks:.0f},{dma_wait:.0f},"
+            f"{est_share:.4f},{mea_share:.4f},{ratio},\n"
+        )
+    return format_result
+
+
+__all__ = ["RuntimeProfile", "RuntimeRecord", "format_compare"]